@@ -0,0 +1,398 @@
+/**
+ *
+ *  @file      assignment.c
+ *  @brief     Implementation of the results of the assignment solvers.
+ *  @details   This file contains the functions that build assignment results
+ *             and stream them to text or binary files.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "assignment.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "constants.h"
+#include "error_codes.h"
+
+/**
+ * @struct AssignmentWriter
+ * @brief Buffered writer that streams assignments to a file.
+ */
+struct AssignmentWriter {
+  FILE* file;                         // The file
+  AssignmentFormat format;            // Format of the file
+  long long count;                    // Assignments written so far
+  int status;                         // First error, or `SUCCESS`
+  size_t length;                      // Number of bytes used in `data`
+  char data[ASSIGNMENT_BUFFER_SIZE];  // Pending output
+};
+
+/**
+ * @brief Stores a 32-bit integer in little-endian byte order.
+ * @param bytes - Destination bytes.
+ * @param value - The integer.
+ */
+static void StoreInt32(unsigned char* bytes, int32_t value) {
+  uint32_t bits = (uint32_t)value;
+  for (int i = 0; i < 4; i++) {
+    bytes[i] = (unsigned char)(bits >> (8 * i));
+  }
+}
+
+/**
+ * @brief Stores a 64-bit integer in little-endian byte order.
+ * @param bytes - Destination bytes.
+ * @param value - The integer.
+ */
+static void StoreInt64(unsigned char* bytes, int64_t value) {
+  uint64_t bits = (uint64_t)value;
+  for (int i = 0; i < 8; i++) {
+    bytes[i] = (unsigned char)(bits >> (8 * i));
+  }
+}
+
+/**
+ * @brief  Creates an empty assignment result.
+ * @param  capacity - Number of assignments to reserve space for.
+ * @param  result   - The new result.
+ * @retval `NULL_POINTER`              - The result is NULL.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateAssignmentResult(int capacity, AssignmentResult** result) {
+  if (result == NULL) {
+    return NULL_POINTER;
+  }
+  if (capacity < 1) {
+    capacity = 1;
+  }
+
+  AssignmentResult* newResult = malloc(sizeof(AssignmentResult));
+  if (newResult == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  newResult->rowIndices = malloc((size_t)capacity * sizeof(int));
+  newResult->colIndices = malloc((size_t)capacity * sizeof(int));
+  newResult->values = malloc((size_t)capacity * sizeof(double));
+  if (newResult->rowIndices == NULL || newResult->colIndices == NULL ||
+      newResult->values == NULL) {
+    FreeAssignmentResult(newResult);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  newResult->count = 0;
+  newResult->capacity = capacity;
+  newResult->totalValue = 0;
+
+  *result = newResult;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Adds an assignment to a result, growing it when it is full.
+ * @param  result - The result.
+ * @param  row    - The row of the assignment.
+ * @param  col    - The column of the assignment.
+ * @param  value  - The value of the assignment.
+ * @retval `NULL_POINTER`              - The result is NULL.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int AddAssignment(AssignmentResult* result, int row, int col, double value) {
+  if (result == NULL) {
+    return NULL_POINTER;
+  }
+
+  if (result->count == result->capacity) {
+    int capacity = result->capacity * 2;
+    int* rows = realloc(result->rowIndices, (size_t)capacity * sizeof(int));
+    if (rows != NULL) {
+      result->rowIndices = rows;
+    }
+    int* cols = realloc(result->colIndices, (size_t)capacity * sizeof(int));
+    if (cols != NULL) {
+      result->colIndices = cols;
+    }
+    double* values =
+        realloc(result->values, (size_t)capacity * sizeof(double));
+    if (values != NULL) {
+      result->values = values;
+    }
+    if (rows == NULL || cols == NULL || values == NULL) {
+      return MEMORY_ALLOCATION_FAILURE;
+    }
+    result->capacity = capacity;
+  }
+
+  result->rowIndices[result->count] = row;
+  result->colIndices[result->count] = col;
+  result->values[result->count] = value;
+  result->count++;
+  result->totalValue += value;
+  return SUCCESS;
+}
+
+/**
+ * @brief Empties a result, keeping its arrays to be filled again.
+ * @param result - The result.
+ */
+void ClearAssignmentResult(AssignmentResult* result) {
+  if (result == NULL) {
+    return;
+  }
+
+  result->count = 0;
+  result->totalValue = 0;
+}
+
+/**
+ * @brief Fills the gap of a result from an upper bound on its optimum.
+ * @param gap        - The gap, or NULL.
+ * @param upperBound - No assignment has a larger total value.
+ * @param result     - The result.
+ */
+void SetAssignmentGap(AssignmentGap* gap, double upperBound,
+                      const AssignmentResult* result) {
+  if (gap == NULL) {
+    return;
+  }
+
+  // The bound may come out below the result by rounding
+  double distance = upperBound - result->totalValue;
+  double scale = fabs(upperBound) > 1.0 ? fabs(upperBound) : 1.0;
+  gap->upperBound = upperBound;
+  gap->gap = distance > 0.0 ? distance / scale : 0.0;
+}
+
+/**
+ * @brief Free allocated memory of an assignment result.
+ * @param result - The result to be freed.
+ */
+void FreeAssignmentResult(AssignmentResult* result) {
+  if (result == NULL) {
+    return;
+  }
+
+  free(result->rowIndices);
+  free(result->colIndices);
+  free(result->values);
+  free(result);
+}
+
+/**
+ * @brief Writes the pending output of a writer to its file.
+ * @param writer - The writer.
+ */
+static void FlushWriter(AssignmentWriter* writer) {
+  if (writer->length > 0 && writer->status == SUCCESS &&
+      fwrite(writer->data, 1, writer->length, writer->file) !=
+          writer->length) {
+    writer->status = FILE_WRITE_ERROR;
+  }
+  writer->length = 0;
+}
+
+/**
+ * @brief  Formats an integer in decimal without `printf`.
+ * @param  text  - Destination, with room for at least 21 characters.
+ * @param  value - The integer.
+ * @retval The number of characters written.
+ */
+static size_t FormatInteger(char* text, long long value) {
+  char digits[20];
+  size_t count = 0;
+  unsigned long long magnitude =
+      value < 0 ? 0ull - (unsigned long long)value : (unsigned long long)value;
+  do {
+    digits[count++] = (char)('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude > 0);
+
+  size_t length = 0;
+  if (value < 0) {
+    text[length++] = '-';
+  }
+  while (count > 0) {
+    text[length++] = digits[--count];
+  }
+  return length;
+}
+
+/**
+ * @brief  Formats a value, without `printf` when it is a whole number.
+ * @param  text  - Destination, with room for at least 32 characters.
+ * @param  value - The value.
+ * @retval The number of characters written.
+ */
+static size_t FormatValue(char* text, double value) {
+  // Whole numbers below 2^53 are exact and are formatted as integers
+  if (value > -9007199254740992.0 && value < 9007199254740992.0 &&
+      value == (double)(long long)value) {
+    return FormatInteger(text, (long long)value);
+  }
+  int length = snprintf(text, 32, "%.17g", value);
+  return length > 0 ? (size_t)length : 0;
+}
+
+/**
+ * @brief  Opens a file to stream assignments to.
+ * @param  filename - The name of the file.
+ * @param  format   - The format of the file.
+ * @param  writer   - The new writer.
+ * @retval `NULL_POINTER`              - No filename or writer provided.
+ * @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `FILE_WRITE_ERROR`          - Error writing to the file.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int OpenAssignmentWriter(const char* filename, AssignmentFormat format,
+                         AssignmentWriter** writer) {
+  if (filename == NULL || writer == NULL) {
+    return NULL_POINTER;
+  }
+
+  AssignmentWriter* newWriter = malloc(sizeof(AssignmentWriter));
+  if (newWriter == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  newWriter->file = fopen(filename, "wb");
+  if (newWriter->file == NULL) {
+    free(newWriter);
+    return CANNOT_OPEN_FILE;
+  }
+  newWriter->format = format;
+  newWriter->count = 0;
+  newWriter->status = SUCCESS;
+  newWriter->length = 0;
+
+  // The number of assignments is filled in when the writer is closed
+  if (format == ASSIGNMENT_BINARY) {
+    unsigned char* header = (unsigned char*)newWriter->data;
+    memcpy(header, ASSIGNMENT_FILE_MAGIC, ASSIGNMENT_MAGIC_SIZE);
+    StoreInt64(header + ASSIGNMENT_MAGIC_SIZE, 0);
+    newWriter->length = ASSIGNMENT_HEADER_SIZE;
+  }
+
+  *writer = newWriter;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Writes one assignment. The output is buffered and written to the
+ *         file in blocks of `ASSIGNMENT_BUFFER_SIZE` bytes.
+ * @param  writer - The writer.
+ * @param  row    - The row of the assignment.
+ * @param  col    - The column of the assignment.
+ * @param  value  - The value of the assignment.
+ * @retval `NULL_POINTER`     - The writer is NULL.
+ * @retval `FILE_WRITE_ERROR` - Error writing to the file.
+ * @retval `SUCCESS`          - Operation successful.
+ */
+int WriteAssignment(AssignmentWriter* writer, int row, int col,
+                    double value) {
+  if (writer == NULL) {
+    return NULL_POINTER;
+  }
+
+  // Longest text line: two integers, a value and the separators
+  if (ASSIGNMENT_BUFFER_SIZE - writer->length < 64) {
+    FlushWriter(writer);
+  }
+
+  char* output = writer->data + writer->length;
+  if (writer->format == ASSIGNMENT_BINARY) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    StoreInt32((unsigned char*)output, row);
+    StoreInt32((unsigned char*)output + 4, col);
+    StoreInt64((unsigned char*)output + 8, (int64_t)bits);
+    writer->length += ASSIGNMENT_RECORD_SIZE;
+  } else {
+    size_t length = FormatInteger(output, row);
+    output[length++] = ELEMENT_SEPARATOR[0];
+    length += FormatInteger(output + length, col);
+    output[length++] = ELEMENT_SEPARATOR[0];
+    length += FormatValue(output + length, value);
+    output[length++] = '\n';
+    writer->length += length;
+  }
+  writer->count++;
+
+  return writer->status;
+}
+
+/**
+ * @brief  Flushes the pending assignments, closes the file and frees the
+ *         writer.
+ * @param  writer - The writer.
+ * @retval `NULL_POINTER`     - The writer is NULL.
+ * @retval `FILE_WRITE_ERROR` - Error writing to the file, now or in an
+ *                              earlier call to `WriteAssignment`.
+ * @retval `SUCCESS`          - Operation successful.
+ */
+int CloseAssignmentWriter(AssignmentWriter* writer) {
+  if (writer == NULL) {
+    return NULL_POINTER;
+  }
+
+  FlushWriter(writer);
+
+  // Patch the number of assignments in the header
+  if (writer->format == ASSIGNMENT_BINARY && writer->status == SUCCESS) {
+    unsigned char count[8];
+    StoreInt64(count, writer->count);
+    if (fseek(writer->file, ASSIGNMENT_MAGIC_SIZE, SEEK_SET) != 0 ||
+        fwrite(count, 1, sizeof(count), writer->file) != sizeof(count)) {
+      writer->status = FILE_WRITE_ERROR;
+    }
+  }
+
+  if (fclose(writer->file) != 0) {
+    writer->status = FILE_WRITE_ERROR;
+  }
+
+  int status = writer->status;
+  free(writer);
+  return status;
+}
+
+/**
+ * @brief  Writes all assignments of a result to a file.
+ * @param  filename - The name of the file.
+ * @param  result   - The result.
+ * @param  format   - The format of the file.
+ * @retval `NULL_POINTER`              - No filename or result provided.
+ * @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `FILE_WRITE_ERROR`          - Error writing to the file.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int WriteAssignmentResult(const char* filename,
+                          const AssignmentResult* result,
+                          AssignmentFormat format) {
+  if (result == NULL) {
+    return NULL_POINTER;
+  }
+
+  AssignmentWriter* writer = NULL;
+  int status = OpenAssignmentWriter(filename, format, &writer);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  for (int i = 0; i < result->count && status == SUCCESS; i++) {
+    status = WriteAssignment(writer, result->rowIndices[i],
+                             result->colIndices[i], result->values[i]);
+  }
+
+  int closeStatus = CloseAssignmentWriter(writer);
+  return status != SUCCESS ? status : closeStatus;
+}
@@ -0,0 +1,167 @@
+/**
+ *  @file      assignment.h
+ *  @brief     Header file for the results of the assignment solvers.
+ *  @details   This file contains the structure that holds the row to column
+ *             mapping chosen by a solver, and writers that stream assignments
+ *             to text or binary files.
+ *
+ *             Text files hold one assignment per line, as `row;col;value`.
+ *
+ *             Binary file layout (all numbers little-endian):
+ *             - Header: `ASSIGNMENT_FILE_MAGIC` (8 bytes) and the number of
+ *               assignments (int64).
+ *             - Records: row (int32), column (int32) and value (IEEE 754
+ *               double) of each assignment.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef ASSIGNMENT_H
+#define ASSIGNMENT_H
+
+/**
+ * @struct AssignmentResult
+ * @brief The assignments chosen by a solver.
+ *
+ * Assignment `i` selects the value `values[i]` at row `rowIndices[i]` and
+ * column `colIndices[i]` of the matrix.
+ */
+typedef struct AssignmentResult {
+  int count;          // Number of assignments
+  int capacity;       // Number of assignments that fit in the arrays
+  int* rowIndices;    // Row of each assignment
+  int* colIndices;    // Column of each assignment
+  double* values;     // Value of each assignment
+  double totalValue;  // Sum of the values
+} AssignmentResult;
+
+/**
+ * @struct AssignmentGap
+ * @brief How far a result may be from the optimum, reported by the solvers
+ *        that stop at a time or iteration limit.
+ *
+ * `gap` is `(upperBound - totalValue) / max(1, |upperBound|)`, 0 when the
+ * result is optimal.
+ */
+typedef struct AssignmentGap {
+  double upperBound;  // No assignment has a larger total value
+  double gap;         // Relative distance of the result to `upperBound`
+} AssignmentGap;
+
+/**
+ * @enum AssignmentFormat
+ * @brief Format of the files written by the assignment writers.
+ */
+typedef enum AssignmentFormat {
+  ASSIGNMENT_TEXT,   // One `row;col;value` line per assignment
+  ASSIGNMENT_BINARY  // Header followed by fixed-size records
+} AssignmentFormat;
+
+/**
+ * @struct AssignmentWriter
+ * @brief Buffered writer that streams assignments to a file.
+ */
+typedef struct AssignmentWriter AssignmentWriter;
+
+/**
+ * @brief  Creates an empty assignment result.
+ * @param  capacity - Number of assignments to reserve space for.
+ * @param  result   - The new result.
+ * @retval `NULL_POINTER`              - The result is NULL.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CreateAssignmentResult(int capacity,
+                                                 AssignmentResult** result);
+
+/**
+ * @brief  Adds an assignment to a result, growing it when it is full.
+ * @param  result - The result.
+ * @param  row    - The row of the assignment.
+ * @param  col    - The column of the assignment.
+ * @param  value  - The value of the assignment.
+ * @retval `NULL_POINTER`              - The result is NULL.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int AddAssignment(AssignmentResult* result, int row,
+                                        int col, double value);
+
+/**
+ * @brief Empties a result, keeping its arrays to be filled again.
+ * @param result - The result.
+ */
+__declspec(dllexport) void ClearAssignmentResult(AssignmentResult* result);
+
+/**
+ * @brief Fills the gap of a result from an upper bound on its optimum. This
+ *        function is not exported by the library.
+ * @param gap        - The gap, or NULL.
+ * @param upperBound - No assignment has a larger total value.
+ * @param result     - The result.
+ */
+void SetAssignmentGap(AssignmentGap* gap, double upperBound,
+                      const AssignmentResult* result);
+
+/**
+ * @brief Free allocated memory of an assignment result.
+ * @param result - The result to be freed.
+ */
+__declspec(dllexport) void FreeAssignmentResult(AssignmentResult* result);
+
+/**
+ * @brief  Opens a file to stream assignments to.
+ * @param  filename - The name of the file.
+ * @param  format   - The format of the file.
+ * @param  writer   - The new writer.
+ * @retval `NULL_POINTER`              - No filename or writer provided.
+ * @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `FILE_WRITE_ERROR`          - Error writing to the file.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int OpenAssignmentWriter(const char* filename,
+                                               AssignmentFormat format,
+                                               AssignmentWriter** writer);
+
+/**
+ * @brief  Writes one assignment. The output is buffered and written to the
+ *         file in blocks of `ASSIGNMENT_BUFFER_SIZE` bytes.
+ * @param  writer - The writer.
+ * @param  row    - The row of the assignment.
+ * @param  col    - The column of the assignment.
+ * @param  value  - The value of the assignment.
+ * @retval `NULL_POINTER`     - The writer is NULL.
+ * @retval `FILE_WRITE_ERROR` - Error writing to the file.
+ * @retval `SUCCESS`          - Operation successful.
+ */
+__declspec(dllexport) int WriteAssignment(AssignmentWriter* writer, int row,
+                                          int col, double value);
+
+/**
+ * @brief  Flushes the pending assignments, closes the file and frees the
+ *         writer.
+ * @param  writer - The writer.
+ * @retval `NULL_POINTER`     - The writer is NULL.
+ * @retval `FILE_WRITE_ERROR` - Error writing to the file, now or in an
+ *                              earlier call to `WriteAssignment`.
+ * @retval `SUCCESS`          - Operation successful.
+ */
+__declspec(dllexport) int CloseAssignmentWriter(AssignmentWriter* writer);
+
+/**
+ * @brief  Writes all assignments of a result to a file.
+ * @param  filename - The name of the file.
+ * @param  result   - The result.
+ * @param  format   - The format of the file.
+ * @retval `NULL_POINTER`              - No filename or result provided.
+ * @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `FILE_WRITE_ERROR`          - Error writing to the file.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int WriteAssignmentResult(const char* filename,
+                                                const AssignmentResult* result,
+                                                AssignmentFormat format);
+
+#endif  // !ASSIGNMENT_H
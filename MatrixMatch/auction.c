@@ -0,0 +1,785 @@
+/**
+ *
+ *  @file      auction.c
+ *  @brief     Implementation of the auction algorithm.
+ *  @details   This file contains the bidding phases of the auction algorithm
+ *             and the pool of threads that computes the bids of Jacobi
+ *             rounds. The values are stored row by row as doubles, multiplied
+ *             by n + 1; with integer values every price and epsilon stays an
+ *             integer, so the arithmetic is exact.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "auction.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "assignment.h"
+#include "constants.h"
+#include "error_codes.h"
+#include "matrix_core.h"
+#include "matrix_dense.h"
+#include "platform.h"
+
+typedef struct Auction Auction;
+
+/**
+ * @struct AuctionWorker
+ * @brief Thread that computes a share of the bids of each Jacobi round.
+ */
+typedef struct AuctionWorker {
+  Auction* auction;  // The auction
+  int index;         // Index of the share, 0 for the caller
+} AuctionWorker;
+
+/**
+ * @struct Auction
+ * @brief Values, prices and assignment of an auction. Rows are the persons
+ *        and columns the objects of the auction; rows past `rows` are the
+ *        zero rows that make the problem square.
+ */
+struct Auction {
+  int size;                // Number of rows and columns of the problem
+  int rows;                // Number of rows with values
+  const double* benefits;  // Values times `scale`, row `i` at `i * size`
+  double scale;            // Factor of the values in `benefits`
+  int exact;               // Whether epsilon stays an integer, down to 1
+  double finalEpsilon;     // Bid increment of the last phase
+  double relativeGap;      // Relative gap that ends the phases, or 0
+  double upperBound;       // Bound on the optimum at the last prices
+  double epsilon;          // Bid increment of the current phase
+  double* prices;          // Price of each column
+  int* rowToCol;           // Column held by each row, or -1
+  int* colToRow;           // Row holding each column, or -1
+  int* freeRows;           // Rows without a column
+  int freeCount;           // Number of entries in `freeRows`
+  int* bidCols;            // Column of the bid of each entry of `freeRows`
+  double* bidPrices;       // Price offered by each entry of `freeRows`
+  double* bestBids;        // Highest price offered for each column
+  int* bestBidders;        // Row of the highest bid of each column, or -1
+  int* paddingRows;        // Zero rows without a column, in Jacobi mode
+  AuctionStats stats;      // Work done so far
+
+  // Threads of Jacobi rounds
+  int threadCount;         // Number of threads, counting the caller
+  ThreadHandle* threads;   // The workers; entry 0 is unused
+  AuctionWorker* workers;  // Argument of each thread
+  int shareCount;          // Number of shares of the current round
+  int stop;                // Whether the workers must return
+  StepBarrier barrier;     // Rounds published and shares computed
+};
+
+/**
+ * @brief Computes the bid of a row: its most profitable column at the
+ *        current prices, and the price that leaves the column epsilon more
+ *        profitable than the second best one.
+ * @param auction - The auction.
+ * @param row     - The row.
+ * @param col     - Pointer to store the column.
+ * @param price   - Pointer to store the price.
+ */
+static void ComputeBid(const Auction* auction, int row, int* col,
+                       double* price) {
+  const double* prices = auction->prices;
+  double best = -HUGE_VAL;
+  double second = -HUGE_VAL;
+  int bestCol = 0;
+
+  if (row < auction->rows) {
+    const double* benefits = auction->benefits + (size_t)row * auction->size;
+    for (int j = 0; j < auction->size; j++) {
+      double profit = benefits[j] - prices[j];
+      if (profit > best) {
+        second = best;
+        best = profit;
+        bestCol = j;
+      } else if (profit > second) {
+        second = profit;
+      }
+    }
+  } else {
+    for (int j = 0; j < auction->size; j++) {
+      double profit = -prices[j];
+      if (profit > best) {
+        second = best;
+        best = profit;
+        bestCol = j;
+      } else if (profit > second) {
+        second = profit;
+      }
+    }
+  }
+
+  // A single column has no competitor
+  if (auction->size == 1) {
+    second = best;
+  }
+  *col = bestCol;
+  *price = prices[bestCol] + (best - second) + auction->epsilon;
+}
+
+/**
+ * @brief Gives a column to a row at a price, freeing its previous holder.
+ * @param auction - The auction.
+ * @param row     - The row.
+ * @param col     - The column.
+ * @param price   - The new price of the column.
+ * @retval The previous holder of the column, or -1.
+ */
+static int AwardColumn(Auction* auction, int row, int col, double price) {
+  int previous = auction->colToRow[col];
+  if (previous >= 0) {
+    auction->rowToCol[previous] = -1;
+  }
+  auction->prices[col] = price;
+  auction->colToRow[col] = row;
+  auction->rowToCol[row] = col;
+  return previous;
+}
+
+/**
+ * @brief Runs a phase in Gauss-Seidel mode: the last free row bids and the
+ *        row it outbids becomes free, until every row holds a column.
+ * @param auction - The auction.
+ */
+static void RunGaussSeidelPhase(Auction* auction) {
+  while (auction->freeCount > 0) {
+    int row = auction->freeRows[--auction->freeCount];
+    int col;
+    double price;
+    ComputeBid(auction, row, &col, &price);
+
+    int previous = AwardColumn(auction, row, col, price);
+    if (previous >= 0) {
+      auction->freeRows[auction->freeCount++] = previous;
+    }
+    auction->stats.rounds++;
+    auction->stats.bids++;
+  }
+}
+
+/**
+ * @brief Computes the bids of one share of the free rows.
+ * @param auction - The auction.
+ * @param share   - Index of the share.
+ */
+static void ComputeShare(Auction* auction, int share) {
+  int first = (int)((long long)auction->freeCount * share /
+                    auction->shareCount);
+  int end = (int)((long long)auction->freeCount * (share + 1) /
+                  auction->shareCount);
+  for (int k = first; k < end; k++) {
+    ComputeBid(auction, auction->freeRows[k], &auction->bidCols[k],
+               &auction->bidPrices[k]);
+  }
+}
+
+/**
+ * @brief Loop of a worker: waits for each round and computes its share.
+ * @param argument - The `AuctionWorker`.
+ */
+static void RunWorker(void* argument) {
+  AuctionWorker* worker = argument;
+  Auction* auction = worker->auction;
+  long seen = 0;
+
+  while (1) {
+    seen = WaitForStep(&auction->barrier, seen);
+    if (auction->stop) {
+      return;
+    }
+
+    if (worker->index < auction->shareCount) {
+      ComputeShare(auction, worker->index);
+    }
+    FinishStep(&auction->barrier);
+  }
+}
+
+/**
+ * @brief Computes the bids of every free row, with the workers when each
+ *        of them gets at least `PARALLEL_SOLVE_MIN_COLUMNS` cells to scan.
+ * @param auction - The auction.
+ */
+static void ComputeBids(Auction* auction) {
+  long long cells = (long long)auction->freeCount * auction->size;
+  long long shares = cells / PARALLEL_SOLVE_MIN_COLUMNS;
+  if (auction->threadCount < 2 || shares < 2) {
+    auction->shareCount = 1;
+    ComputeShare(auction, 0);
+    return;
+  }
+
+  // Every worker counts the round as finished, with or without a share
+  auction->shareCount =
+      shares < auction->threadCount ? (int)shares : auction->threadCount;
+  PublishStep(&auction->barrier);
+
+  ComputeShare(auction, 0);
+  WaitForWorkers(&auction->barrier, auction->threadCount - 1);
+}
+
+/**
+ * @brief Lets the free zero rows bid one at a time, leaving only rows with
+ *        values in `freeRows`. Zero rows are all alike, so in a Jacobi round
+ *        they would all bid for the same column and all but one would lose.
+ * @param auction - The auction.
+ */
+static void RunPaddingBids(Auction* auction) {
+  int count = 0;
+  int paddingCount = 0;
+  for (int k = 0; k < auction->freeCount; k++) {
+    int row = auction->freeRows[k];
+    if (row < auction->rows) {
+      auction->freeRows[count++] = row;
+    } else {
+      auction->paddingRows[paddingCount++] = row;
+    }
+  }
+
+  while (paddingCount > 0) {
+    int row = auction->paddingRows[--paddingCount];
+    int col;
+    double price;
+    ComputeBid(auction, row, &col, &price);
+
+    int previous = AwardColumn(auction, row, col, price);
+    if (previous >= auction->rows) {
+      auction->paddingRows[paddingCount++] = previous;
+    } else if (previous >= 0) {
+      auction->freeRows[count++] = previous;
+    }
+    auction->stats.bids++;
+  }
+  auction->freeCount = count;
+}
+
+/**
+ * @brief Runs a phase in Jacobi mode: every free row bids, each column goes
+ *        to its highest bid, the first one on ties, and the losers and the
+ *        rows outbid bid again in the next round.
+ * @param auction - The auction.
+ */
+static void RunJacobiPhase(Auction* auction) {
+  while (auction->freeCount > 0) {
+    RunPaddingBids(auction);
+    if (auction->freeCount == 0) {
+      break;
+    }
+    ComputeBids(auction);
+
+    for (int k = 0; k < auction->freeCount; k++) {
+      int col = auction->bidCols[k];
+      if (auction->bestBidders[col] < 0 ||
+          auction->bidPrices[k] > auction->bestBids[col]) {
+        auction->bestBids[col] = auction->bidPrices[k];
+        auction->bestBidders[col] = auction->freeRows[k];
+      }
+    }
+
+    // Rows still free are written over entries already read, since each
+    // entry adds at most one row to the list
+    int newCount = 0;
+    for (int k = 0; k < auction->freeCount; k++) {
+      int row = auction->freeRows[k];
+      int col = auction->bidCols[k];
+      if (auction->bestBidders[col] != row) {
+        auction->freeRows[newCount++] = row;
+        continue;
+      }
+      int previous = AwardColumn(auction, row, col, auction->bestBids[col]);
+      if (previous >= 0) {
+        auction->freeRows[newCount++] = previous;
+      }
+      auction->bestBidders[col] = -1;
+    }
+
+    auction->stats.rounds++;
+    auction->stats.bids += auction->freeCount;
+    auction->freeCount = newCount;
+  }
+}
+
+/**
+ * @brief  Divides the epsilon of a phase for the next one. In exact mode it
+ *         stays an integer.
+ * @param  auction - The auction.
+ * @param  epsilon - The epsilon of the phase.
+ * @retval The epsilon of the next phase, at least `finalEpsilon`.
+ */
+static double NextEpsilon(const Auction* auction, double epsilon) {
+  epsilon /= AUCTION_EPSILON_SCALING;
+  if (auction->exact) {
+    epsilon = floor(epsilon);
+  }
+  return fmax(auction->finalEpsilon, epsilon);
+}
+
+/**
+ * @brief  Computes the upper bound that the prices give on the optimum:
+ *         each row earns at most its best profit at those prices, and the
+ *         columns add their prices. At the end of a phase the assignment is
+ *         within n epsilon of it.
+ * @param  auction - The auction, with every row holding a column.
+ * @param  primal  - Pointer to store the total of the assignment.
+ * @retval The upper bound, in the units of `benefits`.
+ */
+static double ComputeAuctionBound(const Auction* auction, double* primal) {
+  double total = 0.0;
+  double bound = 0.0;
+  double lowestPrice = HUGE_VAL;
+  for (int j = 0; j < auction->size; j++) {
+    bound += auction->prices[j];
+    lowestPrice = fmin(lowestPrice, auction->prices[j]);
+  }
+
+  for (int i = 0; i < auction->rows; i++) {
+    const double* benefits = auction->benefits + (size_t)i * auction->size;
+    double best = -HUGE_VAL;
+    for (int j = 0; j < auction->size; j++) {
+      double profit = benefits[j] - auction->prices[j];
+      best = profit > best ? profit : best;
+    }
+    bound += best;
+    total += benefits[auction->rowToCol[i]];
+  }
+
+  // The zero rows earn minus the lowest price
+  bound -= (auction->size - auction->rows) * lowestPrice;
+  *primal = total;
+  return bound;
+}
+
+/**
+ * @brief  Checks whether an approximate auction may stop after a phase: the
+ *         assignment is within n times the final epsilon of the bound, or
+ *         within the relative gap. Also keeps the bound.
+ * @param  auction - The auction, at the end of a phase.
+ * @retval 1 if the auction may stop, 0 otherwise.
+ */
+static int IsWithinTolerance(Auction* auction) {
+  double primal;
+  auction->upperBound = ComputeAuctionBound(auction, &primal);
+  double gap = auction->upperBound - primal;
+  double scale = fmax(1.0, fabs(auction->upperBound));
+  return gap <= auction->size * auction->finalEpsilon ||
+         gap <= auction->relativeGap * scale;
+}
+
+/**
+ * @brief Runs every epsilon scaling phase. Each phase starts with every row
+ *        free and the prices of the previous one; the last one has
+ *        epsilon = `finalEpsilon`. An approximate auction also stops after
+ *        any phase that is already within its tolerance.
+ * @param auction - The auction.
+ * @param mode    - Order of the bids.
+ */
+static void RunAuction(Auction* auction, AuctionMode mode) {
+  double lowest = auction->rows < auction->size ? 0.0 : HUGE_VAL;
+  double highest = auction->rows < auction->size ? 0.0 : -HUGE_VAL;
+  size_t count = (size_t)auction->rows * auction->size;
+  for (size_t k = 0; k < count; k++) {
+    lowest = fmin(lowest, auction->benefits[k]);
+    highest = fmax(highest, auction->benefits[k]);
+  }
+
+  auction->epsilon = NextEpsilon(auction, highest - lowest);
+  while (1) {
+    for (int j = 0; j < auction->size; j++) {
+      auction->colToRow[j] = -1;
+      auction->bestBidders[j] = -1;
+    }
+    // Gauss-Seidel takes the rows from the end of the list
+    for (int i = 0; i < auction->size; i++) {
+      auction->rowToCol[i] = -1;
+      auction->freeRows[i] = auction->size - 1 - i;
+    }
+    auction->freeCount = auction->size;
+
+    if (mode == AUCTION_JACOBI) {
+      RunJacobiPhase(auction);
+    } else {
+      RunGaussSeidelPhase(auction);
+    }
+    auction->stats.phases++;
+
+    if (!auction->exact && IsWithinTolerance(auction)) {
+      break;
+    }
+    if (auction->epsilon <= auction->finalEpsilon) {
+      break;
+    }
+    auction->epsilon = NextEpsilon(auction, auction->epsilon);
+  }
+}
+
+/**
+ * @brief Stops the workers that were started and waits for them.
+ * @param auction - The auction.
+ * @param started - Number of threads running, counting the caller.
+ */
+static void StopWorkers(Auction* auction, int started) {
+  auction->stop = 1;
+  PublishStep(&auction->barrier);
+  for (int t = 1; t < started; t++) {
+    JoinThread(auction->threads[t]);
+  }
+}
+
+/**
+ * @brief  Starts the workers of Jacobi rounds, at most one per processor.
+ *         When a thread cannot be started, the rounds stay serial.
+ * @param  auction     - The auction.
+ * @param  threadCount - Number of threads wanted, counting the caller, or 0
+ *                       for one per processor.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int StartWorkers(Auction* auction, int threadCount) {
+  auction->threadCount = 1;
+  if (threadCount <= 0 || threadCount > GetProcessorCount()) {
+    threadCount = GetProcessorCount();
+  }
+  if (threadCount < 2) {
+    return SUCCESS;
+  }
+
+  auction->threads = malloc((size_t)threadCount * sizeof(ThreadHandle));
+  auction->workers = malloc((size_t)threadCount * sizeof(AuctionWorker));
+  if (auction->threads == NULL || auction->workers == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  for (int t = 0; t < threadCount; t++) {
+    auction->workers[t].auction = auction;
+    auction->workers[t].index = t;
+  }
+  for (int t = 1; t < threadCount; t++) {
+    if (StartThread(&auction->threads[t], RunWorker, &auction->workers[t]) !=
+        SUCCESS) {
+      StopWorkers(auction, t);
+      return SUCCESS;
+    }
+  }
+
+  auction->threadCount = threadCount;
+  return SUCCESS;
+}
+
+/**
+ * @brief Stops the workers of an auction and frees its arrays.
+ * @param auction - The auction.
+ */
+static void FreeAuction(Auction* auction) {
+  if (auction->threadCount > 1) {
+    StopWorkers(auction, auction->threadCount);
+  }
+  free(auction->threads);
+  free(auction->workers);
+  free(auction->prices);
+  free(auction->rowToCol);
+  free(auction->colToRow);
+  free(auction->freeRows);
+  free(auction->bidCols);
+  free(auction->bidPrices);
+  free(auction->bestBids);
+  free(auction->bestBidders);
+  free(auction->paddingRows);
+}
+
+/**
+ * @brief  Allocates the arrays of an auction, with every price at zero.
+ * @param  auction - The auction, with its size set.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int AllocateAuction(Auction* auction) {
+  size_t size = (size_t)auction->size;
+  auction->prices = calloc(size, sizeof(double));
+  auction->rowToCol = malloc(size * sizeof(int));
+  auction->colToRow = malloc(size * sizeof(int));
+  auction->freeRows = malloc(size * sizeof(int));
+  auction->bidCols = malloc(size * sizeof(int));
+  auction->bidPrices = malloc(size * sizeof(double));
+  auction->bestBids = malloc(size * sizeof(double));
+  auction->bestBidders = malloc(size * sizeof(int));
+  auction->paddingRows = malloc(size * sizeof(int));
+  if (auction->prices == NULL || auction->rowToCol == NULL ||
+      auction->colToRow == NULL || auction->freeRows == NULL ||
+      auction->bidCols == NULL || auction->bidPrices == NULL ||
+      auction->bestBids == NULL || auction->bestBidders == NULL ||
+      auction->paddingRows == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  return SUCCESS;
+}
+
+/**
+ * @brief  Creates the values of an auction: the values of the matrix
+ *         multiplied by n + 1, row by row, transposed if the matrix has more
+ *         rows than columns.
+ * @param  matrix   - Pointer to the input matrix.
+ * @param  size     - The larger dimension of the matrix.
+ * @param  benefits - Pointer to store the values.
+ * @retval `INVALID_MATRIX_OR_INDICES` - An element is outside the matrix.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int CreateBenefits(const Matrix* matrix, int size, double** benefits) {
+  int transposed = matrix->height > matrix->width;
+  double* values =
+      calloc((size_t)matrix->width * matrix->height, sizeof(double));
+  if (values == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  // Position of a cell in `values`: row * rowStride + col * colStride
+  size_t rowStride = transposed ? 1 : (size_t)size;
+  size_t colStride = transposed ? (size_t)size : 1;
+  double scale = (double)size + 1.0;
+  int row = 0;
+  for (MatrixRowNode* rowNode = matrix->head; rowNode != NULL;
+       rowNode = rowNode->nextRow, row++) {
+    if (row >= matrix->height) {
+      free(values);
+      return INVALID_MATRIX_OR_INDICES;
+    }
+    for (MatrixElement* element = rowNode->row; element != NULL;
+         element = element->nextCol) {
+      if (element->column < 0 || element->column >= matrix->width) {
+        free(values);
+        return INVALID_MATRIX_OR_INDICES;
+      }
+      values[row * rowStride + element->column * colStride] =
+          element->value * scale;
+    }
+  }
+
+  *benefits = values;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Gets the values of a dense matrix for an auction, row by row,
+ *         transposed if the matrix has more rows than columns. The values
+ *         of a float64 matrix that is not transposed are used in place.
+ * @param  matrix   - Pointer to the input matrix.
+ * @param  size     - The larger dimension of the matrix.
+ * @param  benefits - Pointer to store the values.
+ * @param  copy     - Pointer to store the copy to free, or NULL when the
+ *                    values are used in place.
+ * @retval `INVALID_MATRIX_OR_INDICES` - A value is not finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int CreateDenseBenefits(const DenseMatrix* matrix, int size,
+                               const double** benefits, double** copy) {
+  int transposed = matrix->height > matrix->width;
+  size_t count = (size_t)matrix->width * matrix->height;
+  if (matrix->type == DENSE_FLOAT64) {
+    const double* values = matrix->data;
+    for (size_t k = 0; k < count; k++) {
+      if (!isfinite(values[k])) {
+        return INVALID_MATRIX_OR_INDICES;
+      }
+    }
+    if (!transposed) {
+      *benefits = values;
+      *copy = NULL;
+      return SUCCESS;
+    }
+  }
+
+  double* values = malloc(count * sizeof(double));
+  if (values == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  // Position of a cell in `values`: row * rowStride + col * colStride
+  size_t rowStride = transposed ? 1 : (size_t)size;
+  size_t colStride = transposed ? (size_t)size : 1;
+  for (int row = 0; row < matrix->height; row++) {
+    for (int col = 0; col < matrix->width; col++) {
+      size_t k = (size_t)row * matrix->width + col;
+      double value;
+      switch (matrix->type) {
+        case DENSE_INT32:
+          value = ((const int*)matrix->data)[k];
+          break;
+        case DENSE_INT64:
+          value = (double)((const long long*)matrix->data)[k];
+          break;
+        default:
+          value = ((const double*)matrix->data)[k];
+          break;
+      }
+      values[row * rowStride + col * colStride] = value;
+    }
+  }
+
+  *benefits = values;
+  *copy = values;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Creates the result of an auction, in the row order of the
+ *         original matrix.
+ * @param  width   - Number of columns of the original matrix.
+ * @param  height  - Number of rows of the original matrix.
+ * @param  auction - The finished auction.
+ * @param  result  - Pointer to store the chosen elements.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int ExtractAuctionResult(int width, int height, const Auction* auction,
+                                AssignmentResult** result) {
+  AssignmentResult* selection = NULL;
+  if (CreateAssignmentResult(auction->rows, &selection) != SUCCESS) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  int transposed = height > width;
+  double scale = auction->scale;
+  int status = SUCCESS;
+  for (int row = 0; row < height && status == SUCCESS; row++) {
+    int auctionRow = transposed ? auction->colToRow[row] : row;
+    if (auctionRow < 0 || auctionRow >= auction->rows) {
+      continue;
+    }
+    int auctionCol = transposed ? row : auction->rowToCol[row];
+    double value =
+        auction->benefits[(size_t)auctionRow * auction->size + auctionCol] /
+        scale;
+    status = AddAssignment(selection, row, transposed ? auctionRow : auctionCol,
+                           value);
+  }
+
+  if (status != SUCCESS) {
+    FreeAssignmentResult(selection);
+    return status;
+  }
+
+  *result = selection;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Solves the problem with the auction algorithm, keeping the row and
+ *         column of each chosen element.
+ * @param  matrix      - Pointer to the input matrix.
+ * @param  mode        - Order of the bids.
+ * @param  threadCount - Number of threads of Jacobi mode, or 0 for one per
+ *                       processor.
+ * @param  result      - Pointer to store the chosen elements.
+ * @param  stats       - Pointer to store the work done, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int AuctionAssignment(Matrix* matrix, AuctionMode mode, int threadCount,
+                      AssignmentResult** result, AuctionStats* stats) {
+  if (matrix == NULL || result == NULL || matrix->width <= 0 ||
+      matrix->height <= 0) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  Auction auction = {0};
+  auction.size =
+      matrix->height > matrix->width ? matrix->height : matrix->width;
+  auction.rows =
+      matrix->height > matrix->width ? matrix->width : matrix->height;
+  auction.scale = (double)auction.size + 1.0;
+  auction.exact = 1;
+  auction.finalEpsilon = 1.0;
+  double* benefits = NULL;
+  int status = CreateBenefits(matrix, auction.size, &benefits);
+  if (status != SUCCESS) {
+    return status;
+  }
+  auction.benefits = benefits;
+
+  status = AllocateAuction(&auction);
+  if (status == SUCCESS && mode == AUCTION_JACOBI) {
+    status = StartWorkers(&auction, threadCount);
+  }
+  if (status == SUCCESS) {
+    RunAuction(&auction, mode);
+    status = ExtractAuctionResult(matrix->width, matrix->height, &auction,
+                                  result);
+  }
+  if (status == SUCCESS && stats != NULL) {
+    *stats = auction.stats;
+  }
+
+  FreeAuction(&auction);
+  free(benefits);
+  return status;
+}
+
+/**
+ * @brief  Solves a dense matrix approximately with the auction algorithm,
+ *         keeping the row and column of each chosen element.
+ * @param  matrix      - Pointer to the input matrix.
+ * @param  epsilon     - Bid increment of the last phase; the total is
+ *                       within n epsilon of the optimum.
+ * @param  relativeGap - Relative gap that also ends the auction, or 0.
+ * @param  mode        - Order of the bids.
+ * @param  threadCount - Number of threads of Jacobi mode, or 0 for one per
+ *                       processor.
+ * @param  result      - Pointer to store the chosen elements.
+ * @param  gap         - Pointer to store the gap of the result, or NULL.
+ * @param  stats       - Pointer to store the work done, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix or the tolerances are
+ *                                       invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int AuctionAssignmentDense(const DenseMatrix* matrix, double epsilon,
+                           double relativeGap, AuctionMode mode,
+                           int threadCount, AssignmentResult** result,
+                           AssignmentGap* gap, AuctionStats* stats) {
+  if (matrix == NULL || result == NULL || matrix->width <= 0 ||
+      matrix->height <= 0 || !(epsilon > 0.0) || !isfinite(epsilon) ||
+      !(relativeGap >= 0.0)) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  Auction auction = {0};
+  auction.size =
+      matrix->height > matrix->width ? matrix->height : matrix->width;
+  auction.rows =
+      matrix->height > matrix->width ? matrix->width : matrix->height;
+  auction.scale = 1.0;
+  auction.finalEpsilon = epsilon;
+  auction.relativeGap = relativeGap;
+  double* copy = NULL;
+  int status =
+      CreateDenseBenefits(matrix, auction.size, &auction.benefits, &copy);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  status = AllocateAuction(&auction);
+  if (status == SUCCESS && mode == AUCTION_JACOBI) {
+    status = StartWorkers(&auction, threadCount);
+  }
+  if (status == SUCCESS) {
+    RunAuction(&auction, mode);
+    status = ExtractAuctionResult(matrix->width, matrix->height, &auction,
+                                  result);
+  }
+  if (status == SUCCESS) {
+    SetAssignmentGap(gap, auction.upperBound, *result);
+    if (stats != NULL) {
+      *stats = auction.stats;
+    }
+  }
+
+  FreeAuction(&auction);
+  free(copy);
+  return status;
+}
@@ -0,0 +1,107 @@
+/**
+ *  @file      auction.h
+ *  @brief     Header file for the auction algorithm.
+ *  @details   This header file contains function declarations and data
+ *             structures related to the auction algorithm of Bertsekas. Each
+ *             unassigned row bids for its most profitable column, raising
+ *             the price of the column by the margin over its second best
+ *             choice plus epsilon, until every row holds a column. The
+ *             values are multiplied by n + 1, so the final phase with
+ *             epsilon = 1 gives an optimal assignment of integer values; the
+ *             earlier phases (epsilon scaling) start from a large epsilon and
+ *             divide it by `AUCTION_EPSILON_SCALING`, keeping the prices
+ *             between phases.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef AUCTION_H
+#define AUCTION_H
+
+#include "assignment.h"
+#include "matrix_core.h"
+#include "matrix_dense.h"
+
+/**
+ * @enum AuctionMode
+ * @brief Order in which the unassigned rows bid.
+ */
+typedef enum AuctionMode {
+  AUCTION_GAUSS_SEIDEL,  // One row bids at a time, seeing the latest prices
+  AUCTION_JACOBI         // Every unassigned row bids at once in each round
+} AuctionMode;
+
+/**
+ * @struct AuctionStats
+ * @brief Work done by an auction.
+ */
+typedef struct AuctionStats {
+  int phases;        // Number of epsilon scaling phases
+  long long rounds;  // Bidding rounds; a single bid in Gauss-Seidel mode
+  long long bids;    // Number of bids
+} AuctionStats;
+
+/**
+ * @brief  Solves the problem with the auction algorithm, keeping the row and
+ *         column of each chosen element. Every row of a wide matrix and every
+ *         column of a tall one is assigned, as `HungarianAssignment` does,
+ *         and the total is the same optimal one.
+ * @details A tall matrix is solved by columns. A wide matrix gets zero rows
+ *          until it is square, so each extra row takes one of the columns
+ *          left over; those rows bid one at a time in both modes, since they
+ *          would all bid for the same column. In Jacobi mode the bids of
+ *          each round are computed by several threads once every thread has
+ *          at least `PARALLEL_SOLVE_MIN_COLUMNS` cells to scan; Gauss-Seidel
+ *          mode is always serial, since each bid depends on the previous
+ *          one.
+ * @param  matrix      - Pointer to the input matrix.
+ * @param  mode        - Order of the bids.
+ * @param  threadCount - Number of threads of Jacobi mode, or 0 for one per
+ *                       processor.
+ * @param  result      - Pointer to store the chosen elements; free it with
+ *                       `FreeAssignmentResult`.
+ * @param  stats       - Pointer to store the work done, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int AuctionAssignment(Matrix* matrix, AuctionMode mode,
+                                            int threadCount,
+                                            AssignmentResult** result,
+                                            AuctionStats* stats);
+
+/**
+ * @brief  Solves a dense matrix approximately with the auction algorithm,
+ *         for floating-point values where the exact optimum is not needed.
+ *         The values are not scaled, and the phases end at the final
+ *         epsilon given, so the total is within n epsilon of the optimum
+ *         for n the larger dimension.
+ * @details Ties and tiny differences between values make an exact solve do
+ *          most of its work for a negligible gain; a coarse final epsilon
+ *          skips it. After each phase the prices give an upper bound on the
+ *          optimum, and the auction also stops early once the assignment is
+ *          within n epsilon of that bound, or within `relativeGap` of it.
+ *          The bound and the relative gap are stored in `gap`. A float64
+ *          matrix with no more rows than columns is read in place; other
+ *          matrices are copied as doubles.
+ * @param  matrix      - Pointer to the input matrix.
+ * @param  epsilon     - Bid increment of the last phase, greater than 0.
+ * @param  relativeGap - Relative gap that also ends the auction, or 0.
+ * @param  mode        - Order of the bids.
+ * @param  threadCount - Number of threads of Jacobi mode, or 0 for one per
+ *                       processor.
+ * @param  result      - Pointer to store the chosen elements; free it with
+ *                       `FreeAssignmentResult`.
+ * @param  gap         - Pointer to store the gap of the result, or NULL.
+ * @param  stats       - Pointer to store the work done, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix or the tolerances are
+ *                                       invalid, or a value is not finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int AuctionAssignmentDense(
+    const DenseMatrix* matrix, double epsilon, double relativeGap,
+    AuctionMode mode, int threadCount, AssignmentResult** result,
+    AssignmentGap* gap, AuctionStats* stats);
+
+#endif  // !AUCTION_H
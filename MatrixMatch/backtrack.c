@@ -12,48 +12,64 @@
  */
 #include "backtrack.h"
 
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "assignment.h"
+#include "constants.h"
 #include "error_codes.h"
 #include "matrix_core.h"
+#include "platform.h"
+#include "solver_workspace.h"
 
 /**
- * @brief Copy the selected elements to the array.
+ * @brief Keep the current selection as the best one.
  * @param params - Parameters of type `ExploreParams`.
  */
-static void CopySelectedValues(ExploreParams* params) {
+static void KeepSelection(ExploreParams* params) {
   *(params->selectionCount) = 0;
 
-  for (int i = 0; i < params->matrix->height; i++) {
+  // `usedColumns[i]` holds the row (plus one) that selected column `i`
+  for (int i = 0; i < params->matrix->width; i++) {
+    params->bestColumns[i] = params->usedColumns[i];
     if (params->usedColumns[i]) {
-      int colIndex = params->usedColumns[i] - 1;
-
-      MatrixRowNode* currentRowNode = GetRowNode(params->matrix, i);
-
-      const MatrixElement* currentElement =
-          GetElementCol(currentRowNode, colIndex);
-
-      // Copy values to array
-      params->selectionValues[*(params->selectionCount)].row = i;
-      params->selectionValues[*(params->selectionCount)].col = colIndex;
-      params->selectionValues[*(params->selectionCount)].value =
-          currentElement->value;
-
       (*(params->selectionCount))++;
     }
   }
 }
 
 /**
- * @brief Recursively explore the possible combinations.
+ * @brief Recursively explore the possible combinations. Each row takes an
+ *        element of a free column or, while more rows than columns remain,
+ *        may be skipped.
  * @param params - Parameters of type `ExploreParams`.
  */
 static void Explore(ExploreParams* params) {
+  ExploreBudget* budget = params->budget;
+  if (budget->stopped) {
+    return;
+  }
+
+  // The search only stops once a complete selection was kept
+  budget->nodeCount++;
+  if (*(params->selectionCount) > 0 &&
+      ((budget->nodeLimit > 0 && budget->nodeCount > budget->nodeLimit) ||
+       (budget->deadline > 0.0 &&
+        budget->nodeCount % BACKTRACK_CLOCK_NODES == 0 &&
+        GetMonotonicTime() > budget->deadline))) {
+    budget->stopped = 1;
+    return;
+  }
+
   if (params->currentRow == params->matrix->height) {
-    if (params->currentSum > *(params->maxSum)) {
+    // The first complete selection is always kept, even if its sum is not
+    // positive
+    if (*(params->selectionCount) == 0 ||
+        params->currentSum > *(params->maxSum)) {
       *(params->maxSum) = params->currentSum;
-      CopySelectedValues(params);  // Copy selected values to array
+      KeepSelection(params);  // Copy selected columns to array
     }
     return;
   }
@@ -70,12 +86,15 @@ static void Explore(ExploreParams* params) {
       ExploreParams nextParams = {
           .matrix = params->matrix,
           .currentRow = params->currentRow + 1,
-          .currentSum = params->currentSum + currentElement->value,
+          .currentSum =
+              params->currentSum + (long long)currentElement->value,
+          .skippedRows = params->skippedRows,
           .maxSum = params->maxSum,
-          .selectionValues = params->selectionValues,
           .usedRows = params->usedRows,
           .usedColumns = params->usedColumns,
-          .selectionCount = params->selectionCount};
+          .bestColumns = params->bestColumns,
+          .selectionCount = params->selectionCount,
+          .budget = params->budget};
       Explore(&nextParams);
 
       // Backtrack: Mark element as not used
@@ -83,6 +102,117 @@ static void Explore(ExploreParams* params) {
       params->usedColumns[i] = 0;
     }
   }
+
+  // With more rows than columns, some rows are left without an element
+  if (params->skippedRows < params->matrix->height - params->matrix->width) {
+    ExploreParams nextParams = *params;
+    nextParams.currentRow = params->currentRow + 1;
+    nextParams.skippedRows = params->skippedRows + 1;
+    Explore(&nextParams);
+  }
+}
+
+/**
+ * @brief Explore every selection of a matrix from the first row.
+ * @param matrix         - The matrix.
+ * @param usedRows       - Array of `matrix->height` marks.
+ * @param usedColumns    - Array of `matrix->width` marks.
+ * @param bestColumns    - Array of `matrix->width` integers to store the row
+ *                         (plus one) chosen for each column, or 0.
+ * @param maxSum         - Pointer to store the maximum sum.
+ * @param selectionCount - Pointer to store the number of chosen elements.
+ * @param budget         - Limits of the search.
+ */
+static void ExploreMatrix(Matrix* matrix, int* usedRows, int* usedColumns,
+                          int* bestColumns, long long* maxSum,
+                          int* selectionCount, ExploreBudget* budget) {
+  memset(usedRows, 0, (size_t)matrix->height * sizeof(int));
+  memset(usedColumns, 0, (size_t)matrix->width * sizeof(int));
+  *maxSum = 0;
+  *selectionCount = 0;
+
+  ExploreParams params = {.matrix = matrix,
+                          .currentRow = 0,
+                          .currentSum = 0,
+                          .skippedRows = 0,
+                          .maxSum = maxSum,
+                          .usedRows = usedRows,
+                          .usedColumns = usedColumns,
+                          .bestColumns = bestColumns,
+                          .selectionCount = selectionCount,
+                          .budget = budget};
+  Explore(&params);  // Recursively iterate over possibilities
+}
+
+/**
+ * @brief Get the value chosen for a column.
+ * @param matrix      - The matrix.
+ * @param bestColumns - The row (plus one) chosen for each column.
+ * @param col         - The column, which has a chosen row.
+ * @retval The value of the element.
+ */
+static int GetChosenValue(Matrix* matrix, const int* bestColumns, int col) {
+  MatrixRowNode* currentRowNode = GetRowNode(matrix, bestColumns[col] - 1);
+  return GetElementCol(currentRowNode, col)->value;
+}
+
+/**
+ * @brief  Add the chosen elements to a result, by column.
+ * @param  matrix      - The matrix.
+ * @param  bestColumns - The row (plus one) chosen for each column, or 0.
+ * @param  result      - The result.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int AddChosenElements(Matrix* matrix, const int* bestColumns,
+                             AssignmentResult* result) {
+  int status = SUCCESS;
+  for (int i = 0; i < matrix->width && status == SUCCESS; i++) {
+    if (bestColumns[i]) {
+      status = AddAssignment(result, bestColumns[i] - 1, i,
+                             GetChosenValue(matrix, bestColumns, i));
+    }
+  }
+  return status;
+}
+
+/**
+ * @brief  Compute an upper bound on the sum of every selection. Each row of
+ *         a matrix with no more rows than columns gives an element, at most
+ *         the largest of its row; otherwise, each column does.
+ * @param  matrix    - The matrix.
+ * @param  columnMax - Array of `matrix->width` integers, overwritten.
+ * @retval The upper bound.
+ */
+static double GetSelectionBound(Matrix* matrix, int* columnMax) {
+  for (int i = 0; i < matrix->width; i++) {
+    columnMax[i] = INT_MIN;
+  }
+
+  double rowBound = 0.0;
+  for (MatrixRowNode* currentRow = matrix->head; currentRow != NULL;
+       currentRow = currentRow->nextRow) {
+    int rowMax = INT_MIN;
+    for (MatrixElement* element = currentRow->row; element != NULL;
+         element = element->nextCol) {
+      if (element->value > rowMax) {
+        rowMax = element->value;
+      }
+      if (element->value > columnMax[element->column]) {
+        columnMax[element->column] = element->value;
+      }
+    }
+    rowBound += rowMax;
+  }
+  if (matrix->height <= matrix->width) {
+    return rowBound;
+  }
+
+  double columnBound = 0.0;
+  for (int i = 0; i < matrix->width; i++) {
+    columnBound += columnMax[i];
+  }
+  return columnBound;
 }
 
 /**
@@ -90,7 +220,8 @@ static void Explore(ExploreParams* params) {
  * sum of integers from a matrix of integers with any dimensions, so that none
  *        of the selected integers share the same row or column.
  * @param matrix                        - The matrix.
- * @param maxSum                        - Maximum total sum possible.
+ * @param maxSum                        - Maximum total sum possible, limited
+ * to the range of `int`.
  * @param selectionCount                - Number of elements chosen for the
  * result.
  * @param maxSelection                  - Array containing the chosen values.
@@ -107,36 +238,181 @@ int BacktrackAlgorithm(Matrix* matrix, int* maxSum, int* selectionCount,
     return INVALID_MATRIX_OR_INDICES;
   }
 
-  *maxSum = 0;                                            // Total sum
-  int* usedRows = calloc(matrix->height, sizeof(int));    // Rows used
-  int* usedColumns = calloc(matrix->width, sizeof(int));  // Columns used
-  if (!usedRows || !usedColumns) {
+  int* usedRows = malloc(matrix->height * sizeof(int));    // Rows used
+  int* usedColumns = malloc(matrix->width * sizeof(int));  // Columns used
+  int* bestColumns = malloc(matrix->width * sizeof(int));  // Best columns
+  int maxPossibleSelections =
+      matrix->height < matrix->width ? matrix->height : matrix->width;
+  *selectionValues = malloc(maxPossibleSelections * sizeof(SelectedElement));
+  if (!usedRows || !usedColumns || !bestColumns || !*selectionValues) {
     free(usedRows);
     free(usedColumns);
+    free(bestColumns);
+    free(*selectionValues);
+    *selectionValues = NULL;
     return MEMORY_ALLOCATION_FAILURE;
   }
 
-  *selectionCount = 0;  // Number of chosen elements
-  int maxPossibleSelections = matrix->height * matrix->width;
-  *selectionValues = malloc(maxPossibleSelections * sizeof(SelectedElement));
-  if (!*selectionValues) {
+  ExploreBudget budget = {0.0, 0, 0, 0};
+  long long bestSum = 0;
+  ExploreMatrix(matrix, usedRows, usedColumns, bestColumns, &bestSum,
+                selectionCount, &budget);
+  *maxSum = bestSum > INT_MAX   ? INT_MAX
+            : bestSum < INT_MIN ? INT_MIN
+                                : (int)bestSum;
+
+  // Copy the chosen elements to the array
+  int count = 0;
+  for (int i = 0; i < matrix->width; i++) {
+    if (bestColumns[i]) {
+      (*selectionValues)[count].row = bestColumns[i] - 1;
+      (*selectionValues)[count].col = i;
+      (*selectionValues)[count].value =
+          GetChosenValue(matrix, bestColumns, i);
+      count++;
+    }
+  }
+
+  free(usedRows);
+  free(usedColumns);
+  free(bestColumns);
+
+  return SUCCESS;
+}
+
+/**
+ * @brief "Backtrack" algorithm, keeping the row and column of each chosen
+ *        element.
+ * @param matrix                        - The matrix.
+ * @param result                        - Pointer to store the chosen elements.
+ * @retval `INVALID_MATRIX_OR_INDICES`  - The matrix or the provided indices are
+ * invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE`  - Memory allocation failure.
+ * @retval `SUCCESS`                    - Operation successful.
+ */
+int BacktrackAssignment(Matrix* matrix, AssignmentResult** result) {
+  if (result == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  int maxSum = 0;
+  int selectionCount = 0;
+  SelectedElement* selectionValues = NULL;
+  int status =
+      BacktrackAlgorithm(matrix, &maxSum, &selectionCount, &selectionValues);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  AssignmentResult* selection = NULL;
+  status = CreateAssignmentResult(selectionCount, &selection);
+  for (int i = 0; i < selectionCount && status == SUCCESS; i++) {
+    status = AddAssignment(selection, selectionValues[i].row,
+                           selectionValues[i].col, selectionValues[i].value);
+  }
+  free(selectionValues);
+
+  if (status != SUCCESS) {
+    FreeAssignmentResult(selection);
+    return status;
+  }
+
+  *result = selection;
+  return SUCCESS;
+}
+
+/**
+ * @brief "Backtrack" algorithm with the memory of a workspace, see
+ *        `BacktrackAssignment`.
+ * @param matrix    - The matrix.
+ * @param workspace - The workspace, grown if the matrix does not fit.
+ * @param result    - The result; its previous elements are discarded.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int BacktrackAssignmentWithWorkspace(Matrix* matrix,
+                                     SolverWorkspace* workspace,
+                                     AssignmentResult* result) {
+  if (matrix == NULL || matrix->width <= 0 || matrix->height <= 0 ||
+      workspace == NULL || result == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  if (ReserveSolverWorkspace(workspace, matrix->width, matrix->height) !=
+      SUCCESS) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  long long maxSum = 0;
+  int selectionCount = 0;
+  ExploreBudget budget = {0.0, 0, 0, 0};
+  ExploreMatrix(matrix, workspace->usedRows, workspace->usedColumns,
+                workspace->bestColumns, &maxSum, &selectionCount, &budget);
+
+  ClearAssignmentResult(result);
+  return AddChosenElements(matrix, workspace->bestColumns, result);
+}
+
+/**
+ * @brief "Backtrack" algorithm with a time and node budget.
+ * @param matrix    - The matrix.
+ * @param timeLimit - Seconds after which the search stops, or 0 for no
+ *                    limit.
+ * @param nodeLimit - Nodes after which the search stops, or 0 for no limit.
+ * @param result    - Pointer to store the chosen elements.
+ * @param gap       - Pointer to store the gap of the result, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix or the limits are
+ *                                       invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `TIME_LIMIT_REACHED`        - The budget ran out; the result may
+ *                                       not be optimal.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int BacktrackAssignmentWithBudget(Matrix* matrix, double timeLimit,
+                                  int nodeLimit, AssignmentResult** result,
+                                  AssignmentGap* gap) {
+  if (matrix == NULL || matrix->width <= 0 || matrix->height <= 0 ||
+      timeLimit < 0.0 || nodeLimit < 0 || result == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  ExploreBudget budget = {
+      timeLimit > 0.0 ? GetMonotonicTime() + timeLimit : 0.0, nodeLimit, 0,
+      0};
+  int* usedRows = malloc(matrix->height * sizeof(int));
+  int* usedColumns = malloc(matrix->width * sizeof(int));
+  int* bestColumns = malloc(matrix->width * sizeof(int));
+  AssignmentResult* selection = NULL;
+  if (!usedRows || !usedColumns || !bestColumns ||
+      CreateAssignmentResult(
+          matrix->height < matrix->width ? matrix->height : matrix->width,
+          &selection) != SUCCESS) {
     free(usedRows);
     free(usedColumns);
+    free(bestColumns);
     return MEMORY_ALLOCATION_FAILURE;
   }
 
-  ExploreParams params = {.matrix = matrix,
-                          .currentRow = 0,
-                          .currentSum = 0,
-                          .maxSum = maxSum,
-                          .usedRows = usedRows,
-                          .usedColumns = usedColumns,
-                          .selectionCount = selectionCount,
-                          .selectionValues = *selectionValues};
-  Explore(&params);  // Recursively iterate over possibilities
+  long long maxSum = 0;
+  int selectionCount = 0;
+  ExploreMatrix(matrix, usedRows, usedColumns, bestColumns, &maxSum,
+                &selectionCount, &budget);
+  int status = AddChosenElements(matrix, bestColumns, selection);
+  if (status == SUCCESS) {
+    SetAssignmentGap(gap,
+                     budget.stopped ? GetSelectionBound(matrix, usedColumns)
+                                    : selection->totalValue,
+                     selection);
+  }
 
   free(usedRows);
   free(usedColumns);
+  free(bestColumns);
+  if (status != SUCCESS) {
+    FreeAssignmentResult(selection);
+    return status;
+  }
 
-  return SUCCESS;
+  *result = selection;
+  return budget.stopped ? TIME_LIMIT_REACHED : SUCCESS;
 }
@@ -10,7 +10,9 @@
 #ifndef BACKTRACK_H
 #define BACKTRACK_H
 
+#include "assignment.h"
 #include "matrix_core.h"
+#include "solver_workspace.h"
 
 /**
  * @struct SelectedElement
@@ -24,20 +26,34 @@ typedef struct SelectedElement {
   int value;  // Value of the element
 } SelectedElement;
 
+/**
+ * @struct ExploreBudget
+ * @brief Limits of a "Backtrack" search, shared by every level of the
+ *        recursion.
+ */
+typedef struct ExploreBudget {
+  double deadline;      // Time after which the search stops, or 0
+  int nodeLimit;        // Nodes allowed, or 0 for no limit
+  long long nodeCount;  // Nodes explored
+  int stopped;          // 1 once a limit was reached
+} ExploreBudget;
+
 /**
  * @struct ExploreParams
  * @brief Parameters passed to the recursive function of the "Backtrack"
  * algorithm.
  */
 typedef struct ExploreParams {
-  Matrix* matrix;                    // The matrix
-  int currentRow;                    // Current row
-  int currentSum;                    // Current sum
-  int* maxSum;                       // Total maximum sum
-  int* usedRows;                     // Used rows
-  int* usedColumns;                  // Used columns
-  int* selectionCount;               // Number of selected elements
-  SelectedElement* selectionValues;  // Chosen values
+  Matrix* matrix;         // The matrix
+  int currentRow;         // Current row
+  long long currentSum;   // Current sum
+  int skippedRows;        // Rows left without an element
+  long long* maxSum;      // Total maximum sum
+  int* usedRows;          // Used rows
+  int* usedColumns;       // Used columns
+  int* bestColumns;       // Row (plus one) of each best column
+  int* selectionCount;    // Number of selected elements
+  ExploreBudget* budget;  // Limits of the search
 } ExploreParams;
 
 /**
@@ -45,7 +61,8 @@ typedef struct ExploreParams {
  * sum of integers from a matrix of integers with any dimensions, so that none
  *        of the selected integers share the same row or column.
  * @param matrix                        - The matrix.
- * @param maxSum                        - Maximum total sum possible.
+ * @param maxSum                        - Maximum total sum possible, limited
+ * to the range of `int`.
  * @param selectionCount                - Number of elements chosen for the
  * result.
  * @param maxSelection                  - Array containing the chosen values.
@@ -59,4 +76,65 @@ __declspec(dllexport) int BacktrackAlgorithm(Matrix* matrix, int* maxSum,
                                              int* selectionCount,
                                              SelectedElement** maxSelection);
 
+/**
+ * @brief "Backtrack" algorithm, keeping the row and column of each chosen
+ *        element.
+ * @param matrix                        - The matrix.
+ * @param result                        - Pointer to store the chosen elements;
+ * free it with `FreeAssignmentResult`.
+ * @retval `INVALID_MATRIX_OR_INDICES`  - The matrix or the provided indices are
+ * invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE`  - Memory allocation failure.
+ * @retval `SUCCESS`                    - Operation successful.
+ */
+__declspec(dllexport) int BacktrackAssignment(Matrix* matrix,
+                                              AssignmentResult** result);
+
+/**
+ * @brief "Backtrack" algorithm with the memory of a workspace. The result is
+ *        the one of `BacktrackAssignment`, and once the workspace fits the
+ *        matrix and the result has room for the chosen elements, the solve
+ *        makes no allocation.
+ * @param matrix                        - The matrix.
+ * @param workspace                     - The workspace, from
+ * `CreateSolverWorkspace`; it is grown if the matrix does not fit.
+ * @param result                        - The result, from
+ * `CreateAssignmentResult`; its previous elements are discarded.
+ * @retval `INVALID_MATRIX_OR_INDICES`  - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE`  - Memory allocation failure.
+ * @retval `SUCCESS`                    - Operation successful.
+ */
+__declspec(dllexport) int BacktrackAssignmentWithWorkspace(
+    Matrix* matrix, SolverWorkspace* workspace, AssignmentResult* result);
+
+/**
+ * @brief "Backtrack" algorithm with a time and node budget. The search
+ *        stops once a limit is reached and a complete selection was found,
+ *        keeping the best selection so far; the gap says how far it may be
+ *        from the optimum.
+ * @details The first complete selection is reached after one node per row,
+ *          so the search always has a result to return. The upper bound of
+ *          a stopped search is the sum of the largest element of each row
+ *          (each column, for a matrix with more rows than columns).
+ * @param matrix                        - The matrix.
+ * @param timeLimit                     - Seconds after which the search
+ * stops, or 0 for no limit.
+ * @param nodeLimit                     - Nodes after which the search stops,
+ * or 0 for no limit.
+ * @param result                        - Pointer to store the chosen
+ * elements, also when the budget runs out; free it with
+ * `FreeAssignmentResult`.
+ * @param gap                           - Pointer to store the gap of the
+ * result, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES`  - The matrix or the limits are
+ * invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE`  - Memory allocation failure.
+ * @retval `TIME_LIMIT_REACHED`         - The budget ran out; the result may
+ * not be optimal.
+ * @retval `SUCCESS`                    - Operation successful.
+ */
+__declspec(dllexport) int BacktrackAssignmentWithBudget(
+    Matrix* matrix, double timeLimit, int nodeLimit,
+    AssignmentResult** result, AssignmentGap* gap);
+
 #endif  // !BACKTRACK_H
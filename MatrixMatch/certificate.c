@@ -0,0 +1,377 @@
+/**
+ *
+ *  @file      certificate.c
+ *  @brief     Implementation of the optimality certificates of assignments.
+ *  @details   This file contains the functions that check a
+ *             `HungarianSolution` against its matrix, row by row in a single
+ *             pass, and that export the reduced costs of every cell.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "certificate.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "error_codes.h"
+
+/**
+ * @struct RowReader
+ * @brief Reads the rows of a linked-list or dense matrix in order.
+ */
+typedef struct RowReader {
+  const MatrixRowNode* node;  // Next row of a linked-list matrix
+  const DenseMatrix* dense;   // The dense matrix, or NULL
+} RowReader;
+
+/**
+ * @brief  Reads the next row of a matrix as doubles. Missing elements of a
+ *         linked-list row are 0.
+ * @param  reader - The reader.
+ * @param  row    - Index of the row.
+ * @param  width  - Number of columns.
+ * @param  buffer - Array of `width` values that will hold the row.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix has fewer rows, or an
+ *                                       element outside its columns.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int ReadNextRow(RowReader* reader, int row, int width,
+                       double* buffer) {
+  if (reader->dense == NULL) {
+    if (reader->node == NULL) {
+      return INVALID_MATRIX_OR_INDICES;
+    }
+    for (int j = 0; j < width; j++) {
+      buffer[j] = 0.0;
+    }
+    for (const MatrixElement* element = reader->node->row; element != NULL;
+         element = element->nextCol) {
+      if (element->column < 0 || element->column >= width) {
+        return INVALID_MATRIX_OR_INDICES;
+      }
+      buffer[element->column] = element->value;
+    }
+    reader->node = reader->node->nextRow;
+    return SUCCESS;
+  }
+
+  size_t start = (size_t)row * width;
+  switch (reader->dense->type) {
+    case DENSE_INT32: {
+      const int* values = (const int*)reader->dense->data + start;
+      for (int j = 0; j < width; j++) {
+        buffer[j] = values[j];
+      }
+      break;
+    }
+    case DENSE_INT64: {
+      const long long* values = (const long long*)reader->dense->data + start;
+      for (int j = 0; j < width; j++) {
+        buffer[j] = (double)values[j];
+      }
+      break;
+    }
+    default: {
+      const double* values = (const double*)reader->dense->data + start;
+      for (int j = 0; j < width; j++) {
+        buffer[j] = values[j];
+      }
+      break;
+    }
+  }
+  return SUCCESS;
+}
+
+/**
+ * @brief  Checks that a dense matrix can be read.
+ * @param  matrix - The matrix.
+ * @retval 1 if the matrix is valid, 0 otherwise.
+ */
+static int IsValidDense(const DenseMatrix* matrix) {
+  return matrix->data != NULL && matrix->width > 0 && matrix->height > 0 &&
+         GetDenseTypeSize(matrix->type) > 0;
+}
+
+/**
+ * @brief  Checks that the assignment of a solution uses every row and column
+ *         at most once, and every row or column of the smaller side exactly
+ *         once.
+ * @param  solution - The solution.
+ * @retval `INVALID_ASSIGNMENT` - The assignment is inconsistent.
+ * @retval `SUCCESS`            - The assignment is valid.
+ */
+static int CheckAssignment(const HungarianSolution* solution) {
+  int width = solution->width;
+  int height = solution->height;
+  int assigned = 0;
+
+  for (int i = 0; i < height; i++) {
+    int j = solution->rowToCol[i];
+    if (j < -1 || j >= width || (j >= 0 && solution->colToRow[j] != i)) {
+      return INVALID_ASSIGNMENT;
+    }
+    assigned += j >= 0;
+  }
+  for (int j = 0; j < width; j++) {
+    int i = solution->colToRow[j];
+    if (i < -1 || i >= height || (i >= 0 && solution->rowToCol[i] != j)) {
+      return INVALID_ASSIGNMENT;
+    }
+  }
+
+  return assigned == (width < height ? width : height) ? SUCCESS
+                                                       : INVALID_ASSIGNMENT;
+}
+
+/**
+ * @brief  Checks that the unassigned rows or columns of the larger side have
+ *         the smallest potential of that side, so leaving them out cannot
+ *         improve the total.
+ * @param  solution  - The solution.
+ * @param  tolerance - Largest error accepted.
+ * @retval `UNPROVEN_OPTIMALITY` - Some unassigned potential is too large.
+ * @retval `SUCCESS`             - Operation successful.
+ */
+static int CheckUnassignedPotentials(const HungarianSolution* solution,
+                                     double tolerance) {
+  int wide = solution->width > solution->height;
+  int count = wide ? solution->width : solution->height;
+  const double* potentials =
+      wide ? solution->colPotentials : solution->rowPotentials;
+  const int* matches = wide ? solution->colToRow : solution->rowToCol;
+
+  double lowest = HUGE_VAL;
+  double highestFree = -HUGE_VAL;
+  for (int k = 0; k < count; k++) {
+    lowest = potentials[k] < lowest ? potentials[k] : lowest;
+    if (matches[k] < 0 && potentials[k] > highestFree) {
+      highestFree = potentials[k];
+    }
+  }
+
+  if (highestFree == -HUGE_VAL || highestFree - lowest <= tolerance) {
+    return SUCCESS;
+  }
+  return UNPROVEN_OPTIMALITY;
+}
+
+/**
+ * @brief  Checks a solution against the rows of a matrix in a single pass.
+ * @param  reader    - Reader of the rows of the matrix.
+ * @param  solution  - The solution, with the size of the matrix.
+ * @param  tolerance - Largest error accepted in each comparison.
+ * @retval `INVALID_MATRIX_OR_INDICES` - A row of the matrix cannot be read.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `INVALID_ASSIGNMENT`        - The assignment is inconsistent.
+ * @retval `INFEASIBLE_POTENTIALS`     - The potentials are not feasible.
+ * @retval `UNPROVEN_OPTIMALITY`       - The potentials do not prove the
+ *                                       assignment optimal.
+ * @retval `SUCCESS`                   - The solution is optimal.
+ */
+static int VerifyRows(RowReader* reader, const HungarianSolution* solution,
+                      double tolerance) {
+  int status = CheckAssignment(solution);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  int width = solution->width;
+  double* values = malloc((size_t)width * sizeof(double));
+  if (values == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  // Comparisons are written so that a NaN potential or value fails them
+  double total = 0.0;
+  int assigned = 0;
+  for (int i = 0; i < solution->height && status == SUCCESS; i++) {
+    status = ReadNextRow(reader, i, width, values);
+    if (status != SUCCESS) {
+      break;
+    }
+    double rowPotential = solution->rowPotentials[i];
+
+    for (int j = 0; j < width; j++) {
+      double slack = rowPotential + solution->colPotentials[j] - values[j];
+      if (!(slack >= -tolerance)) {
+        status = INFEASIBLE_POTENTIALS;
+        break;
+      }
+    }
+
+    int j = solution->rowToCol[i];
+    if (status == SUCCESS && j >= 0) {
+      double slack = rowPotential + solution->colPotentials[j] - values[j];
+      if (!(slack <= tolerance)) {
+        status = UNPROVEN_OPTIMALITY;
+      }
+      total += values[j];
+      assigned++;
+    }
+  }
+  free(values);
+
+  if (status != SUCCESS) {
+    return status;
+  }
+  if (!(fabs(total - solution->totalValue) <= tolerance * assigned)) {
+    return INVALID_ASSIGNMENT;
+  }
+  return CheckUnassignedPotentials(solution, tolerance);
+}
+
+/**
+ * @brief  Computes the reduced costs of a matrix row by row.
+ * @param  reader       - Reader of the rows of the matrix.
+ * @param  solution     - The solution, with the size of the matrix.
+ * @param  reducedCosts - Array that will hold the reduced costs.
+ * @retval `INVALID_MATRIX_OR_INDICES` - A row of the matrix cannot be read.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int ComputeReducedCosts(RowReader* reader,
+                               const HungarianSolution* solution,
+                               double* reducedCosts) {
+  int width = solution->width;
+  for (int i = 0; i < solution->height; i++) {
+    double* reduced = reducedCosts + (size_t)i * width;
+    if (ReadNextRow(reader, i, width, reduced) != SUCCESS) {
+      return INVALID_MATRIX_OR_INDICES;
+    }
+    for (int j = 0; j < width; j++) {
+      reduced[j] = solution->rowPotentials[i] + solution->colPotentials[j] -
+                   reduced[j];
+    }
+  }
+  return SUCCESS;
+}
+
+/**
+ * @brief  Checks that a solution is an optimal assignment of a matrix.
+ * @param  matrix    - The matrix.
+ * @param  solution  - The solution.
+ * @param  tolerance - Largest error accepted in each comparison; 0 for exact
+ *                     checks, which suits integer values.
+ * @retval `NULL_POINTER`              - No matrix or solution provided.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The solution has a different size,
+ *                                       or the matrix has fewer rows or an
+ *                                       element outside its columns.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `INVALID_ASSIGNMENT`        - A row or column is used twice, the
+ *                                       assignment is incomplete or
+ *                                       `totalValue` is wrong.
+ * @retval `INFEASIBLE_POTENTIALS`     - The potentials of some cell are below
+ *                                       its value.
+ * @retval `UNPROVEN_OPTIMALITY`       - A chosen cell is not tight, or an
+ *                                       unassigned row or column has a
+ *                                       potential above the others.
+ * @retval `SUCCESS`                   - The solution is optimal.
+ */
+int VerifyHungarianSolution(const Matrix* matrix,
+                            const HungarianSolution* solution,
+                            double tolerance) {
+  if (matrix == NULL || solution == NULL) {
+    return NULL_POINTER;
+  }
+  if (matrix->head == NULL || solution->width != matrix->width ||
+      solution->height != matrix->height) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  RowReader reader = {matrix->head, NULL};
+  return VerifyRows(&reader, solution, tolerance);
+}
+
+/**
+ * @brief  Checks that a solution is an optimal assignment of a dense matrix.
+ * @param  matrix    - The matrix.
+ * @param  solution  - The solution.
+ * @param  tolerance - Largest error accepted in each comparison; 0 for exact
+ *                     checks, which suits integer values.
+ * @retval `NULL_POINTER`              - No matrix or solution provided.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid or the
+ *                                       solution has a different size.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `INVALID_ASSIGNMENT`        - A row or column is used twice, the
+ *                                       assignment is incomplete or
+ *                                       `totalValue` is wrong.
+ * @retval `INFEASIBLE_POTENTIALS`     - The potentials of some cell are below
+ *                                       its value.
+ * @retval `UNPROVEN_OPTIMALITY`       - A chosen cell is not tight, or an
+ *                                       unassigned row or column has a
+ *                                       potential above the others.
+ * @retval `SUCCESS`                   - The solution is optimal.
+ */
+int VerifyHungarianSolutionDense(const DenseMatrix* matrix,
+                                 const HungarianSolution* solution,
+                                 double tolerance) {
+  if (matrix == NULL || solution == NULL) {
+    return NULL_POINTER;
+  }
+  if (!IsValidDense(matrix) || solution->width != matrix->width ||
+      solution->height != matrix->height) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  RowReader reader = {NULL, matrix};
+  return VerifyRows(&reader, solution, tolerance);
+}
+
+/**
+ * @brief  Computes the reduced cost of every cell of a matrix,
+ *         `rowPotentials[i] + colPotentials[j] - value[i][j]`: how much the
+ *         value of the cell may grow before the solution stops being optimal.
+ *         It is zero on the chosen cells.
+ * @param  matrix       - The matrix.
+ * @param  solution     - The solution.
+ * @param  reducedCosts - Array of `height * width` values that will hold the
+ *                        reduced costs, row by row.
+ * @retval `NULL_POINTER`              - No matrix, solution or array provided.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The solution has a different size,
+ *                                       or the matrix has fewer rows or an
+ *                                       element outside its columns.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int GetReducedCosts(const Matrix* matrix, const HungarianSolution* solution,
+                    double* reducedCosts) {
+  if (matrix == NULL || solution == NULL || reducedCosts == NULL) {
+    return NULL_POINTER;
+  }
+  if (matrix->head == NULL || solution->width != matrix->width ||
+      solution->height != matrix->height) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  RowReader reader = {matrix->head, NULL};
+  return ComputeReducedCosts(&reader, solution, reducedCosts);
+}
+
+/**
+ * @brief  Computes the reduced cost of every cell of a dense matrix,
+ *         `rowPotentials[i] + colPotentials[j] - value[i][j]`: how much the
+ *         value of the cell may grow before the solution stops being optimal.
+ *         It is zero on the chosen cells.
+ * @param  matrix       - The matrix.
+ * @param  solution     - The solution.
+ * @param  reducedCosts - Array of `height * width` values that will hold the
+ *                        reduced costs, row by row.
+ * @retval `NULL_POINTER`              - No matrix, solution or array provided.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid or the
+ *                                       solution has a different size.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int GetReducedCostsDense(const DenseMatrix* matrix,
+                         const HungarianSolution* solution,
+                         double* reducedCosts) {
+  if (matrix == NULL || solution == NULL || reducedCosts == NULL) {
+    return NULL_POINTER;
+  }
+  if (!IsValidDense(matrix) || solution->width != matrix->width ||
+      solution->height != matrix->height) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  RowReader reader = {NULL, matrix};
+  return ComputeReducedCosts(&reader, solution, reducedCosts);
+}
@@ -0,0 +1,113 @@
+/**
+ *  @file      certificate.h
+ *  @brief     Header file for the optimality certificates of assignments.
+ *  @details   This file contains the functions that check a
+ *             `HungarianSolution` against its matrix in a single O(n*m) pass,
+ *             without solving the problem again, and that export the reduced
+ *             costs of every cell.
+ *
+ *             A solution is certified optimal when:
+ *             - Every row and column is used at most once, and every row of
+ *               a wide matrix or column of a tall one is used.
+ *             - `rowPotentials[i] + colPotentials[j] >= value[i][j]` for
+ *               every cell (dual feasibility).
+ *             - The chosen cells are tight, and the unassigned rows or
+ *               columns of the larger side have the smallest potential of
+ *               that side (complementary slackness).
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef CERTIFICATE_H
+#define CERTIFICATE_H
+
+#include "hungarian.h"
+#include "matrix_core.h"
+#include "matrix_dense.h"
+
+/**
+ * @brief  Checks that a solution is an optimal assignment of a matrix.
+ * @param  matrix    - The matrix.
+ * @param  solution  - The solution.
+ * @param  tolerance - Largest error accepted in each comparison; 0 for exact
+ *                     checks, which suits integer values.
+ * @retval `NULL_POINTER`              - No matrix or solution provided.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The solution has a different size,
+ *                                       or the matrix has fewer rows or an
+ *                                       element outside its columns.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `INVALID_ASSIGNMENT`        - A row or column is used twice, the
+ *                                       assignment is incomplete or
+ *                                       `totalValue` is wrong.
+ * @retval `INFEASIBLE_POTENTIALS`     - The potentials of some cell are below
+ *                                       its value.
+ * @retval `UNPROVEN_OPTIMALITY`       - A chosen cell is not tight, or an
+ *                                       unassigned row or column has a
+ *                                       potential above the others.
+ * @retval `SUCCESS`                   - The solution is optimal.
+ */
+__declspec(dllexport) int VerifyHungarianSolution(
+    const Matrix* matrix, const HungarianSolution* solution, double tolerance);
+
+/**
+ * @brief  Checks that a solution is an optimal assignment of a dense matrix.
+ * @param  matrix    - The matrix.
+ * @param  solution  - The solution.
+ * @param  tolerance - Largest error accepted in each comparison; 0 for exact
+ *                     checks, which suits integer values.
+ * @retval `NULL_POINTER`              - No matrix or solution provided.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid or the
+ *                                       solution has a different size.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `INVALID_ASSIGNMENT`        - A row or column is used twice, the
+ *                                       assignment is incomplete or
+ *                                       `totalValue` is wrong.
+ * @retval `INFEASIBLE_POTENTIALS`     - The potentials of some cell are below
+ *                                       its value.
+ * @retval `UNPROVEN_OPTIMALITY`       - A chosen cell is not tight, or an
+ *                                       unassigned row or column has a
+ *                                       potential above the others.
+ * @retval `SUCCESS`                   - The solution is optimal.
+ */
+__declspec(dllexport) int VerifyHungarianSolutionDense(
+    const DenseMatrix* matrix, const HungarianSolution* solution,
+    double tolerance);
+
+/**
+ * @brief  Computes the reduced cost of every cell of a matrix,
+ *         `rowPotentials[i] + colPotentials[j] - value[i][j]`: how much the
+ *         value of the cell may grow before the solution stops being optimal.
+ *         It is zero on the chosen cells.
+ * @param  matrix       - The matrix.
+ * @param  solution     - The solution.
+ * @param  reducedCosts - Array of `height * width` values that will hold the
+ *                        reduced costs, row by row.
+ * @retval `NULL_POINTER`              - No matrix, solution or array provided.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The solution has a different size,
+ *                                       or the matrix has fewer rows or an
+ *                                       element outside its columns.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int GetReducedCosts(const Matrix* matrix,
+                                          const HungarianSolution* solution,
+                                          double* reducedCosts);
+
+/**
+ * @brief  Computes the reduced cost of every cell of a dense matrix,
+ *         `rowPotentials[i] + colPotentials[j] - value[i][j]`: how much the
+ *         value of the cell may grow before the solution stops being optimal.
+ *         It is zero on the chosen cells.
+ * @param  matrix       - The matrix.
+ * @param  solution     - The solution.
+ * @param  reducedCosts - Array of `height * width` values that will hold the
+ *                        reduced costs, row by row.
+ * @retval `NULL_POINTER`              - No matrix, solution or array provided.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid or the
+ *                                       solution has a different size.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int GetReducedCostsDense(
+    const DenseMatrix* matrix, const HungarianSolution* solution,
+    double* reducedCosts);
+
+#endif  // !CERTIFICATE_H
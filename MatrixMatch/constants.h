@@ -27,8 +27,60 @@
 // Text File Constants
 #define ELEMENT_SEPARATOR ";"
 #define MAX_LINE_SIZE 500
+#define ASYNC_READ_BLOCK_SIZE 1048576    // Bytes read per buffer by async loads
+#define PARALLEL_PARSE_MIN_BYTES 262144  // Smallest text parsed by one thread
+
+// Batch File Constants
+#define BATCH_FILE_MAGIC "MMBATCH1"  // First bytes of a batch file
+#define BATCH_MAGIC_SIZE 8           // Length of `BATCH_FILE_MAGIC`
+#define BATCH_HEADER_SIZE 16         // Magic, count and reserved field
+#define BATCH_ENTRY_SIZE 16          // Offset, width and height
+#define BATCH_READ_BLOCK_SIZE 65536  // Values read per block by the loader
+
+// Assignment File Constants
+#define ASSIGNMENT_FILE_MAGIC "MMASSIGN"  // First bytes of a binary result
+#define ASSIGNMENT_MAGIC_SIZE 8           // Length of `ASSIGNMENT_FILE_MAGIC`
+#define ASSIGNMENT_HEADER_SIZE 16         // Magic and number of assignments
+#define ASSIGNMENT_RECORD_SIZE 16         // Row, column and value
+#define ASSIGNMENT_BUFFER_SIZE 65536      // Bytes buffered by result writers
+
+// NumPy File Constants
+#define NPY_MAGIC "\x93NUMPY"      // First bytes of a .npy file
+#define NPY_MAGIC_SIZE 6           // Length of `NPY_MAGIC`
+#define NPY_HEADER_ALIGNMENT 64    // Alignment of the data of written files
+#define NPY_MAX_HEADER_SIZE 65535  // Largest header written or accepted
+
+// Parallel Solver Constants
+#define PARALLEL_SOLVE_MIN_COLUMNS 2048  // Fewest columns scanned per thread
+#define CACHE_LINE_SIZE 64               // Bytes per cache line
+#define SPINS_BEFORE_YIELD 4096          // Busy waits before a thread yields
+
+// Auction Constants
+#define AUCTION_EPSILON_SCALING 5  // Division of epsilon between phases
+
+// Cost Scaling Constants
+#define COST_SCALING_FACTOR 10        // Division of epsilon per refinement
+#define COST_SCALING_FIX_FACTOR 4     // Fixing bound, in nodes times epsilon
+#define COST_SCALING_UPDATE_PUSHES 8  // Double pushes per row between updates
+
+// Small Solver Constants
+#define SMALL_SOLVE_MAX_SIZE 16        // Most columns of the bitmask solver
+#define SMALL_SOLVE_DISPATCH_SIZE 7    // Most columns routed to it by solvers
+#define SMALL_SOLVE_STACK_STATES 1024  // Most column sets kept on the stack
+
+// Backtrack Constants
+#define BACKTRACK_CLOCK_NODES 1024  // Nodes explored between clock reads
+
+// Row Hash Constants (64-bit FNV-1a)
+#define ROW_HASH_OFFSET_BASIS 14695981039346656037ULL
+#define ROW_HASH_PRIME 1099511628211ULL
 
 // Default Matrix Values
 #define DEFAULT_MATRIX_VALUE 0
 
+// Matrix Printing Constants
+#define PRINT_BUFFER_SIZE 8192         // Size of the formatted output buffer
+#define PRINT_FULL_MAX_ELEMENTS 10000  // Above this, `PrintMatrix` previews
+#define PRINT_PREVIEW_EDGE 4           // Default head/tail rows and columns
+
 #endif  // !CONSTANTS_H
@@ -0,0 +1,723 @@
+/**
+ *
+ *  @file      cost_scaling.c
+ *  @brief     Implementation of the cost scaling assignment algorithm.
+ *  @details   This file contains the refinements, double pushes, global
+ *             price updates and arc fixing of the cost scaling solver. The
+ *             problem is the minimization of the negated values, with rows
+ *             as the smaller side. Rows and columns have prices, and the
+ *             reduced cost of an arc is `cost + rowPrice - colPrice`; an
+ *             assignment is epsilon optimal when no unassigned arc has a
+ *             reduced cost below -epsilon and no assigned one above epsilon.
+ *             When there are more columns than rows, every assigned column
+ *             also sends its unit to a sink whose price bounds the prices of
+ *             the columns: assigned ones may not be more than epsilon above
+ *             it, unassigned ones not more than epsilon below it.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "cost_scaling.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "assignment.h"
+#include "constants.h"
+#include "error_codes.h"
+#include "matrix_sparse.h"
+
+/**
+ * @struct CostScaling
+ * @brief Arcs, prices and assignment of a cost scaling solve.
+ *
+ * The arcs of each row are at positions `rowStart[i]` to `rowEnd[i] - 1`;
+ * fixed arcs are moved past `rowEnd[i]`. The reverse arcs of each column,
+ * used by the price updates, are kept the same way. Price updates number
+ * the nodes with the rows first, then the columns.
+ */
+typedef struct CostScaling {
+  int rows;               // Number of rows, the smaller side
+  int cols;               // Number of columns
+  double scale;           // Factor of the values in the costs
+  double epsilon;         // Epsilon of the current refinement
+  int* rowStart;          // First arc of each row, plus the total at the end
+  int* rowEnd;            // End of the arcs of each row that are not fixed
+  int* arcCols;           // Column of each arc
+  double* arcCosts;       // Cost of each arc, its value negated and scaled
+  int* colStart;          // First reverse arc of each column, plus the total
+  int* colEnd;            // End of the reverse arcs that are not fixed
+  int* reverseRows;       // Row of each reverse arc
+  double* reverseCosts;   // Cost of each reverse arc
+  double* rowPrices;      // Price of each row
+  double* colPrices;      // Price of each column
+  double sinkPrice;       // Price of the sink, with more columns than rows
+  int* rowToCol;          // Column assigned to each row, or -1
+  int* colToRow;          // Row assigned to each column, or -1
+  double* assignedCosts;  // Cost of the arc assigned to each row
+  int* freeRows;          // Rows without a column
+  int freeCount;          // Number of entries in `freeRows`
+  double* labels;         // Distance of each node to a deficit, in epsilons
+  int* heap;              // Binary heap of nodes ordered by label
+  int* heapPositions;     // Position in `heap`, -1 unreached, -2 scanned
+  int heapSize;           // Number of nodes in `heap`
+} CostScaling;
+
+/**
+ * @brief Frees the arrays of a solve.
+ * @param solver - The solve.
+ */
+static void FreeCostScaling(CostScaling* solver) {
+  free(solver->rowStart);
+  free(solver->rowEnd);
+  free(solver->arcCols);
+  free(solver->arcCosts);
+  free(solver->colStart);
+  free(solver->colEnd);
+  free(solver->reverseRows);
+  free(solver->reverseCosts);
+  free(solver->rowPrices);
+  free(solver->colPrices);
+  free(solver->rowToCol);
+  free(solver->colToRow);
+  free(solver->assignedCosts);
+  free(solver->freeRows);
+  free(solver->labels);
+  free(solver->heap);
+  free(solver->heapPositions);
+}
+
+/**
+ * @brief  Allocates the arrays of a solve, with every price at zero.
+ * @param  solver - The solve, with its size set.
+ * @param  arcs   - Number of arcs.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int AllocateCostScaling(CostScaling* solver, int arcs) {
+  size_t rows = (size_t)solver->rows;
+  size_t cols = (size_t)solver->cols;
+  size_t count = arcs > 0 ? (size_t)arcs : 1;
+  solver->rowStart = malloc((rows + 1) * sizeof(int));
+  solver->rowEnd = malloc(rows * sizeof(int));
+  solver->arcCols = malloc(count * sizeof(int));
+  solver->arcCosts = malloc(count * sizeof(double));
+  solver->colStart = calloc(cols + 1, sizeof(int));
+  solver->colEnd = malloc(cols * sizeof(int));
+  solver->reverseRows = malloc(count * sizeof(int));
+  solver->reverseCosts = malloc(count * sizeof(double));
+  solver->rowPrices = calloc(rows, sizeof(double));
+  solver->colPrices = calloc(cols, sizeof(double));
+  solver->rowToCol = malloc(rows * sizeof(int));
+  solver->colToRow = malloc(cols * sizeof(int));
+  solver->assignedCosts = malloc(rows * sizeof(double));
+  solver->freeRows = malloc(rows * sizeof(int));
+  solver->labels = malloc((rows + cols) * sizeof(double));
+  solver->heap = malloc((rows + cols) * sizeof(int));
+  solver->heapPositions = malloc((rows + cols) * sizeof(int));
+  if (solver->rowStart == NULL || solver->rowEnd == NULL ||
+      solver->arcCols == NULL || solver->arcCosts == NULL ||
+      solver->colStart == NULL || solver->colEnd == NULL ||
+      solver->reverseRows == NULL || solver->reverseCosts == NULL ||
+      solver->rowPrices == NULL || solver->colPrices == NULL ||
+      solver->rowToCol == NULL || solver->colToRow == NULL ||
+      solver->assignedCosts == NULL || solver->freeRows == NULL ||
+      solver->labels == NULL || solver->heap == NULL ||
+      solver->heapPositions == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  return SUCCESS;
+}
+
+/**
+ * @brief  Builds the arcs of a sparse matrix, transposed if it has more rows
+ *         than columns, and the reverse arcs of every column.
+ * @param  matrix - The sparse matrix.
+ * @param  solver - The solve.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int BuildArcs(const SparseMatrix* matrix, CostScaling* solver) {
+  int transposed = matrix->height > matrix->width;
+  solver->rows = transposed ? matrix->width : matrix->height;
+  solver->cols = transposed ? matrix->height : matrix->width;
+  solver->scale = 2.0 * solver->rows + 3.0;
+  int status = AllocateCostScaling(solver, matrix->entryCount);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  // Arcs of the rows: the entries as they are, or sorted by column
+  if (!transposed) {
+    for (int i = 0; i <= solver->rows; i++) {
+      solver->rowStart[i] = matrix->rowOffsets[i];
+    }
+    for (int k = 0; k < matrix->entryCount; k++) {
+      solver->arcCols[k] = matrix->colIndices[k];
+      solver->arcCosts[k] = -(double)matrix->values[k] * solver->scale;
+    }
+  } else {
+    for (int i = 0; i <= solver->rows; i++) {
+      solver->rowStart[i] = 0;
+    }
+    for (int k = 0; k < matrix->entryCount; k++) {
+      solver->rowStart[matrix->colIndices[k] + 1]++;
+    }
+    for (int i = 0; i < solver->rows; i++) {
+      solver->rowStart[i + 1] += solver->rowStart[i];
+    }
+    for (int i = 0; i < solver->rows; i++) {
+      solver->rowEnd[i] = solver->rowStart[i];
+    }
+    for (int row = 0; row < matrix->height; row++) {
+      for (int k = matrix->rowOffsets[row]; k < matrix->rowOffsets[row + 1];
+           k++) {
+        int position = solver->rowEnd[matrix->colIndices[k]]++;
+        solver->arcCols[position] = row;
+        solver->arcCosts[position] = -(double)matrix->values[k] * solver->scale;
+      }
+    }
+  }
+  for (int i = 0; i < solver->rows; i++) {
+    solver->rowEnd[i] = solver->rowStart[i + 1];
+  }
+
+  // Reverse arcs of the columns
+  for (int k = 0; k < matrix->entryCount; k++) {
+    solver->colStart[solver->arcCols[k] + 1]++;
+  }
+  for (int j = 0; j < solver->cols; j++) {
+    solver->colStart[j + 1] += solver->colStart[j];
+    solver->colEnd[j] = solver->colStart[j];
+  }
+  for (int i = 0; i < solver->rows; i++) {
+    for (int k = solver->rowStart[i]; k < solver->rowEnd[i]; k++) {
+      int position = solver->colEnd[solver->arcCols[k]]++;
+      solver->reverseRows[position] = i;
+      solver->reverseCosts[position] = solver->arcCosts[k];
+    }
+  }
+
+  return SUCCESS;
+}
+
+/**
+ * @brief  Finds an augmenting path of Hopcroft-Karp from a free row along
+ *         the layers of the last search, and flips it.
+ * @param  solver   - The solve.
+ * @param  root     - The free row.
+ * @param  rowMatch - Column matched to each row, or -1.
+ * @param  colMatch - Row matched to each column, or -1.
+ * @param  layers   - Layer of each row, -1 for rows out of the layers.
+ * @param  nextArcs - Next arc to try from each row.
+ * @param  stack    - Rows of the current path.
+ * @retval 1 if the path was found, 0 otherwise.
+ */
+static int FindMatchingPath(const CostScaling* solver, int root,
+                            int* rowMatch, int* colMatch, int* layers,
+                            int* nextArcs, int* stack) {
+  int depth = 0;
+  stack[depth++] = root;
+  while (depth > 0) {
+    int row = stack[depth - 1];
+    if (nextArcs[row] == solver->rowEnd[row]) {
+      layers[row] = -1;
+      depth--;
+      continue;
+    }
+
+    int col = solver->arcCols[nextArcs[row]++];
+    int next = colMatch[col];
+    if (next < 0) {
+      // The arc of each row of the path is the last one it tried
+      for (int d = depth - 1; d >= 0; d--) {
+        int pathRow = stack[d];
+        int pathCol = solver->arcCols[nextArcs[pathRow] - 1];
+        rowMatch[pathRow] = pathCol;
+        colMatch[pathCol] = pathRow;
+      }
+      return 1;
+    }
+    if (layers[next] == layers[row] + 1) {
+      stack[depth++] = next;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief  Checks with Hopcroft-Karp that some assignment covers every row.
+ *         Without one, the refinements would never end.
+ * @param  solver   - The solve.
+ * @param  complete - Pointer to store whether every row can be covered.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int CheckCompleteMatching(const CostScaling* solver, int* complete) {
+  int* rowMatch = malloc((size_t)solver->rows * sizeof(int));
+  int* colMatch = malloc((size_t)solver->cols * sizeof(int));
+  int* layers = malloc((size_t)solver->rows * sizeof(int));
+  int* nextArcs = malloc((size_t)solver->rows * sizeof(int));
+  int* queue = malloc((size_t)solver->rows * sizeof(int));
+  if (rowMatch == NULL || colMatch == NULL || layers == NULL ||
+      nextArcs == NULL || queue == NULL) {
+    free(rowMatch);
+    free(colMatch);
+    free(layers);
+    free(nextArcs);
+    free(queue);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  for (int i = 0; i < solver->rows; i++) {
+    rowMatch[i] = -1;
+  }
+  for (int j = 0; j < solver->cols; j++) {
+    colMatch[j] = -1;
+  }
+
+  int matched = 0;
+  int found = 1;
+  while (found && matched < solver->rows) {
+    // Layers of rows by breadth-first search from the free rows
+    int head = 0;
+    int tail = 0;
+    for (int i = 0; i < solver->rows; i++) {
+      layers[i] = rowMatch[i] < 0 ? 0 : -1;
+      if (rowMatch[i] < 0) {
+        queue[tail++] = i;
+      }
+    }
+    found = 0;
+    while (head < tail) {
+      int row = queue[head++];
+      for (int k = solver->rowStart[row]; k < solver->rowEnd[row]; k++) {
+        int next = colMatch[solver->arcCols[k]];
+        if (next < 0) {
+          found = 1;
+        } else if (layers[next] < 0) {
+          layers[next] = layers[row] + 1;
+          queue[tail++] = next;
+        }
+      }
+    }
+
+    // Disjoint shortest augmenting paths; the queue serves as the stack
+    for (int i = 0; i < solver->rows && found; i++) {
+      nextArcs[i] = solver->rowStart[i];
+    }
+    for (int i = 0; i < solver->rows && found; i++) {
+      if (rowMatch[i] < 0 &&
+          FindMatchingPath(solver, i, rowMatch, colMatch, layers, nextArcs,
+                           queue)) {
+        matched++;
+      }
+    }
+  }
+
+  *complete = matched == solver->rows;
+  free(rowMatch);
+  free(colMatch);
+  free(layers);
+  free(nextArcs);
+  free(queue);
+  return SUCCESS;
+}
+
+/**
+ * @brief Moves a node of the heap up to its place.
+ * @param solver - The solve.
+ * @param node   - The node.
+ */
+static void SiftUp(CostScaling* solver, int node) {
+  int position = solver->heapPositions[node];
+  while (position > 0) {
+    int parent = (position - 1) / 2;
+    int parentNode = solver->heap[parent];
+    if (solver->labels[parentNode] <= solver->labels[node]) {
+      break;
+    }
+    solver->heap[position] = parentNode;
+    solver->heapPositions[parentNode] = position;
+    position = parent;
+  }
+  solver->heap[position] = node;
+  solver->heapPositions[node] = position;
+}
+
+/**
+ * @brief  Removes the node with the smallest label from the heap.
+ * @param  solver - The solve.
+ * @retval The node, marked as scanned.
+ */
+static int PopNode(CostScaling* solver) {
+  int top = solver->heap[0];
+  int last = solver->heap[--solver->heapSize];
+  solver->heapPositions[top] = -2;
+
+  int position = 0;
+  while (solver->heapSize > 0) {
+    int child = 2 * position + 1;
+    if (child >= solver->heapSize) {
+      break;
+    }
+    if (child + 1 < solver->heapSize &&
+        solver->labels[solver->heap[child + 1]] <
+            solver->labels[solver->heap[child]]) {
+      child++;
+    }
+    if (solver->labels[solver->heap[child]] >= solver->labels[last]) {
+      break;
+    }
+    solver->heap[position] = solver->heap[child];
+    solver->heapPositions[solver->heap[position]] = position;
+    position = child;
+  }
+  if (solver->heapSize > 0) {
+    solver->heap[position] = last;
+    solver->heapPositions[last] = position;
+  }
+  return top;
+}
+
+/**
+ * @brief Lowers the label of a node that was not scanned yet.
+ * @param solver - The solve.
+ * @param node   - The node.
+ * @param label  - The new label, kept only if smaller.
+ */
+static void ReachNode(CostScaling* solver, int node, double label) {
+  if (solver->heapPositions[node] == -2 || label >= solver->labels[node]) {
+    return;
+  }
+  solver->labels[node] = label;
+  if (solver->heapPositions[node] == -1) {
+    solver->heapPositions[node] = solver->heapSize++;
+  }
+  SiftUp(solver, node);
+}
+
+/**
+ * @brief  Gets the length of a residual arc in a price update: one more
+ *         than its reduced cost in whole epsilons.
+ * @param  solver      - The solve.
+ * @param  reducedCost - Reduced cost of the residual arc, at least -epsilon.
+ * @retval The length, at least 0.
+ */
+static double GetArcLength(const CostScaling* solver, double reducedCost) {
+  return floor(reducedCost / solver->epsilon) + 1.0;
+}
+
+/**
+ * @brief Global price update: finds the distance of every node to a deficit
+ *        over the residual arcs, with the lengths of `GetArcLength`, and
+ *        lowers each price by its distance times epsilon. The deficits are
+ *        the unassigned columns, or the sink with more columns than rows.
+ *        The search stops once every free row is scanned; nodes not
+ *        scanned by then take the last distance. Epsilon optimality is
+ *        kept, and every free row gets an admissible path to a deficit.
+ * @param solver - The solve.
+ */
+static void UpdatePrices(CostScaling* solver) {
+  int rows = solver->rows;
+  int nodes = rows + solver->cols;
+  solver->heapSize = 0;
+  for (int v = 0; v < nodes; v++) {
+    solver->labels[v] = HUGE_VAL;
+    solver->heapPositions[v] = -1;
+  }
+  for (int j = 0; j < solver->cols; j++) {
+    if (solver->colToRow[j] >= 0) {
+      continue;
+    }
+    double label = 0.0;
+    if (rows < solver->cols) {
+      label = GetArcLength(solver, solver->colPrices[j] - solver->sinkPrice);
+    }
+    ReachNode(solver, rows + j, label);
+  }
+
+  int remaining = solver->freeCount;
+  double last = 0.0;
+  while (solver->heapSize > 0 && remaining > 0) {
+    int node = PopNode(solver);
+    last = solver->labels[node];
+
+    if (node < rows) {
+      // Rows are left through the reverse of their assigned arc
+      int col = solver->rowToCol[node];
+      if (col < 0) {
+        remaining--;
+        continue;
+      }
+      double reducedCost = solver->assignedCosts[node] +
+                           solver->rowPrices[node] - solver->colPrices[col];
+      ReachNode(solver, rows + col, last + GetArcLength(solver, -reducedCost));
+      continue;
+    }
+
+    int col = node - rows;
+    for (int k = solver->colStart[col]; k < solver->colEnd[col]; k++) {
+      int row = solver->reverseRows[k];
+      if (solver->rowToCol[row] == col) {
+        continue;
+      }
+      double reducedCost = solver->reverseCosts[k] + solver->rowPrices[row] -
+                           solver->colPrices[col];
+      ReachNode(solver, row, last + GetArcLength(solver, reducedCost));
+    }
+  }
+
+  for (int v = 0; v < nodes; v++) {
+    double distance = solver->heapPositions[v] == -2 ? solver->labels[v]
+                                                     : last;
+    if (v < rows) {
+      solver->rowPrices[v] -= distance * solver->epsilon;
+    } else {
+      solver->colPrices[v - rows] -= distance * solver->epsilon;
+    }
+  }
+}
+
+/**
+ * @brief Double push from a free row: the row takes its cheapest column at
+ *        the current prices, and the column gets the price that leaves it
+ *        epsilon more expensive than the second cheapest, pushing out the
+ *        row that held it. The column refuses the row, which stays free,
+ *        when taking it would break epsilon optimality: the previous holder
+ *        is much cheaper, or a free column would rise above the sink.
+ * @param solver - The solve.
+ * @param row    - The free row.
+ */
+static void DoublePush(CostScaling* solver, int row) {
+  int bestArc = solver->rowStart[row];
+  double best = HUGE_VAL;
+  double second = HUGE_VAL;
+  for (int k = solver->rowStart[row]; k < solver->rowEnd[row]; k++) {
+    double cost = solver->arcCosts[k] - solver->colPrices[solver->arcCols[k]];
+    if (cost < best) {
+      second = best;
+      best = cost;
+      bestArc = k;
+    } else if (cost < second) {
+      second = cost;
+    }
+  }
+  // A single arc has no competitor
+  if (second == HUGE_VAL) {
+    second = best;
+  }
+
+  int col = solver->arcCols[bestArc];
+  int holder = solver->colToRow[col];
+  double price = solver->arcCosts[bestArc] - second - solver->epsilon;
+  int taken;
+  if (holder >= 0) {
+    taken = price <= solver->assignedCosts[holder] +
+                         solver->rowPrices[holder] + solver->epsilon;
+  } else if (solver->rows < solver->cols) {
+    price = fmax(price, solver->sinkPrice - solver->epsilon);
+    taken = price < solver->sinkPrice;
+  } else {
+    taken = 1;
+  }
+
+  solver->rowPrices[row] = -second;
+  solver->colPrices[col] = price;
+  if (!taken) {
+    solver->freeRows[solver->freeCount++] = row;
+    return;
+  }
+
+  if (holder >= 0) {
+    solver->rowToCol[holder] = -1;
+    solver->freeRows[solver->freeCount++] = holder;
+  }
+  solver->colToRow[col] = row;
+  solver->rowToCol[row] = col;
+  solver->assignedCosts[row] = solver->arcCosts[bestArc];
+}
+
+/**
+ * @brief Refinement: drops the assignment and rebuilds an epsilon optimal
+ *        one with double pushes, keeping the column prices. The prices are
+ *        updated at the start and after every `COST_SCALING_UPDATE_PUSHES`
+ *        double pushes per row.
+ * @param solver - The solve.
+ */
+static void Refine(CostScaling* solver) {
+  for (int j = 0; j < solver->cols; j++) {
+    solver->colToRow[j] = -1;
+  }
+  // Every row gets the price that makes its cheapest arc tight
+  for (int i = 0; i < solver->rows; i++) {
+    double best = HUGE_VAL;
+    for (int k = solver->rowStart[i]; k < solver->rowEnd[i]; k++) {
+      best = fmin(best,
+                  solver->arcCosts[k] - solver->colPrices[solver->arcCols[k]]);
+    }
+    solver->rowPrices[i] = -best;
+    solver->rowToCol[i] = -1;
+    solver->freeRows[i] = solver->rows - 1 - i;
+  }
+  solver->freeCount = solver->rows;
+  if (solver->rows < solver->cols) {
+    solver->sinkPrice = HUGE_VAL;
+    for (int j = 0; j < solver->cols; j++) {
+      solver->sinkPrice = fmin(solver->sinkPrice, solver->colPrices[j]);
+    }
+  }
+
+  UpdatePrices(solver);
+  long long interval =
+      (long long)solver->rows * COST_SCALING_UPDATE_PUSHES;
+  long long pushes = 0;
+  while (solver->freeCount > 0) {
+    DoublePush(solver, solver->freeRows[--solver->freeCount]);
+    if (++pushes % interval == 0 && solver->freeCount > 0) {
+      UpdatePrices(solver);
+    }
+  }
+}
+
+/**
+ * @brief Fixes the unassigned arcs whose reduced cost is above
+ *        `COST_SCALING_FIX_FACTOR` times the number of nodes times epsilon:
+ *        no later refinement can assign them, so they are moved out of the
+ *        arcs of their row and column.
+ * @param solver - The solve.
+ */
+static void FixArcs(CostScaling* solver) {
+  double threshold = COST_SCALING_FIX_FACTOR *
+                     (solver->rows + solver->cols + 1.0) * solver->epsilon;
+
+  for (int i = 0; i < solver->rows; i++) {
+    int k = solver->rowStart[i];
+    while (k < solver->rowEnd[i]) {
+      int col = solver->arcCols[k];
+      double reducedCost = solver->arcCosts[k] + solver->rowPrices[i] -
+                           solver->colPrices[col];
+      if (solver->rowToCol[i] == col || reducedCost <= threshold) {
+        k++;
+        continue;
+      }
+      int end = --solver->rowEnd[i];
+      solver->arcCols[k] = solver->arcCols[end];
+      solver->arcCols[end] = col;
+      double cost = solver->arcCosts[k];
+      solver->arcCosts[k] = solver->arcCosts[end];
+      solver->arcCosts[end] = cost;
+    }
+  }
+
+  for (int j = 0; j < solver->cols; j++) {
+    int k = solver->colStart[j];
+    while (k < solver->colEnd[j]) {
+      int row = solver->reverseRows[k];
+      double reducedCost = solver->reverseCosts[k] + solver->rowPrices[row] -
+                           solver->colPrices[j];
+      if (solver->rowToCol[row] == j || reducedCost <= threshold) {
+        k++;
+        continue;
+      }
+      int end = --solver->colEnd[j];
+      solver->reverseRows[k] = solver->reverseRows[end];
+      solver->reverseRows[end] = row;
+      double cost = solver->reverseCosts[k];
+      solver->reverseCosts[k] = solver->reverseCosts[end];
+      solver->reverseCosts[end] = cost;
+    }
+  }
+}
+
+/**
+ * @brief  Creates the result of a solve, in the row order of the original
+ *         matrix.
+ * @param  matrix - The sparse matrix.
+ * @param  solver - The finished solve.
+ * @param  result - Pointer to store the chosen elements.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int ExtractCostScalingResult(const SparseMatrix* matrix,
+                                    const CostScaling* solver,
+                                    AssignmentResult** result) {
+  AssignmentResult* selection = NULL;
+  if (CreateAssignmentResult(solver->rows, &selection) != SUCCESS) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  int transposed = matrix->height > matrix->width;
+  int status = SUCCESS;
+  for (int row = 0; row < matrix->height && status == SUCCESS; row++) {
+    int solverRow = transposed ? solver->colToRow[row] : row;
+    if (solverRow < 0) {
+      continue;
+    }
+    int solverCol = transposed ? row : solver->rowToCol[row];
+    double value = -solver->assignedCosts[solverRow] / solver->scale;
+    status = AddAssignment(selection, row, transposed ? solverRow : solverCol,
+                           value);
+  }
+
+  if (status != SUCCESS) {
+    FreeAssignmentResult(selection);
+    return status;
+  }
+
+  *result = selection;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Solves the problem on a sparse matrix with the cost scaling
+ *         push-relabel algorithm, keeping the row and column of each chosen
+ *         element.
+ * @param  matrix - The sparse matrix.
+ * @param  result - Pointer to store the chosen elements.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `NO_FEASIBLE_ASSIGNMENT`    - The existing cells cannot cover every
+ *                                       row of a wide matrix or column of a
+ *                                       tall one.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CostScalingAssignmentSparse(const SparseMatrix* matrix,
+                                AssignmentResult** result) {
+  if (matrix == NULL || result == NULL || matrix->width <= 0 ||
+      matrix->height <= 0) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  CostScaling solver = {0};
+  int status = BuildArcs(matrix, &solver);
+  int complete = 0;
+  if (status == SUCCESS) {
+    status = CheckCompleteMatching(&solver, &complete);
+  }
+  if (status == SUCCESS && !complete) {
+    status = NO_FEASIBLE_ASSIGNMENT;
+  }
+
+  if (status == SUCCESS) {
+    double largest = 0.0;
+    for (int k = 0; k < matrix->entryCount; k++) {
+      largest = fmax(largest, fabs(solver.arcCosts[k]));
+    }
+
+    solver.epsilon = largest;
+    do {
+      solver.epsilon = fmax(1.0, floor(solver.epsilon / COST_SCALING_FACTOR));
+      Refine(&solver);
+      if (solver.epsilon > 1.0) {
+        FixArcs(&solver);
+      }
+    } while (solver.epsilon > 1.0);
+
+    status = ExtractCostScalingResult(matrix, &solver, result);
+  }
+
+  FreeCostScaling(&solver);
+  return status;
+}
@@ -0,0 +1,43 @@
+/**
+ *  @file      cost_scaling.h
+ *  @brief     Header file for the cost scaling assignment algorithm.
+ *  @details   This header file contains the declaration of a cost scaling
+ *             push-relabel solver in the style of the CSA codes of Goldberg
+ *             and Kennedy, for large sparse matrices. Each refinement divides
+ *             epsilon by `COST_SCALING_FACTOR` and rebuilds an epsilon
+ *             optimal assignment with double pushes, helped by global price
+ *             updates and by fixing the arcs whose reduced cost is too high
+ *             to ever enter the assignment again.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef COST_SCALING_H
+#define COST_SCALING_H
+
+#include "assignment.h"
+#include "matrix_sparse.h"
+
+/**
+ * @brief  Solves the problem on a sparse matrix with the cost scaling
+ *         push-relabel algorithm, keeping the row and column of each chosen
+ *         element. Only existing cells can be chosen; every row of a wide
+ *         matrix and every column of a tall one is assigned, with the
+ *         largest possible total.
+ * @details Before solving, Hopcroft-Karp checks that such an assignment
+ *          exists. The values are multiplied by 2n + 3, so the last
+ *          refinement, with epsilon = 1, gives an optimal assignment.
+ * @param  matrix - The sparse matrix.
+ * @param  result - Pointer to store the chosen elements; free it with
+ *                  `FreeAssignmentResult`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `NO_FEASIBLE_ASSIGNMENT`    - The existing cells cannot cover every
+ *                                       row of a wide matrix or column of a
+ *                                       tall one.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CostScalingAssignmentSparse(
+    const SparseMatrix* matrix, AssignmentResult** result);
+
+#endif  // !COST_SCALING_H
@@ -21,7 +21,15 @@
 #define CANNOT_OPEN_FILE -5           // Unable to open the file
 #define FILE_READ_ERROR -6            // File read error
 #define UNABLE_REPLACE_VALUE -7  // Unable to replace the value of an element
-#define OUT_OF_BOUNDS -8         // Position is out of bounds of the matrix
-#define NULL_POINTER -9          // Pointer is NULL
+#define OUT_OF_BOUNDS -8              // Position is out of bounds of the matrix
+#define NULL_POINTER -9               // Pointer is NULL
+#define THREAD_CREATION_FAILURE -10   // Unable to create a thread
+#define INVALID_FILE_FORMAT -11       // File content has an unexpected format
+#define FILE_WRITE_ERROR -12          // File write error
+#define NO_FEASIBLE_ASSIGNMENT -13    // No assignment covers every row
+#define INVALID_ASSIGNMENT -14        // Assignment inconsistent with the matrix
+#define INFEASIBLE_POTENTIALS -15     // Potentials below the value of a cell
+#define UNPROVEN_OPTIMALITY -16       // Potentials do not prove optimality
+#define TIME_LIMIT_REACHED -17        // Stopped when the time limit passed
 
 #endif  // !ERROR_CODES_H
@@ -11,11 +11,195 @@
  */
 #include "greedy.h"
 
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "assignment.h"
 #include "error_codes.h"
 #include "matrix_core.h"
+#include "matrix_sparse.h"
+#include "solver_workspace.h"
+
+/**
+ * @brief  Selects, row by row, the largest element of a column not used
+ *         yet.
+ * @param  matrix      - The matrix.
+ * @param  usedColumns - Array of `matrix->width` marks.
+ * @param  selection   - The result, filled with the selected elements.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int SelectByRows(Matrix* matrix, int* usedColumns,
+                        AssignmentResult* selection) {
+  memset(usedColumns, 0, (size_t)matrix->width * sizeof(int));
+
+  int status = SUCCESS;
+  MatrixRowNode* currentRow = matrix->head;
+  int rowIndex = 0;
+  while (currentRow != NULL && status == SUCCESS) {
+    MatrixElement* currentElement = currentRow->row;
+    int maxElementValue = INT_MIN;
+    const MatrixElement* maxElement = NULL;
+
+    // Find largest number that you can get in current row
+    while (currentElement != NULL) {
+      if (!usedColumns[currentElement->column] &&
+          (maxElement == NULL || currentElement->value > maxElementValue)) {
+        maxElementValue = currentElement->value;
+        maxElement = currentElement;
+      }
+      currentElement = currentElement->nextCol;
+    }
+
+    // If an element has been found, add it to the selection
+    if (maxElement != NULL) {
+      status = AddAssignment(selection, rowIndex, maxElement->column,
+                             maxElement->value);
+      usedColumns[maxElement->column] = 1;  // Mark column as used
+    }
+
+    currentRow = currentRow->nextRow;
+    rowIndex++;
+  }
+
+  return status;
+}
+
+/**
+ * @brief  Selects, column by column, the largest element of a row not used
+ *         yet. Used when the matrix has more rows than columns, so every
+ *         column gets an element.
+ * @param  matrix    - The matrix.
+ * @param  usedRows  - Array of `matrix->height` marks.
+ * @param  cursors   - Array of `matrix->height` element pointers.
+ * @param  selection - The result, filled with the selected elements.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int SelectByColumns(Matrix* matrix, int* usedRows,
+                           MatrixElement** cursors,
+                           AssignmentResult* selection) {
+  memset(usedRows, 0, (size_t)matrix->height * sizeof(int));
+
+  // One cursor per row walks the row as the columns advance
+  int rowIndex = 0;
+  for (MatrixRowNode* currentRow = matrix->head;
+       currentRow != NULL && rowIndex < matrix->height;
+       currentRow = currentRow->nextRow) {
+    cursors[rowIndex++] = currentRow->row;
+  }
+  int rowCount = rowIndex;
+
+  int status = SUCCESS;
+  for (int col = 0; col < matrix->width && status == SUCCESS; col++) {
+    int maxElementValue = INT_MIN;
+    int maxRow = -1;
+
+    // Find largest number that you can get in current column
+    for (int row = 0; row < rowCount; row++) {
+      while (cursors[row] != NULL && cursors[row]->column < col) {
+        cursors[row] = cursors[row]->nextCol;
+      }
+      if (!usedRows[row] && cursors[row] != NULL &&
+          cursors[row]->column == col &&
+          (maxRow < 0 || cursors[row]->value > maxElementValue)) {
+        maxElementValue = cursors[row]->value;
+        maxRow = row;
+      }
+    }
+
+    // If an element has been found, add it to the selection
+    if (maxRow >= 0) {
+      status = AddAssignment(selection, maxRow, col, maxElementValue);
+      usedRows[maxRow] = 1;  // Mark row as used
+    }
+  }
+
+  return status;
+}
+
+/**
+ * @brief Solve the problem with a "Greedy" algorithm, keeping the row and
+ *        column of each selected element. A matrix with more rows than
+ *        columns is walked by columns, so every row or column of the
+ *        smaller dimension gets an element.
+ * @param matrix - The matrix.
+ * @param result - Pointer to store the selected elements.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix or the provided indices are
+ *                                       invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int GreedyAssignment(Matrix* matrix, AssignmentResult** result) {
+  if (matrix == NULL || matrix->width <= 0 || matrix->height <= 0 ||
+      result == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  AssignmentResult* selection = NULL;
+  int status = CreateAssignmentResult(
+      matrix->height < matrix->width ? matrix->height : matrix->width,
+      &selection);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  if (matrix->height > matrix->width) {
+    int* usedRows = malloc(matrix->height * sizeof(int));
+    MatrixElement** cursors = malloc(matrix->height * sizeof(MatrixElement*));
+    status = usedRows == NULL || cursors == NULL
+                 ? MEMORY_ALLOCATION_FAILURE
+                 : SelectByColumns(matrix, usedRows, cursors, selection);
+    free(usedRows);
+    free(cursors);
+  } else {
+    int* usedColumns = malloc(matrix->width * sizeof(int));
+    status = usedColumns == NULL
+                 ? MEMORY_ALLOCATION_FAILURE
+                 : SelectByRows(matrix, usedColumns, selection);
+    free(usedColumns);
+  }
+
+  if (status != SUCCESS) {
+    FreeAssignmentResult(selection);
+    return status;
+  }
+
+  *result = selection;
+  return SUCCESS;
+}
+
+/**
+ * @brief Solve the problem with a "Greedy" algorithm with the memory of a
+ *        workspace, see `GreedyAssignment`.
+ * @param matrix    - The matrix.
+ * @param workspace - The workspace, grown if the matrix does not fit.
+ * @param result    - The result; its previous elements are discarded.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix or the provided indices are
+ *                                       invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int GreedyAssignmentWithWorkspace(Matrix* matrix, SolverWorkspace* workspace,
+                                  AssignmentResult* result) {
+  if (matrix == NULL || matrix->width <= 0 || matrix->height <= 0 ||
+      workspace == NULL || result == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  if (ReserveSolverWorkspace(workspace, matrix->width, matrix->height) !=
+      SUCCESS) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  ClearAssignmentResult(result);
+  if (matrix->height > matrix->width) {
+    return SelectByColumns(matrix, workspace->usedRows, workspace->cursors,
+                           result);
+  }
+  return SelectByRows(matrix, workspace->usedColumns, result);
+}
 
 /**
  * @brief Solve the problem with a "Greedy" algorithm.
@@ -31,52 +215,71 @@
  */
 int GreedyAlgorithm(Matrix* matrix, int* maxSum, int* maxSelection,
                     int* currentSelectionSize) {
-  if (matrix == NULL || matrix->width <= 0) {
-    return INVALID_MATRIX_OR_INDICES;
+  AssignmentResult* selection = NULL;
+  int status = GreedyAssignment(matrix, &selection);
+  if (status != SUCCESS) {
+    return status;
   }
 
   *maxSum = 0;
+  for (int i = 0; i < selection->count; i++) {
+    maxSelection[i] = (int)selection->values[i];
+    *maxSum += maxSelection[i];
+  }
+  *currentSelectionSize = selection->count;
+
+  FreeAssignmentResult(selection);
+
+  return SUCCESS;
+}
+
+/**
+ * @brief Solve the problem with a "Greedy" algorithm on a sparse matrix.
+ *        Only the existing cells of each row are visited.
+ * @param matrix               - The sparse matrix.
+ * @param maxSum               - Pointer to store the maximum sum.
+ * @param maxSelection         - Pointer to store the selected numbers.
+ * @param currentSelectionSize - Pointer to store the selected elements.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int GreedyAlgorithmSparse(const SparseMatrix* matrix, int* maxSum,
+                          int* maxSelection, int* currentSelectionSize) {
+  if (matrix == NULL || matrix->width <= 0) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
 
-  int* usedRows = calloc(matrix->height, sizeof(int));
   int* usedColumns = calloc(matrix->width, sizeof(int));
-  if (usedRows == NULL || usedColumns == NULL) {
-    free(usedRows);
-    free(usedColumns);
+  if (usedColumns == NULL) {
     return MEMORY_ALLOCATION_FAILURE;
   }
 
-  MatrixRowNode* currentRow = matrix->head;
+  *maxSum = 0;
   *currentSelectionSize = 0;
-  int rowIndex = 0;
-  while (currentRow != NULL) {
-    MatrixElement* currentElement = currentRow->row;
+  for (int row = 0; row < matrix->height; row++) {
     int maxElementValue = INT_MIN;
-    const MatrixElement* maxElement = NULL;
+    int maxEntry = -1;
 
     // Find largest number that you can get in current row
-    while (currentElement != NULL) {
-      if (!usedRows[rowIndex] && !usedColumns[currentElement->column] &&
-          currentElement->value > maxElementValue) {
-        maxElementValue = currentElement->value;
-        maxElement = currentElement;
+    for (int i = matrix->rowOffsets[row]; i < matrix->rowOffsets[row + 1];
+         i++) {
+      if (!usedColumns[matrix->colIndices[i]] &&
+          (maxEntry < 0 || matrix->values[i] > maxElementValue)) {
+        maxElementValue = matrix->values[i];
+        maxEntry = i;
       }
-      currentElement = currentElement->nextCol;
     }
 
     // If an element has been found, add it to the selection
-    if (maxElement != NULL) {
-      maxSelection[*currentSelectionSize] = maxElement->value;
+    if (maxEntry >= 0) {
+      maxSelection[*currentSelectionSize] = maxElementValue;
       (*currentSelectionSize)++;
-      *maxSum += maxElement->value;
-      usedRows[rowIndex] = 1;               // Mark row as used
-      usedColumns[maxElement->column] = 1;  // Mark column as used
+      *maxSum += maxElementValue;
+      usedColumns[matrix->colIndices[maxEntry]] = 1;  // Mark column as used
     }
-
-    currentRow = currentRow->nextRow;
-    rowIndex++;
   }
 
-  free(usedRows);
   free(usedColumns);
 
   return SUCCESS;
@@ -10,7 +10,10 @@
 #ifndef GREEDY_H
 #define GREEDY_H
 
+#include "assignment.h"
 #include "matrix_core.h"
+#include "matrix_sparse.h"
+#include "solver_workspace.h"
 
 /**
  * @brief  Solve the problem with a "Greedy" algorithm.
@@ -29,4 +32,54 @@ __declspec(dllexport) int GreedyAlgorithm(Matrix* matrix, int* maxSum,
                                           int* maxSelection,
                                           int* currentSelectionSize);
 
+/**
+ * @brief  Solve the problem with a "Greedy" algorithm, keeping the row and
+ *         column of each selected element. A matrix with more rows than
+ *         columns is walked by columns, so every row or column of the
+ *         smaller dimension gets an element.
+ * @param  matrix - The matrix.
+ * @param  result - Pointer to store the selected elements; free it with
+ *                  `FreeAssignmentResult`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix or the provided indices are
+ *                                       invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int GreedyAssignment(Matrix* matrix,
+                                           AssignmentResult** result);
+
+/**
+ * @brief  Solve the problem with a "Greedy" algorithm with the memory of a
+ *         workspace. The result is the one of `GreedyAssignment`, and once
+ *         the workspace fits the matrix and the result has room for the
+ *         selected elements, the solve makes no allocation.
+ * @param  matrix    - The matrix.
+ * @param  workspace - The workspace, from `CreateSolverWorkspace`; it is
+ *                     grown if the matrix does not fit.
+ * @param  result    - The result, from `CreateAssignmentResult`; its
+ *                     previous elements are discarded.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix or the provided indices are
+ *                                       invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int GreedyAssignmentWithWorkspace(
+    Matrix* matrix, SolverWorkspace* workspace, AssignmentResult* result);
+
+/**
+ * @brief  Solve the problem with a "Greedy" algorithm on a sparse matrix.
+ *         Only the existing cells of each row are visited.
+ * @param  matrix               - The sparse matrix.
+ * @param  maxSum               - Pointer to store the maximum sum.
+ * @param  maxSelection         - Pointer to store the selected numbers.
+ * @param  currentSelectionSize - Pointer to store the number of selected
+ *                                elements.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int GreedyAlgorithmSparse(const SparseMatrix* matrix,
+                                                int* maxSum, int* maxSelection,
+                                                int* currentSelectionSize);
+
 #endif  // !GREEDY_H
\ No newline at end of file
@@ -3,7 +3,10 @@
  *  @file      hungarian.c
  *  @brief     Implementation of the Hungarian Algorithm to solve the problem.
  *  @details   This file contains the necessary functions for the implementation
- *             of the Hungarian Algorithm.
+ *             of the Hungarian Algorithm. The maximization problem is turned
+ *             into the minimization of the negated values and solved by the
+ *             shortest augmenting path engine of `lap_core.h`, which is
+ *             O(n^3) in the worst case.
  *  @author    Enrique Rodrigues
  *  @date      15.03.2024
  *  @copyright  Enrique Rodrigues, 2024. All right reserved.
@@ -11,500 +14,1115 @@
  */
 #include "hungarian.h"
 
-#include <limits.h>
-#include <stdbool.h>
-#include <stdio.h>
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "assignment.h"
+#include "constants.h"
+#include "error_codes.h"
+#include "lap_core.h"
+#include "lap_small.h"
 #include "matrix_core.h"
+#include "matrix_dense.h"
 #include "matrix_io.h"
+#include "platform.h"
+#include "solver_workspace.h"
 
 /**
- * @brief Gets the index of a row in the matrix, given a specific row node.
- * @param matrix  - Pointer to the matrix representing the problem.
- * @param rowNode - Pointer to the row node whose index should be found.
- * @return The index of the row corresponding to the provided node.
+ * @struct CostMatrix
+ * @brief Negated values of a matrix, row by row, used as the costs of the
+ *        minimization problem. Tall matrices are stored transposed, so the
+ *        rows of the costs are always the smaller dimension.
  */
-static int GetRowIndex(Matrix* matrix, const MatrixRowNode* rowNode) {
-  int index = 0;
-  for (MatrixRowNode* temp = matrix->head; temp != rowNode;
-       temp = temp->nextRow) {
-    index++;
-  }
-  return index;
+typedef struct CostMatrix {
+  int width;      // Number of columns of the costs
+  int height;     // Number of rows of the costs
+  double* costs;  // Cost of row `i` and column `j` at `i * width + j`
+} CostMatrix;
+
+/**
+ * @brief  Gets a row of a `CostMatrix`, for `LapCost`.
+ * @param  context - The `CostMatrix`.
+ * @param  row     - The row.
+ * @param  buffer  - Unused; the row is returned in place.
+ * @retval Pointer to the costs of the row.
+ */
+static const double* GetCostMatrixRow(void* context, int row, double* buffer) {
+  const CostMatrix* matrix = context;
+  (void)buffer;
+  return matrix->costs + (size_t)row * matrix->width;
 }
 
 /**
- * @brief Creates a new structure to represent a zero in the matrix,
- *        with the row and column indices.
- * @param row - Index of the row where the zero is located.
- * @param col - Index of the column where the zero is located.
- * @return A pointer to the newly created `Zero` structure, or terminates the
- *         program in case of memory allocation failure.
+ * @struct MatrixRows
+ * @brief Rows of a linked-list matrix read in place as the costs of the
+ *        minimization problem: each value negated, and `cols - width`
+ *        extra columns of cost 0 when the matrix has more rows than columns.
  */
-static Zero* CreateZero(int row, int col) {
-  Zero* zero = (Zero*)malloc(sizeof(Zero));
-  if (zero == NULL) {
-    exit(MEMORY_ALLOCATION_FAILURE);
+typedef struct MatrixRows {
+  int width;                   // Number of columns of the matrix
+  int cols;                    // Number of columns of the costs
+  const MatrixRowNode** rows;  // Node of each row
+} MatrixRows;
+
+/**
+ * @brief  Gets the negated values of a row of a linked-list matrix, for
+ *         `LapCost`. Missing elements and extra columns cost 0.
+ * @param  context - The `MatrixRows`.
+ * @param  row     - The row.
+ * @param  buffer  - Array that will hold the costs of the row.
+ * @retval `buffer`.
+ */
+static const double* GetMatrixRowsRow(void* context, int row,
+                                      double* buffer) {
+  const MatrixRows* rows = context;
+  for (int j = 0; j < rows->cols; j++) {
+    buffer[j] = 0.0;
+  }
+  for (const MatrixElement* element = rows->rows[row]->row; element != NULL;
+       element = element->nextCol) {
+    buffer[element->column] = -(double)element->value;
   }
-  zero->row = row;
-  zero->col = col;
-  return zero;
+  return buffer;
 }
 
 /**
- * @brief Destroys a zero.
- * @param zero - The zero to be destroyed.
+ * @brief Reads values of a dense matrix spaced by a fixed stride, negated.
+ * @param matrix - The matrix.
+ * @param start  - Index of the first value.
+ * @param stride - Distance between two values.
+ * @param count  - Number of values.
+ * @param buffer - Array that will hold the negated values.
  */
-static void DestroyZero(Zero* zero) { free(zero); }
+static void ReadNegatedValues(const DenseMatrix* matrix, size_t start,
+                              size_t stride, int count, double* buffer) {
+  switch (matrix->type) {
+    case DENSE_INT32: {
+      const int* values = (const int*)matrix->data + start;
+      for (int k = 0; k < count; k++) {
+        buffer[k] = -(double)values[k * stride];
+      }
+      break;
+    }
+    case DENSE_INT64: {
+      const long long* values = (const long long*)matrix->data + start;
+      for (int k = 0; k < count; k++) {
+        buffer[k] = -(double)values[k * stride];
+      }
+      break;
+    }
+    default: {
+      const double* values = (const double*)matrix->data + start;
+      for (int k = 0; k < count; k++) {
+        buffer[k] = -values[k * stride];
+      }
+      break;
+    }
+  }
+}
 
 /**
- * @brief Checks if a specific cell in the matrix is covered.
- * @param zero        - Pointer to the structure representing the zero to be
- checked.
- * @param coveredRows - Pointer to an array of integers indicating which rows
- are covered (assigned).
- * @param coveredCols - Pointer to an array of integers indicating which columns
- are covered (assigned).
- * @retval `true` if the cell is covered, `false` otherwise.
+ * @brief  Gets the negated values of a row of a `DenseMatrix`, for
+ *         `LapCost`.
+ * @param  context - The `DenseMatrix`.
+ * @param  row     - The row.
+ * @param  buffer  - Array that will hold the costs of the row.
+ * @retval `buffer`.
  */
-static bool IsCovered(static Zero* zero, int* coveredRows, int* coveredCols) {
-  return coveredRows[zero->row] || coveredCols[zero->col];
+static const double* GetDenseMatrixRow(void* context, int row,
+                                       double* buffer) {
+  const DenseMatrix* matrix = context;
+  ReadNegatedValues(matrix, (size_t)row * matrix->width, 1, matrix->width,
+                    buffer);
+  return buffer;
 }
 
 /**
- * @brief Marks a specific element in the matrix as covered, updating the arrays
- * of covered rows and columns.
- * @param zero        - Pointer to the structure representing the zero to be
- * covered.
- * @param coveredRows - Pointer to an array of integers indicating which rows
- * are covered (assigned).
- * @param coveredCols - Pointer to an array of integers indicating which columns
- * are covered (assigned).
+ * @brief  Gets the negated values of a column of a `DenseMatrix`, for the
+ *         `LapCost` of a tall matrix.
+ * @param  context - The `DenseMatrix`.
+ * @param  col     - The column.
+ * @param  buffer  - Array that will hold the costs of the column.
+ * @retval `buffer`.
  */
-static void CoverZero(static Zero* zero, int* coveredRows, int* coveredCols) {
-  coveredRows[zero->row] = 1;
-  coveredCols[zero->col] = 1;
+static const double* GetDenseMatrixColumn(void* context, int col,
+                                          double* buffer) {
+  const DenseMatrix* matrix = context;
+  ReadNegatedValues(matrix, (size_t)col, (size_t)matrix->width,
+                    matrix->height, buffer);
+  return buffer;
 }
 
 /**
- * @brief Counts the number of zeros in the matrix.
- * @param matrix - Pointer to the matrix representing the problem.
- * @retval The number of zeros found in the matrix.
+ * @brief  Fills the costs of a matrix: its values negated, row by row,
+ *         transposed if the matrix has more rows than columns. Missing
+ *         elements cost 0.
+ * @param  matrix - Pointer to the input matrix.
+ * @param  costs  - The costs, with room for every cell of the matrix.
+ * @retval `INVALID_MATRIX_OR_INDICES` - An element is outside the matrix.
+ * @retval `SUCCESS`                   - Operation successful.
  */
-static int CountZeros(Matrix* matrix) {
-  int count = 0;
+static int FillCostMatrix(const Matrix* matrix, CostMatrix* costs) {
+  int transposed = matrix->height > matrix->width;
+  costs->width = transposed ? matrix->height : matrix->width;
+  costs->height = transposed ? matrix->width : matrix->height;
+  memset(costs->costs, 0,
+         (size_t)matrix->width * matrix->height * sizeof(double));
+
+  // Position of a cell in `costs`: row * rowStride + col * colStride
+  size_t rowStride = transposed ? 1 : (size_t)costs->width;
+  size_t colStride = transposed ? (size_t)costs->width : 1;
+  int row = 0;
   for (MatrixRowNode* rowNode = matrix->head; rowNode != NULL;
-       rowNode = rowNode->nextRow) {
+       rowNode = rowNode->nextRow, row++) {
+    if (row >= matrix->height) {
+      return INVALID_MATRIX_OR_INDICES;
+    }
     for (MatrixElement* element = rowNode->row; element != NULL;
          element = element->nextCol) {
-      if (element->value == 0) {
-        count++;
+      if (element->column < 0 || element->column >= matrix->width) {
+        return INVALID_MATRIX_OR_INDICES;
       }
+      costs->costs[row * rowStride + element->column * colStride] =
+          -(double)element->value;
     }
   }
-  return count;
+
+  return SUCCESS;
 }
 
 /**
- * @brief Inverts the sign of all elements in the matrix, turning positive
- * values into negative and vice versa.
- * @param matrix - Pointer to the matrix representing the problem.
+ * @brief  Creates the costs of a matrix, see `FillCostMatrix`.
+ * @param  matrix - Pointer to the input matrix.
+ * @param  costs  - The new costs.
+ * @retval `INVALID_MATRIX_OR_INDICES` - An element is outside the matrix.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
  */
-static void NegateAllElements(Matrix* matrix) {
-  for (MatrixRowNode* rowNode = matrix->head; rowNode != NULL;
-       rowNode = rowNode->nextRow) {
-    for (MatrixElement* element = rowNode->row; element != NULL;
+static int CreateCostMatrix(const Matrix* matrix, CostMatrix* costs) {
+  costs->costs = malloc((size_t)matrix->width * matrix->height *
+                        sizeof(double));
+  if (costs->costs == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  int status = FillCostMatrix(matrix, costs);
+  if (status != SUCCESS) {
+    free(costs->costs);
+  }
+  return status;
+}
+
+/**
+ * @brief  Checks a linked-list matrix and keeps the node of each row, to
+ *         read its rows in place.
+ * @param  matrix - Pointer to the input matrix.
+ * @param  rows   - The rows; free `rows->rows` when done.
+ * @retval `INVALID_MATRIX_OR_INDICES` - An element is outside the matrix, or
+ *                                       a row is missing.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int CreateMatrixRows(const Matrix* matrix, MatrixRows* rows) {
+  rows->width = matrix->width;
+  rows->cols =
+      matrix->height > matrix->width ? matrix->height : matrix->width;
+  rows->rows = malloc((size_t)matrix->height * sizeof(MatrixRowNode*));
+  if (rows->rows == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  int row = 0;
+  for (const MatrixRowNode* rowNode = matrix->head; rowNode != NULL;
+       rowNode = rowNode->nextRow, row++) {
+    if (row >= matrix->height) {
+      break;
+    }
+    for (const MatrixElement* element = rowNode->row; element != NULL;
          element = element->nextCol) {
-      element->value = -element->value;
+      if (element->column < 0 || element->column >= matrix->width) {
+        row = -1;
+        break;
+      }
     }
+    if (row < 0) {
+      break;
+    }
+    rows->rows[row] = rowNode;
+  }
+
+  if (row != matrix->height) {
+    free(rows->rows);
+    return INVALID_MATRIX_OR_INDICES;
   }
+  return SUCCESS;
 }
 
 /**
- * @brief Makes all values in the matrix non-negative by subtracting the minimum
- * value of the matrix from all elements.
- * @param matrix - Pointer to the matrix representing the problem.
+ * @brief  Solves the minimization problem given by the costs.
+ * @param  cost        - The costs.
+ * @param  columnStart - Initial column potentials of a square problem, or
+ *                       NULL to start from scratch.
+ * @param  threadCount - Number of threads of the shortest path searches.
+ * @param  state       - The optimal assignment and potentials; free it with
+ *                       `FreeLapState`.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `NO_FEASIBLE_ASSIGNMENT`    - No assignment covers every row.
+ * @retval `SUCCESS`                   - Operation successful.
  */
-static void MakeMatrixNonnegative(Matrix* matrix) {
-  int minValue = INT_MAX;
-  for (MatrixRowNode* rowNode = matrix->head; rowNode != NULL;
-       rowNode = rowNode->nextRow) {
-    for (MatrixElement* element = rowNode->row; element != NULL;
-         element = element->nextCol) {
-      minValue = element->value < minValue ? element->value : minValue;
+static int SolveCosts(const LapCost* cost, const long long* columnStart,
+                      int threadCount, LapState** state) {
+  LapWorkspace* workspace = NULL;
+  LapState* newState = NULL;
+  if (CreateLapWorkspace(cost->rows, cost->cols, &workspace) != SUCCESS ||
+      CreateLapState(cost->rows, cost->cols, &newState) != SUCCESS ||
+      LapEnableThreads(workspace, threadCount) != SUCCESS) {
+    FreeLapWorkspace(workspace);
+    FreeLapState(newState);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  int status;
+  if (columnStart == NULL) {
+    status = SolveLap(cost, workspace, newState);
+  } else {
+    for (int j = 0; j < cost->cols; j++) {
+      newState->v[j] = (double)columnStart[j];
     }
+    LapAssignTightCells(cost, workspace, newState);
+    status = LapAugmentFreeRows(cost, workspace, newState);
   }
-  if (minValue < 0) {
-    for (MatrixRowNode* rowNode = matrix->head; rowNode != NULL;
-         rowNode = rowNode->nextRow) {
-      for (MatrixElement* element = rowNode->row; element != NULL;
-           element = element->nextCol) {
-        element->value -= minValue;
-      }
+  FreeLapWorkspace(workspace);
+
+  if (status != SUCCESS) {
+    FreeLapState(newState);
+    return status;
+  }
+
+  *state = newState;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Adds the chosen elements of an assignment to a result, in the row
+ *         order of the original matrix.
+ * @param  cost       - The costs; each value is the negated cost of its
+ *                      cell.
+ * @param  state      - The optimal assignment.
+ * @param  transposed - Whether the rows of the costs are the columns of the
+ *                      original matrix.
+ * @param  buffer     - Array of `cost->cols` doubles for `cost->getRow`.
+ * @param  selection  - The result.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int AddFinalSolution(const LapCost* cost, const LapState* state,
+                            int transposed, double* buffer,
+                            AssignmentResult* selection) {
+  int status = SUCCESS;
+  int originalRows = transposed ? cost->cols : cost->rows;
+  for (int row = 0; row < originalRows && status == SUCCESS; row++) {
+    int costRow = transposed ? state->colToRow[row] : row;
+    if (costRow < 0) {
+      continue;
     }
+    int costCol = transposed ? row : state->rowToCol[row];
+    const double* costs = cost->getRow(cost->context, costRow, buffer);
+    status = AddAssignment(selection, row, transposed ? costRow : costCol,
+                           -costs[costCol]);
   }
+  return status;
 }
 
 /**
- * @brief Subtracts the minimum value of each row from all elements in the same
- * row, making all values positive.
- * @param matrix - Pointer to the matrix representing the problem.
+ * @brief  Creates the result of an assignment, in the row order of the
+ *         original matrix.
+ * @param  cost       - The costs; each value is the negated cost of its
+ *                      cell.
+ * @param  state      - The optimal assignment.
+ * @param  transposed - Whether the rows of the costs are the columns of the
+ *                      original matrix.
+ * @param  result     - Pointer to store the chosen elements.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
  */
-static void SubtractRowMinima(Matrix* matrix) {
-  for (MatrixRowNode* rowNode = matrix->head; rowNode != NULL;
-       rowNode = rowNode->nextRow) {
-    int minRowValue = INT_MAX;
-    for (MatrixElement* element = rowNode->row; element != NULL;
-         element = element->nextCol) {
-      minRowValue = element->value < minRowValue ? element->value : minRowValue;
+static int ExtractFinalSolution(const LapCost* cost, const LapState* state,
+                                int transposed, AssignmentResult** result) {
+  AssignmentResult* selection = NULL;
+  double* buffer = malloc((size_t)cost->cols * sizeof(double));
+  if (buffer == NULL ||
+      CreateAssignmentResult(cost->rows, &selection) != SUCCESS) {
+    free(buffer);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  int status = AddFinalSolution(cost, state, transposed, buffer, selection);
+  free(buffer);
+
+  if (status != SUCCESS) {
+    FreeAssignmentResult(selection);
+    return status;
+  }
+
+  *result = selection;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Solves the minimization problem given by the costs with the
+ *         bitmask solver, without a workspace, and creates its result.
+ * @param  cost       - The costs, with at most `SMALL_SOLVE_MAX_SIZE`
+ *                      columns.
+ * @param  transposed - Whether the rows of the costs are the columns of the
+ *                      original matrix.
+ * @param  result     - Pointer to store the chosen elements.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `NO_FEASIBLE_ASSIGNMENT`    - No assignment covers every row.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int SolveSmallCost(const LapCost* cost, int transposed,
+                          AssignmentResult** result) {
+  int rowToCol[SMALL_SOLVE_MAX_SIZE];
+  int colToRow[SMALL_SOLVE_MAX_SIZE];
+  LapState state = {cost->rows, cost->cols, NULL, NULL, rowToCol, colToRow};
+  int status = SolveSmallLap(cost, &state);
+  if (status != SUCCESS) {
+    return status;
+  }
+  return ExtractFinalSolution(cost, &state, transposed, result);
+}
+
+/**
+ * @brief  Solves a matrix, optionally starting from column potentials.
+ * @param  matrix      - Pointer to the input matrix.
+ * @param  columnStart - Initial column potentials of the negated matrix, or
+ *                       NULL.
+ * @param  threadCount - Number of threads of the shortest path searches.
+ * @param  result      - Pointer to store the chosen elements.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int SolveMatrix(Matrix* matrix, const long long* columnStart,
+                       int threadCount, AssignmentResult** result) {
+  CostMatrix costs;
+  int status = CreateCostMatrix(matrix, &costs);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  LapCost cost = {costs.height, costs.width, GetCostMatrixRow, &costs};
+  int transposed = matrix->height > matrix->width;
+  if (columnStart == NULL && costs.width <= SMALL_SOLVE_DISPATCH_SIZE) {
+    status = SolveSmallCost(&cost, transposed, result);
+    free(costs.costs);
+    return status;
+  }
+
+  LapState* state = NULL;
+  status = SolveCosts(&cost, columnStart, threadCount, &state);
+  if (status == SUCCESS) {
+    status = ExtractFinalSolution(&cost, state, transposed, result);
+    FreeLapState(state);
+  }
+
+  free(costs.costs);
+  return status;
+}
+
+/**
+ * @brief  Solves a linked-list matrix reading its rows in place. A matrix
+ *         with more rows than columns is padded with columns of cost 0, so
+ *         the rows left on them are the ones without an element.
+ * @param  matrix - Pointer to the input matrix.
+ * @param  result - Pointer to store the chosen elements.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int SolveMatrixInPlace(const Matrix* matrix,
+                              AssignmentResult** result) {
+  MatrixRows rows;
+  int status = CreateMatrixRows(matrix, &rows);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  LapCost cost = {matrix->height, rows.cols, GetMatrixRowsRow, &rows};
+  int smallRowToCol[SMALL_SOLVE_MAX_SIZE];
+  int smallColToRow[SMALL_SOLVE_MAX_SIZE];
+  LapState smallState = {cost.rows, cost.cols,     NULL,
+                         NULL,      smallRowToCol, smallColToRow};
+  LapState* state = &smallState;
+  if (cost.cols <= SMALL_SOLVE_DISPATCH_SIZE) {
+    status = SolveSmallLap(&cost, state);
+  } else {
+    status = SolveCosts(&cost, NULL, 1, &state);
+  }
+
+  // Each chosen value is read back from the elements of its row
+  AssignmentResult* selection = NULL;
+  if (status == SUCCESS) {
+    status = CreateAssignmentResult(
+        matrix->height < matrix->width ? matrix->height : matrix->width,
+        &selection);
+  }
+  for (int row = 0; row < matrix->height && status == SUCCESS; row++) {
+    int col = state->rowToCol[row];
+    if (col >= matrix->width) {
+      continue;
     }
-    for (MatrixElement* element = rowNode->row; element != NULL;
+    int value = 0;
+    for (const MatrixElement* element = rows.rows[row]->row; element != NULL;
          element = element->nextCol) {
-      element->value -= minRowValue;
+      if (element->column == col) {
+        value = element->value;
+      }
     }
+    status = AddAssignment(selection, row, col, value);
   }
+
+  if (state != &smallState) {
+    FreeLapState(state);
+  }
+  free(rows.rows);
+  if (status != SUCCESS) {
+    FreeAssignmentResult(selection);
+    return status;
+  }
+
+  *result = selection;
+  return SUCCESS;
 }
 
 /**
- * @brief Subtracts the minimum value of each column from all elements in the
- * same column, making all values positive.
- * @param matrix - Pointer to the matrix representing the problem.
+ * @brief  Prepares the costs of a dense matrix, read in place: by rows, or
+ *         by columns with a stride if the matrix has more rows than columns.
+ * @param  matrix - Pointer to the input matrix.
+ * @param  cost   - The costs.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is empty, has no data or
+ *                                       holds a value that is not finite.
+ * @retval `SUCCESS`                   - Operation successful.
  */
-static void SubtractColumnMinima(Matrix* matrix) {
-  for (int col = 0; col < matrix->width; col++) {
-    int minColValue = INT_MAX;
-    // Find the minimum value in the current column
-    for (MatrixRowNode* rowNode = matrix->head; rowNode != NULL;
-         rowNode = rowNode->nextRow) {
-      const MatrixElement* element = GetElementCol(rowNode, col);
-      if (element != NULL && element->value < minColValue) {
-        minColValue = element->value;
-      }
-    }
-    // Subtract the minimum value from all elements in the column
-    for (MatrixRowNode* rowNode = matrix->head; rowNode != NULL;
-         rowNode = rowNode->nextRow) {
-      MatrixElement* element = GetElementCol(rowNode, col);
-      if (element != NULL) {
-        element->value -= minColValue;
+static int PrepareDenseCost(const DenseMatrix* matrix, LapCost* cost) {
+  if (matrix->data == NULL || matrix->width <= 0 || matrix->height <= 0) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  if (matrix->type == DENSE_FLOAT64) {
+    const double* values = matrix->data;
+    size_t count = (size_t)matrix->width * matrix->height;
+    for (size_t k = 0; k < count; k++) {
+      if (!isfinite(values[k])) {
+        return INVALID_MATRIX_OR_INDICES;
       }
     }
   }
+
+  cost->context = (void*)matrix;
+  if (matrix->height > matrix->width) {
+    cost->rows = matrix->width;
+    cost->cols = matrix->height;
+    cost->getRow = GetDenseMatrixColumn;
+  } else {
+    cost->rows = matrix->height;
+    cost->cols = matrix->width;
+    cost->getRow = GetDenseMatrixRow;
+  }
+  return SUCCESS;
 }
 
 /**
- * @brief Checks if the current solution is optimal, i.e., if all rows and
- * columns of the matrix are covered.
- * @param matrix - Pointer to the matrix representing the problem.
- * @retval `true` if the current solution is optimal, `false` otherwise.
+ * @brief  Solves the minimization problem given by the costs with the
+ *         arrays of a workspace, and adds its chosen elements to a result.
+ * @param  cost       - The costs, within the size of the workspace.
+ * @param  transposed - Whether the rows of the costs are the columns of the
+ *                      original matrix.
+ * @param  workspace  - The workspace.
+ * @param  result     - The result, which is cleared first.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `NO_FEASIBLE_ASSIGNMENT`    - No assignment covers every row.
+ * @retval `SUCCESS`                   - Operation successful.
  */
-static bool IsOptimalSolution(Matrix* matrix) {
-  int numRows = matrix->height;
-  int numCols = matrix->width;
-  int* coveredRows = (int*)calloc(numRows, sizeof(int));
-  int* coveredCols = (int*)calloc(numCols, sizeof(int));
+static int SolveWithWorkspace(const LapCost* cost, int transposed,
+                              SolverWorkspace* workspace,
+                              AssignmentResult* result) {
+  ClearAssignmentResult(result);
+  int status = cost->cols <= SMALL_SOLVE_DISPATCH_SIZE
+                   ? SolveSmallLap(cost, workspace->state)
+                   : SolveLap(cost, workspace->lap, workspace->state);
+  if (status != SUCCESS) {
+    return status;
+  }
+  return AddFinalSolution(cost, workspace->state, transposed,
+                          workspace->lap->rowBuffer, result);
+}
 
-  // Mark rows and columns covered by lines
-  for (MatrixRowNode* rowNode = matrix->head; rowNode != NULL;
-       rowNode = rowNode->nextRow) {
-    for (MatrixElement* element = rowNode->row; element != NULL;
-         element = element->nextCol) {
-      int rowIdx = GetRowIndex(matrix, rowNode);  // Get the row index
-      int colIdx = element->column;               // Get the column index
-      if (element->value == 0 && !coveredRows[rowIdx] && !coveredCols[colIdx]) {
-        coveredRows[rowIdx] = 1;
-        coveredCols[colIdx] = 1;
-      }
-    }
+/**
+ * @brief  Solves the minimization problem given by the costs until a
+ *         deadline or a number of searches, and creates its result. If the
+ *         solve stops early, the rows left are assigned greedily and the
+ *         column potentials reached so far bound the optimum.
+ * @param  cost           - The costs.
+ * @param  transposed     - Whether the rows of the costs are the columns of
+ *                          the original matrix.
+ * @param  deadline       - Time after which no search starts, or 0.
+ * @param  iterationLimit - Searches allowed, or 0 for no limit.
+ * @param  result         - Pointer to store the chosen elements.
+ * @param  gap            - Pointer to store the gap of the result, or NULL.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `NO_FEASIBLE_ASSIGNMENT`    - No assignment covers every row.
+ * @retval `TIME_LIMIT_REACHED`        - The solve stopped early; the result
+ *                                       is feasible but may not be optimal.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int SolveCostsWithBudget(const LapCost* cost, int transposed,
+                                double deadline, int iterationLimit,
+                                AssignmentResult** result,
+                                AssignmentGap* gap) {
+  LapWorkspace* workspace = NULL;
+  LapState* state = NULL;
+  if (CreateLapWorkspace(cost->rows, cost->cols, &workspace) != SUCCESS ||
+      CreateLapState(cost->rows, cost->cols, &state) != SUCCESS) {
+    FreeLapWorkspace(workspace);
+    FreeLapState(state);
+    return MEMORY_ALLOCATION_FAILURE;
   }
+  workspace->deadline = deadline;
+  workspace->searchLimit = iterationLimit;
 
-  // Count the number of covered rows and columns
-  int numCoveredRows = 0;
-  int numCoveredCols = 0;
-  for (int i = 0; i < numRows; i++) {
-    if (coveredRows[i]) {
-      numCoveredRows++;
-    }
+  int status = SolveLap(cost, workspace, state);
+  int stopped = status == TIME_LIMIT_REACHED;
+  double upperBound = 0.0;
+  if (stopped) {
+    // The values are the negated costs, so a lower bound on the costs is an
+    // upper bound on the values
+    upperBound = -LapLowerBound(cost, workspace, state);
+    status = LapCompleteGreedily(cost, workspace, state);
   }
-  for (int j = 0; j < numCols; j++) {
-    if (coveredCols[j]) {
-      numCoveredCols++;
-    }
+  FreeLapWorkspace(workspace);
+
+  if (status == SUCCESS) {
+    status = ExtractFinalSolution(cost, state, transposed, result);
+  }
+  FreeLapState(state);
+  if (status != SUCCESS) {
+    return status;
   }
 
-  // Free memory
-  free(coveredRows);
-  free(coveredCols);
+  SetAssignmentGap(gap, stopped ? upperBound : (*result)->totalValue,
+                   *result);
+  return stopped ? TIME_LIMIT_REACHED : SUCCESS;
+}
 
-  // Check if the number of covered rows or columns equals the matrix size
-  return numCoveredRows == numRows || numCoveredCols == numCols;
+/**
+ * @brief Copies a solution into the state of the engine, which works on the
+ *        negated values and on the transposed matrix when it is tall.
+ * @param solution   - The solution.
+ * @param transposed - Whether the rows of the costs are the columns of the
+ *                     matrix.
+ * @param state      - The state.
+ */
+static void LoadSolution(const HungarianSolution* solution, int transposed,
+                         LapState* state) {
+  const int* rowToCol = transposed ? solution->colToRow : solution->rowToCol;
+  const double* rowPotentials =
+      transposed ? solution->colPotentials : solution->rowPotentials;
+  const double* colPotentials =
+      transposed ? solution->rowPotentials : solution->colPotentials;
+
+  for (int i = 0; i < state->rows; i++) {
+    state->rowToCol[i] = rowToCol[i];
+    state->u[i] = -rowPotentials[i];
+  }
+  for (int j = 0; j < state->cols; j++) {
+    state->v[j] = -colPotentials[j];
+  }
 }
 
 /**
- * @brief Prints the coverage status of rows and columns in the matrix.
- * @param coveredRows    - Pointer to an array of booleans indicating which rows
- * are covered (assigned).
- * @param coveredCols    - Pointer to an array of booleans indicating which
- * columns are covered (assigned).
- * @param numRows        - Number of rows in the matrix.
- * @param numCols        - Number of columns in the matrix.
+ * @brief Copies the state of the engine into a solution.
+ * @param state      - The state.
+ * @param transposed - Whether the rows of the costs are the columns of the
+ *                     matrix.
+ * @param solution   - The solution.
  */
-static void PrintCoveredStatus(bool* coveredRows, bool* coveredCols,
-                               int numRows, int numCols) {
-  printf("Covered Status:\n");
-  printf("Rows: ");
-  for (int i = 0; i < numRows; i++) {
-    printf("%d ", coveredRows[i] ? 1 : 0);
+static void StoreSolution(const LapState* state, int transposed,
+                          HungarianSolution* solution) {
+  int* rowToCol = transposed ? solution->colToRow : solution->rowToCol;
+  int* colToRow = transposed ? solution->rowToCol : solution->colToRow;
+  double* rowPotentials =
+      transposed ? solution->colPotentials : solution->rowPotentials;
+  double* colPotentials =
+      transposed ? solution->rowPotentials : solution->colPotentials;
+
+  // Assigned cells are tight, so each chosen value is the sum of the
+  // potentials of its row and column
+  solution->totalValue = 0.0;
+  for (int i = 0; i < state->rows; i++) {
+    rowToCol[i] = state->rowToCol[i];
+    rowPotentials[i] = -state->u[i];
+    solution->totalValue -= state->u[i] + state->v[state->rowToCol[i]];
   }
-  printf("\nColumns: ");
-  for (int j = 0; j < numCols; j++) {
-    printf("%d ", coveredCols[j] ? 1 : 0);
+  for (int j = 0; j < state->cols; j++) {
+    colToRow[j] = state->colToRow[j];
+    colPotentials[j] = -state->v[j];
   }
-  printf("\n");
 }
 
 /**
- * @brief Prints the covered matrix, indicating which rows and columns are
- * covered.
- * @param coveredRows    - Pointer to an array of booleans indicating which rows
- * are covered (assigned).
- * @param coveredCols    - Pointer to an array of booleans indicating which
- * columns are covered (assigned).
- * @param numRows        - Number of rows in the matrix.
- * @param numCols        - Number of columns in the matrix.
+ * @brief  Solves the costs into a solution, either from scratch or starting
+ *         from the assignment and potentials already in the solution.
+ * @param  cost       - The costs.
+ * @param  transposed - Whether the rows of the costs are the columns of the
+ *                      matrix.
+ * @param  warmStart  - Whether to start from the solution.
+ * @param  solution   - The solution, overwritten with the optimal one.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `NO_FEASIBLE_ASSIGNMENT`    - No assignment covers every row.
+ * @retval `SUCCESS`                   - Operation successful.
  */
-static void PrintCoveredMatrix(bool* coveredRows, bool* coveredCols,
-                               int numRows, int numCols) {
-  printf("Covered Matrix:\n");
-  for (int row = 0; row < numRows; row++) {
-    for (int col = 0; col < numCols; col++) {
-      // Check if the row or column is covered
-      bool isCovered = coveredRows[row] || coveredCols[col];
-      // Print the cell status
-      printf("%s ", isCovered ? "X" : "-");
-    }
-    printf("\n");
-  }
-}
-
-/**
- * @brief Covers zeros in the matrix, identifying if there are multiple zeros in
- * the same row or column.
- * @param matrix         - Pointer to the matrix representing the problem.
- * @param coveredRows    - Pointer to an array of booleans indicating which rows
- * are covered (assigned).
- * @param coveredCols    - Pointer to an array of booleans indicating which
- * columns are covered (assigned).
- */
-static void CoverZeros(Matrix* matrix, bool** coveredRows, bool** coveredCols) {
-  int numRows = matrix->height;
-  int numCols = matrix->width;
-
-  if (*coveredRows == NULL || *coveredCols == NULL) {
-    exit(MEMORY_ALLOCATION_FAILURE);
-  }
-
-  // Iterate through the matrix and find zeros that are not covered
-  for (int row = 0; row < numRows; row++) {
-    for (int col = 0; col < numCols; col++) {
-      if (!(*coveredRows)[row] && !(*coveredCols)[col] &&
-          GetElementCol(GetRowNode(matrix, row), col)->value == 0) {
-        // Check if there are more zeros in the same column
-        bool multipleZerosInColumn = false;
-        for (int r = 0; r < numRows; r++) {
-          if (r != row &&
-              GetElementCol(GetRowNode(matrix, r), col)->value == 0) {
-            multipleZerosInColumn = true;
-            break;
-          }
-        }
-
-        // Check if there are more zeros in the same row
-        bool multipleZerosInRow = false;
-        for (int c = 0; c < numCols; c++) {
-          if (c != col &&
-              GetElementCol(GetRowNode(matrix, row), c)->value == 0) {
-            multipleZerosInRow = true;
-            break;
-          }
-        }
-
-        // If there are more zeros in the same column, cover the column
-        if (multipleZerosInColumn) {
-          (*coveredCols)[col] = true;
-        }
-        // If there are more zeros in the same row, cover the row
-        else if (multipleZerosInRow) {
-          (*coveredRows)[row] = true;
-        } else {
-          // If there is only one zero, do not cover the row or column
-        }
-      }
-    }
+static int SolveIntoSolution(const LapCost* cost, int transposed,
+                             int warmStart, HungarianSolution* solution) {
+  LapWorkspace* workspace = NULL;
+  LapState* state = NULL;
+  if (CreateLapWorkspace(cost->rows, cost->cols, &workspace) != SUCCESS ||
+      CreateLapState(cost->rows, cost->cols, &state) != SUCCESS) {
+    FreeLapWorkspace(workspace);
+    return MEMORY_ALLOCATION_FAILURE;
   }
+
+  int status;
+  if (warmStart) {
+    LoadSolution(solution, transposed, state);
+    LapRepairState(cost, workspace, state);
+    status = LapAugmentFreeRows(cost, workspace, state);
+  } else {
+    status = SolveLap(cost, workspace, state);
+  }
+  if (status == SUCCESS) {
+    StoreSolution(state, transposed, solution);
+  }
+
+  FreeLapWorkspace(workspace);
+  FreeLapState(state);
+  return status;
 }
 
 /**
- * @brief Creates additional zeros in the matrix, adjusting the values of the
- * elements to ensure the existence of a zero in each row and column.
- * @param matrix         - Pointer to the matrix representing the problem.
- * @param coveredRows    - Pointer to an array of booleans indicating which rows
- * are covered (assigned).
- * @param coveredCols    - Pointer to an array of booleans indicating which
- * columns are covered (assigned).
+ * @brief  Solves a matrix into a solution.
+ * @param  matrix    - Pointer to the input matrix.
+ * @param  warmStart - Whether to start from the solution.
+ * @param  solution  - The solution, overwritten with the optimal one.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
  */
-static void CreateAdditionalZeros(Matrix* matrix, bool* coveredRows,
-                                  bool* coveredCols) {
-  int numRows = matrix->height;
-  int numCols = matrix->width;
+static int SolveMatrixIntoSolution(Matrix* matrix, int warmStart,
+                                   HungarianSolution* solution) {
+  CostMatrix costs;
+  int status = CreateCostMatrix(matrix, &costs);
+  if (status != SUCCESS) {
+    return status;
+  }
 
-  // Find minimum value in uncovered elements
-  int minUncovered = INT_MAX;
-  for (int row = 0; row < numRows; row++) {
-    for (int col = 0; col < numCols; col++) {
-      if (!coveredRows[row] && !coveredCols[col] &&
-          GetElementCol(GetRowNode(matrix, row), col) != NULL &&
-          GetElementCol(GetRowNode(matrix, row), col)->value < minUncovered) {
-        minUncovered = GetElementCol(GetRowNode(matrix, row), col)->value;
-      }
-    }
+  LapCost cost = {costs.height, costs.width, GetCostMatrixRow, &costs};
+  status = SolveIntoSolution(&cost, matrix->height > matrix->width,
+                             warmStart, solution);
+  free(costs.costs);
+  return status;
+}
+
+/**
+ * @struct DynamicAssignment
+ * @brief Optimal solution of a matrix kept up to date as the matrix changes.
+ */
+struct DynamicAssignment {
+  Matrix* matrix;               // The tracked matrix
+  CostMatrix costs;             // Negated values, transposed if tall
+  HungarianSolution* solution;  // Optimal solution of the matrix
+};
+
+/**
+ * @brief  Maps an index of a row or column to its index after a row or
+ *         column was inserted or deleted.
+ * @param  index    - The index before the change.
+ * @param  inserted - Index of the inserted row or column, or -1.
+ * @param  deleted  - Index of the deleted row or column, or -1.
+ * @retval The index after the change, or -1 if it was deleted.
+ */
+static int MapIndex(int index, int inserted, int deleted) {
+  if (index == deleted) {
+    return -1;
   }
+  return index + (inserted >= 0 && index >= inserted) -
+         (deleted >= 0 && index > deleted);
+}
 
-  // Subtract this minimum value from all uncovered elements
-  for (int row = 0; row < numRows; row++) {
-    for (int col = 0; col < numCols; col++) {
-      if (!coveredRows[row] && !coveredCols[col] &&
-          GetElementCol(GetRowNode(matrix, row), col) != NULL) {
-        GetElementCol(GetRowNode(matrix, row), col)->value -= minUncovered;
-      }
-    }
+/**
+ * @brief  Restores the optimal solution of a tracked matrix after its costs
+ *         changed, starting from the current solution.
+ * @param  dynamic - The dynamic assignment.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int RepairDynamicAssignment(DynamicAssignment* dynamic) {
+  LapCost cost = {dynamic->costs.height, dynamic->costs.width,
+                  GetCostMatrixRow, &dynamic->costs};
+  return SolveIntoSolution(&cost,
+                           dynamic->matrix->height > dynamic->matrix->width,
+                           1, dynamic->solution);
+}
+
+/**
+ * @brief  Restores the optimal solution of a tracked matrix after a row or
+ *         column was inserted or deleted. The solution is moved to the new
+ *         size, keeping the matches and potentials of the rows and columns
+ *         that remain, and repaired from there.
+ * @param  dynamic     - The dynamic assignment.
+ * @param  insertedRow - Index of the inserted row, or -1.
+ * @param  deletedRow  - Index of the deleted row, or -1.
+ * @param  insertedCol - Index of the inserted column, or -1.
+ * @param  deletedCol  - Index of the deleted column, or -1.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int ResizeDynamicAssignment(DynamicAssignment* dynamic,
+                                   int insertedRow, int deletedRow,
+                                   int insertedCol, int deletedCol) {
+  const HungarianSolution* previous = dynamic->solution;
+  HungarianSolution* solution = NULL;
+  int status = CreateHungarianSolution(dynamic->matrix->width,
+                                       dynamic->matrix->height, &solution);
+  if (status != SUCCESS) {
+    return status;
   }
 
-  // Add this value to covered elements twice
-  for (int row = 0; row < numRows; row++) {
-    for (int col = 0; col < numCols; col++) {
-      if (coveredRows[row] && coveredCols[col] &&
-          GetElementCol(GetRowNode(matrix, row), col) != NULL) {
-        GetElementCol(GetRowNode(matrix, row), col)->value += minUncovered;
+  for (int col = 0; col < previous->width; col++) {
+    int newCol = MapIndex(col, insertedCol, deletedCol);
+    if (newCol >= 0) {
+      solution->colPotentials[newCol] = previous->colPotentials[col];
+    }
+  }
+  for (int row = 0; row < previous->height; row++) {
+    int newRow = MapIndex(row, insertedRow, deletedRow);
+    if (newRow < 0) {
+      continue;
+    }
+    solution->rowPotentials[newRow] = previous->rowPotentials[row];
+    if (previous->rowToCol[row] >= 0) {
+      int newCol = MapIndex(previous->rowToCol[row], insertedCol, deletedCol);
+      if (newCol >= 0) {
+        solution->rowToCol[newRow] = newCol;
+        solution->colToRow[newCol] = newRow;
       }
     }
   }
+
+  CostMatrix costs;
+  status = CreateCostMatrix(dynamic->matrix, &costs);
+  if (status != SUCCESS) {
+    FreeHungarianSolution(solution);
+    return status;
+  }
+
+  free(dynamic->costs.costs);
+  dynamic->costs = costs;
+  FreeHungarianSolution(dynamic->solution);
+  dynamic->solution = solution;
+  return RepairDynamicAssignment(dynamic);
 }
 
 /**
- * @brief Creates a copy of the provided matrix.
- * @param originalMatrix - Pointer to the original matrix to be copied.
- * @retval Pointer to the new copied matrix, or NULL in case of memory
-           allocation failure.
+ * @brief Implements the Hungarian algorithm, keeping the row and column of
+ *        each chosen element. Every row of a wide matrix and every column
+ *        of a tall one is assigned; a tall matrix is solved by columns.
+ * @param matrix - Pointer to the input matrix.
+ * @param result - Pointer to store the chosen elements.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix or the provided indices are
+ *                                       invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure for the new
+ *                                       matrix element.
+ * @retval `SUCCESS`                    - Operation successful.
  */
-static Matrix* CopyMatrix(Matrix* originalMatrix) {
-  Matrix* newMatrix = (Matrix*)malloc(sizeof(Matrix));
-  if (newMatrix == NULL) {
-    return NULL;
+int HungarianAssignment(Matrix* matrix, AssignmentResult** result) {
+  if (matrix == NULL || matrix->width <= 0 || matrix->height <= 0 ||
+      result == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
   }
 
-  newMatrix->width = originalMatrix->width;
-  newMatrix->height = originalMatrix->height;
-  newMatrix->head = NULL;
+  return SolveMatrix(matrix, NULL, 1, result);
+}
 
-  MatrixRowNode* originalRow = originalMatrix->head;
-  MatrixRowNode* newRow = NULL;
-  MatrixRowNode* lastNewRow = NULL;
-  while (originalRow != NULL) {
-    newRow = (MatrixRowNode*)malloc(sizeof(MatrixRowNode));
-    if (newRow == NULL) {
-      return NULL;
-    }
-    newRow->nextRow = NULL;
-
-    MatrixElement* originalElement = originalRow->row;
-    MatrixElement* newElement = NULL;
-    MatrixElement* lastNewElement = NULL;
-    while (originalElement != NULL) {
-      newElement = (MatrixElement*)malloc(sizeof(MatrixElement));
-      if (newElement == NULL) {
-        return NULL;
-      }
-      newElement->value = originalElement->value;
-      newElement->column = originalElement->column;
-      newElement->nextCol = NULL;
-
-      if (lastNewElement == NULL) {
-        newRow->row = newElement;
-      } else {
-        lastNewElement->nextCol = newElement;
-      }
-      lastNewElement = newElement;
+/**
+ * @brief Implements the Hungarian algorithm reading the values of the
+ *        matrix in place, without copying them. The result is as optimal
+ *        as the one of `HungarianAssignment`.
+ * @param matrix - Pointer to the input matrix, which is not changed.
+ * @param result - Pointer to store the chosen elements.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int HungarianAssignmentInPlace(const Matrix* matrix,
+                               AssignmentResult** result) {
+  if (matrix == NULL || matrix->width <= 0 || matrix->height <= 0 ||
+      result == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
 
-      originalElement = originalElement->nextCol;
-    }
+  return SolveMatrixInPlace(matrix, result);
+}
 
-    if (lastNewRow == NULL) {
-      newMatrix->head = newRow;
-    } else {
-      lastNewRow->nextRow = newRow;
-    }
-    lastNewRow = newRow;
+/**
+ * @brief Implements the Hungarian algorithm with the memory of a workspace.
+ *        The result is the one of `HungarianAssignment`, but once the
+ *        workspace fits the matrix and the result has room for the chosen
+ *        elements, the solve makes no allocation.
+ * @param matrix    - Pointer to the input matrix.
+ * @param workspace - The workspace, grown if the matrix does not fit.
+ * @param result    - The result, created with `CreateAssignmentResult`;
+ *                    its previous elements are discarded.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int HungarianAssignmentWithWorkspace(Matrix* matrix,
+                                     SolverWorkspace* workspace,
+                                     AssignmentResult* result) {
+  if (matrix == NULL || matrix->width <= 0 || matrix->height <= 0 ||
+      workspace == NULL || result == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  if (ReserveSolverWorkspace(workspace, matrix->width, matrix->height) !=
+      SUCCESS) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
 
-    originalRow = originalRow->nextRow;
+  CostMatrix costs = {0, 0, workspace->costs};
+  int status = FillCostMatrix(matrix, &costs);
+  if (status != SUCCESS) {
+    return status;
   }
 
-  return newMatrix;
+  LapCost cost = {costs.height, costs.width, GetCostMatrixRow, &costs};
+  return SolveWithWorkspace(&cost, matrix->height > matrix->width, workspace,
+                            result);
 }
 
 /**
- * @brief Extracts the final solution of the problem, identifying the chosen
- *        elements and calculating the total sum.
- * @param originalMatrix - Pointer to the original matrix.
- * @param finalMatrix    - Pointer to the matrix after applying the algorithm.
- * @param chosenElements - Pointer to a pointer of integers, which will be
- *                         allocated and filled with the chosen elements.
- * @param result         - Pointer to an integer, which will be filled with the
- *                         result of the sum of the chosen elements.
+ * @brief Implements the Hungarian algorithm with a time and iteration
+ *        budget. When the budget runs out, the rows not assigned yet take
+ *        the best free column, and the gap says how far the result may be
+ *        from the optimum.
+ * @param matrix         - Pointer to the input matrix.
+ * @param timeLimit      - Seconds after which the solve stops, or 0 for no
+ *                         limit.
+ * @param iterationLimit - Shortest path searches after which the solve
+ *                         stops, or 0 for no limit.
+ * @param result         - Pointer to store the chosen elements.
+ * @param gap            - Pointer to store the gap of the result, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix or the limits are
+ *                                       invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `TIME_LIMIT_REACHED`        - The budget ran out; the result is
+ *                                       feasible but may not be optimal.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int HungarianAssignmentWithBudget(Matrix* matrix, double timeLimit,
+                                  int iterationLimit,
+                                  AssignmentResult** result,
+                                  AssignmentGap* gap) {
+  if (matrix == NULL || matrix->width <= 0 || matrix->height <= 0 ||
+      timeLimit < 0.0 || iterationLimit < 0 || result == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  double deadline = timeLimit > 0.0 ? GetMonotonicTime() + timeLimit : 0.0;
+  CostMatrix costs;
+  int status = CreateCostMatrix(matrix, &costs);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  LapCost cost = {costs.height, costs.width, GetCostMatrixRow, &costs};
+  status = SolveCostsWithBudget(&cost, matrix->height > matrix->width,
+                                deadline, iterationLimit, result, gap);
+  free(costs.costs);
+  return status;
+}
+
+/**
+ * @brief Implements the Hungarian algorithm starting from reductions that
+ *        were computed while the matrix was loaded. The reduced column minima
+ *        are feasible column potentials of the negated matrix, so the
+ *        Jonker-Volgenant initialization is replaced by a single pass that
+ *        assigns tight cells.
+ * @param matrix     - Pointer to the input matrix.
+ * @param reductions - Reductions of the matrix, from
+ *                     `CreateMatrixFromFileWithReductions`.
+ * @param result     - Pointer to store the chosen elements.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid or does not
+ *                                       match the reductions.
  * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure for the new
  *                                       matrix element.
  * @retval `SUCCESS`                    - Operation successful.
  */
-static int ExtractFinalSolution(Matrix* originalMatrix, Matrix* finalMatrix,
-                                int** chosenElements, int* result) {
-  int numRows = originalMatrix->height;
-  int numCols = originalMatrix->width;
-  int sum = 0;
-  int assignments = 0;
-  bool* coveredCols = (bool*)calloc(numCols, sizeof(bool));
-  if (coveredCols == NULL) {
-    return MEMORY_ALLOCATION_FAILURE;
+int HungarianAssignmentWithReductions(Matrix* matrix,
+                                      const MatrixReductions* reductions,
+                                      AssignmentResult** result) {
+  if (matrix == NULL || matrix->width <= 0 || matrix->height <= 0 ||
+      reductions == NULL || reductions->width != matrix->width ||
+      reductions->height != matrix->height || result == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
   }
 
-  *chosenElements = (int*)malloc(numRows * sizeof(int));
-  if (*chosenElements == NULL) {
-    free(coveredCols);
+  // The reduced column minima are only valid potentials when every column
+  // is assigned; rectangular matrices start from scratch
+  return SolveMatrix(matrix,
+                     matrix->width == matrix->height
+                         ? reductions->reducedColMin
+                         : NULL,
+                     1, result);
+}
+
+/**
+ * @brief Implements the Hungarian algorithm on a dense matrix, reading its
+ *        rows in place without building a `Matrix`.
+ * @param matrix - Pointer to the input matrix.
+ * @param result - Pointer to store the chosen elements.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix holds a value that is not
+ *                                       finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int HungarianAssignmentDense(const DenseMatrix* matrix,
+                             AssignmentResult** result) {
+  return HungarianAssignmentDenseParallel(matrix, 1, result);
+}
+
+/**
+ * @brief Implements the Hungarian algorithm on a dense matrix with the
+ *        memory of a workspace, see `HungarianAssignmentWithWorkspace`. The
+ *        rows are read in place, so the costs of the workspace are unused.
+ * @param matrix    - Pointer to the input matrix.
+ * @param workspace - The workspace, grown if the matrix does not fit.
+ * @param result    - The result; its previous elements are discarded.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix has no data or holds a
+ *                                       value that is not finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int HungarianAssignmentDenseWithWorkspace(const DenseMatrix* matrix,
+                                          SolverWorkspace* workspace,
+                                          AssignmentResult* result) {
+  LapCost cost;
+  if (matrix == NULL || workspace == NULL || result == NULL ||
+      PrepareDenseCost(matrix, &cost) != SUCCESS) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  if (ReserveSolverWorkspace(workspace, matrix->width, matrix->height) !=
+      SUCCESS) {
     return MEMORY_ALLOCATION_FAILURE;
   }
 
-  // Find the zeros
-  for (int row = 0; row < numRows; row++) {
-    for (int col = 0; col < numCols; col++) {
-      if (GetElementCol(GetRowNode(finalMatrix, row), col)->value == 0 &&
-          !coveredCols[col]) {
-        int assignmentValue =
-            GetElementCol(GetRowNode(originalMatrix, row), col)->value;
-        sum += assignmentValue;
-        assignments++;
-        coveredCols[col] = true;
-        (*chosenElements)[assignments - 1] = assignmentValue;
-        break;
-      }
-    }
+  return SolveWithWorkspace(&cost, matrix->height > matrix->width, workspace,
+                            result);
+}
+
+/**
+ * @brief Implements the Hungarian algorithm on a dense matrix with a time
+ *        and iteration budget, see `HungarianAssignmentWithBudget`.
+ * @param matrix         - Pointer to the input matrix.
+ * @param timeLimit      - Seconds after which the solve stops, or 0 for no
+ *                         limit.
+ * @param iterationLimit - Shortest path searches after which the solve
+ *                         stops, or 0 for no limit.
+ * @param result         - Pointer to store the chosen elements.
+ * @param gap            - Pointer to store the gap of the result, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The limits are invalid, or the
+ *                                       matrix has no data or holds a value
+ *                                       that is not finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `TIME_LIMIT_REACHED`        - The budget ran out; the result is
+ *                                       feasible but may not be optimal.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int HungarianAssignmentDenseWithBudget(const DenseMatrix* matrix,
+                                       double timeLimit, int iterationLimit,
+                                       AssignmentResult** result,
+                                       AssignmentGap* gap) {
+  LapCost cost;
+  if (matrix == NULL || timeLimit < 0.0 || iterationLimit < 0 ||
+      result == NULL || PrepareDenseCost(matrix, &cost) != SUCCESS) {
+    return INVALID_MATRIX_OR_INDICES;
   }
 
-  *result = sum;
+  double deadline = timeLimit > 0.0 ? GetMonotonicTime() + timeLimit : 0.0;
+  return SolveCostsWithBudget(&cost, matrix->height > matrix->width, deadline,
+                              iterationLimit, result, gap);
+}
 
-  free(coveredCols);
+/**
+ * @brief Implements the Hungarian algorithm with the column scan of each
+ *        shortest path search split among several threads. The result is
+ *        the same as the one of `HungarianAssignment`.
+ * @param matrix      - Pointer to the input matrix.
+ * @param threadCount - Number of threads, or 0 for one per processor.
+ * @param result      - Pointer to store the chosen elements.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int HungarianAssignmentParallel(Matrix* matrix, int threadCount,
+                                AssignmentResult** result) {
+  if (matrix == NULL || matrix->width <= 0 || matrix->height <= 0 ||
+      result == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
 
-  return SUCCESS;
+  return SolveMatrix(matrix, NULL,
+                     threadCount > 0 ? threadCount : GetProcessorCount(),
+                     result);
+}
+
+/**
+ * @brief Implements the Hungarian algorithm on a dense matrix with the
+ *        column scan of each shortest path search split among several
+ *        threads. The result is the same as the one of
+ *        `HungarianAssignmentDense`.
+ * @param matrix      - Pointer to the input matrix.
+ * @param threadCount - Number of threads, or 0 for one per processor.
+ * @param result      - Pointer to store the chosen elements.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix holds a value that is not
+ *                                       finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int HungarianAssignmentDenseParallel(const DenseMatrix* matrix,
+                                     int threadCount,
+                                     AssignmentResult** result) {
+  LapCost cost;
+  if (matrix == NULL || matrix->data == NULL || result == NULL ||
+      PrepareDenseCost(matrix, &cost) != SUCCESS) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  if (cost.cols <= SMALL_SOLVE_DISPATCH_SIZE) {
+    return SolveSmallCost(&cost, matrix->height > matrix->width, result);
+  }
+
+  LapState* state = NULL;
+  int status = SolveCosts(&cost, NULL,
+                          threadCount > 0 ? threadCount : GetProcessorCount(),
+                          &state);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  status = ExtractFinalSolution(&cost, state,
+                                matrix->height > matrix->width, result);
+  FreeLapState(state);
+  return status;
 }
 
 /**
@@ -522,48 +1140,423 @@ static int ExtractFinalSolution(Matrix* originalMatrix, Matrix* finalMatrix,
  * @retval `SUCCESS`                    - Operation successful.
  */
 int HungarianAlgorithm(Matrix* matrix, int** chosenElements, int* result) {
-  Matrix* matrixCopy = CopyMatrix(matrix);
-  if (matrixCopy == NULL) {
-    return MEMORY_ALLOCATION_FAILURE;
+  AssignmentResult* selection = NULL;
+  int status = HungarianAssignment(matrix, &selection);
+  if (status != SUCCESS) {
+    return status;
   }
 
-  int numRows = matrixCopy->height;
-  int numCols = matrixCopy->width;
+  *chosenElements = (int*)malloc(matrix->height * sizeof(int));
+  if (*chosenElements == NULL) {
+    FreeAssignmentResult(selection);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
 
-  NegateAllElements(matrixCopy);
+  int sum = 0;
+  for (int i = 0; i < selection->count; i++) {
+    (*chosenElements)[i] = (int)selection->values[i];
+    sum += (*chosenElements)[i];
+  }
+  *result = sum;
 
-  MakeMatrixNonnegative(matrixCopy);
+  FreeAssignmentResult(selection);
 
-  SubtractRowMinima(matrixCopy);
+  return SUCCESS;
+}
 
-  SubtractColumnMinima(matrixCopy);
+/**
+ * @brief  Creates an empty solution for a matrix: no element chosen and
+ *         every potential set to zero.
+ * @param  width    - The number of columns of the matrix.
+ * @param  height   - The number of rows of the matrix.
+ * @param  solution - The new solution.
+ * @retval `INVALID_MATRIX_OR_INDICES` - Invalid size.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateHungarianSolution(int width, int height,
+                            HungarianSolution** solution) {
+  if (width <= 0 || height <= 0 || solution == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
 
-  // Cover zeros with minimum amount of lines
-  bool* coveredRows = (bool*)calloc(numRows, sizeof(bool));
-  if (coveredRows == NULL) {
+  HungarianSolution* newSolution = calloc(1, sizeof(HungarianSolution));
+  if (newSolution == NULL) {
     return MEMORY_ALLOCATION_FAILURE;
   }
-  bool* coveredCols = (bool*)calloc(numCols, sizeof(bool));
-  if (coveredCols == NULL) {
+  newSolution->width = width;
+  newSolution->height = height;
+  newSolution->rowToCol = malloc((size_t)height * sizeof(int));
+  newSolution->colToRow = malloc((size_t)width * sizeof(int));
+  newSolution->rowPotentials = calloc((size_t)height, sizeof(double));
+  newSolution->colPotentials = calloc((size_t)width, sizeof(double));
+  if (newSolution->rowToCol == NULL || newSolution->colToRow == NULL ||
+      newSolution->rowPotentials == NULL ||
+      newSolution->colPotentials == NULL) {
+    FreeHungarianSolution(newSolution);
     return MEMORY_ALLOCATION_FAILURE;
   }
 
-  while (!IsOptimalSolution(matrixCopy)) {
-    // TODO: It chooses the wrong rows/cols to mark sometimes
-    CoverZeros(matrixCopy, &coveredRows, &coveredCols);
+  for (int i = 0; i < height; i++) {
+    newSolution->rowToCol[i] = -1;
+  }
+  for (int j = 0; j < width; j++) {
+    newSolution->colToRow[j] = -1;
+  }
+
+  *solution = newSolution;
+  return SUCCESS;
+}
+
+/**
+ * @brief Free allocated memory of a solution.
+ * @param solution - The solution to be freed.
+ */
+void FreeHungarianSolution(HungarianSolution* solution) {
+  if (solution == NULL) {
+    return;
+  }
+
+  free(solution->rowToCol);
+  free(solution->colToRow);
+  free(solution->rowPotentials);
+  free(solution->colPotentials);
+  free(solution);
+}
+
+/**
+ * @brief  Implements the Hungarian algorithm from scratch, keeping the
+ *         potentials of the optimal assignment so later solves of a similar
+ *         matrix can start from it with `HungarianResolve`.
+ * @param  matrix   - Pointer to the input matrix.
+ * @param  solution - Pointer to store the solution; free it with
+ *                    `FreeHungarianSolution`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int HungarianSolve(Matrix* matrix, HungarianSolution** solution) {
+  if (matrix == NULL || solution == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  HungarianSolution* newSolution = NULL;
+  int status =
+      CreateHungarianSolution(matrix->width, matrix->height, &newSolution);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  status = SolveMatrixIntoSolution(matrix, 0, newSolution);
+  if (status != SUCCESS) {
+    FreeHungarianSolution(newSolution);
+    return status;
+  }
+
+  *solution = newSolution;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Implements the Hungarian algorithm starting from a previous
+ *         solution, usually of the same matrix before some values changed.
+ * @details Each row gets the potential that makes its best cell tight, which
+ *          restores the dual feasibility broken by the changes, and keeps its
+ *          previous column only if that cell is still tight. Only the rows
+ *          that lost their column are augmented again, so a few changes cost
+ *          one pass over the matrix plus one shortest path search per
+ *          affected row. Any assignment and potentials are accepted as a
+ *          start; invalid or repeated columns are dropped.
+ * @param  matrix   - Pointer to the input matrix.
+ * @param  solution - The previous solution, overwritten with the optimal
+ *                    solution of the matrix.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid or its size
+ *                                       does not match the solution.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int HungarianResolve(Matrix* matrix, HungarianSolution* solution) {
+  if (matrix == NULL || solution == NULL ||
+      matrix->width != solution->width ||
+      matrix->height != solution->height) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  return SolveMatrixIntoSolution(matrix, 1, solution);
+}
+
+/**
+ * @brief  Implements the Hungarian algorithm on a dense matrix from
+ *         scratch, keeping the potentials of the optimal assignment.
+ * @param  matrix   - Pointer to the input matrix.
+ * @param  solution - Pointer to store the solution; free it with
+ *                    `FreeHungarianSolution`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid or holds a
+ *                                       value that is not finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int HungarianSolveDense(const DenseMatrix* matrix,
+                        HungarianSolution** solution) {
+  LapCost cost;
+  if (matrix == NULL || matrix->data == NULL || solution == NULL ||
+      PrepareDenseCost(matrix, &cost) != SUCCESS) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  HungarianSolution* newSolution = NULL;
+  int status =
+      CreateHungarianSolution(matrix->width, matrix->height, &newSolution);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  status = SolveIntoSolution(&cost, matrix->height > matrix->width, 0,
+                             newSolution);
+  if (status != SUCCESS) {
+    FreeHungarianSolution(newSolution);
+    return status;
+  }
+
+  *solution = newSolution;
+  return SUCCESS;
+}
 
-    CreateAdditionalZeros(matrixCopy, coveredRows, coveredCols);
+/**
+ * @brief  Implements the Hungarian algorithm on a dense matrix starting from
+ *         a previous solution, as `HungarianResolve` does.
+ * @param  matrix   - Pointer to the input matrix.
+ * @param  solution - The previous solution, overwritten with the optimal
+ *                    solution of the matrix.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid, holds a value
+ *                                       that is not finite or its size does
+ *                                       not match the solution.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int HungarianResolveDense(const DenseMatrix* matrix,
+                          HungarianSolution* solution) {
+  LapCost cost;
+  if (matrix == NULL || matrix->data == NULL || solution == NULL ||
+      matrix->width != solution->width ||
+      matrix->height != solution->height ||
+      PrepareDenseCost(matrix, &cost) != SUCCESS) {
+    return INVALID_MATRIX_OR_INDICES;
   }
 
-  int resultExtraction =
-      ExtractFinalSolution(matrix, matrixCopy, chosenElements, result);
-  if (resultExtraction != SUCCESS) {
-    exit(resultExtraction);
+  return SolveIntoSolution(&cost, matrix->height > matrix->width, 1,
+                           solution);
+}
+
+/**
+ * @brief  Solves a matrix and keeps its optimal solution up to date through
+ *         the `Dynamic` functions, which change the matrix and repair the
+ *         solution incrementally instead of solving again.
+ * @param  matrix  - Pointer to the matrix. While it is tracked, it must only
+ *                   be changed through the `Dynamic` functions.
+ * @param  dynamic - Pointer to store the dynamic assignment; free it with
+ *                   `FreeDynamicAssignment`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateDynamicAssignment(Matrix* matrix, DynamicAssignment** dynamic) {
+  if (matrix == NULL || dynamic == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
   }
 
-  FreeMatrix(matrixCopy);
-  free(coveredRows);
-  free(coveredCols);
+  DynamicAssignment* newDynamic = calloc(1, sizeof(DynamicAssignment));
+  if (newDynamic == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  newDynamic->matrix = matrix;
 
+  int status = CreateHungarianSolution(matrix->width, matrix->height,
+                                       &newDynamic->solution);
+  if (status == SUCCESS) {
+    status = CreateCostMatrix(matrix, &newDynamic->costs);
+  }
+  if (status == SUCCESS) {
+    LapCost cost = {newDynamic->costs.height, newDynamic->costs.width,
+                    GetCostMatrixRow, &newDynamic->costs};
+    status = SolveIntoSolution(&cost, matrix->height > matrix->width, 0,
+                               newDynamic->solution);
+  }
+  if (status != SUCCESS) {
+    FreeDynamicAssignment(newDynamic);
+    return status;
+  }
+
+  *dynamic = newDynamic;
   return SUCCESS;
 }
+
+/**
+ * @brief  Gets the current optimal solution of a tracked matrix.
+ * @param  dynamic - The dynamic assignment.
+ * @retval The solution, owned by the dynamic assignment and updated by every
+ *         change, or NULL if `dynamic` is NULL.
+ */
+const HungarianSolution* GetDynamicSolution(const DynamicAssignment* dynamic) {
+  return dynamic == NULL ? NULL : dynamic->solution;
+}
+
+/**
+ * @brief  Replaces a value of a tracked matrix and restores the optimal
+ *         solution.
+ * @details A chosen value that grows, or a value that stays below the sum of
+ *          the potentials of its row and column, keeps the solution optimal
+ *          and costs O(1). Any other change costs one pass over the matrix
+ *          plus one augmentation.
+ * @param  dynamic - The dynamic assignment.
+ * @param  row     - The row of the value.
+ * @param  col     - The column of the value.
+ * @param  value   - The new value.
+ * @retval `INVALID_MATRIX_OR_INDICES` - No dynamic assignment provided.
+ * @retval `OUT_OF_BOUNDS`             - Invalid matrix position.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int DynamicReplaceValue(DynamicAssignment* dynamic, int row, int col,
+                        int value) {
+  if (dynamic == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  int status = ReplaceValueAtPosition(dynamic->matrix, row, col, value);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  int transposed = dynamic->matrix->height > dynamic->matrix->width;
+  double* cost =
+      dynamic->costs.costs +
+      (transposed ? (size_t)col * dynamic->costs.width + row
+                  : (size_t)row * dynamic->costs.width + col);
+  double previous = -*cost;
+  *cost = -(double)value;
+
+  HungarianSolution* solution = dynamic->solution;
+  if (solution->rowToCol[row] != col) {
+    if (solution->rowPotentials[row] + solution->colPotentials[col] >=
+        value) {
+      return SUCCESS;
+    }
+  } else if (value >= previous) {
+    solution->rowPotentials[row] += value - previous;
+    solution->totalValue += value - previous;
+    return SUCCESS;
+  }
+
+  return RepairDynamicAssignment(dynamic);
+}
+
+/**
+ * @brief  Inserts a row at the beginning of a tracked matrix, as `InsertRow`
+ *         does, and restores the optimal solution.
+ * @param  dynamic   - The dynamic assignment.
+ * @param  newRow    - Array with the values of the new row.
+ * @param  sizeArray - Size of the array.
+ * @retval `INVALID_MATRIX_OR_INDICES` - No dynamic assignment provided.
+ * @retval `OUT_OF_BOUNDS`             - Size of the array is different from
+ *                                       the width of the matrix.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int DynamicInsertRow(DynamicAssignment* dynamic, const int* newRow,
+                     int sizeArray) {
+  if (dynamic == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  int status = InsertRow(dynamic->matrix, newRow, sizeArray);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  return ResizeDynamicAssignment(dynamic, 0, -1, -1, -1);
+}
+
+/**
+ * @brief  Inserts a column at the end of a tracked matrix, as
+ *         `InsertColumn` does, and restores the optimal solution.
+ * @param  dynamic   - The dynamic assignment.
+ * @param  newColumn - Array with the values of the new column.
+ * @param  sizeArray - Size of the array.
+ * @retval `INVALID_MATRIX_OR_INDICES` - No dynamic assignment provided.
+ * @retval `OUT_OF_BOUNDS`             - Size of the array is different from
+ *                                       the height of the matrix.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int DynamicInsertColumn(DynamicAssignment* dynamic, const int* newColumn,
+                        int sizeArray) {
+  if (dynamic == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  int width = dynamic->matrix->width;
+  int status = InsertColumn(dynamic->matrix, newColumn, sizeArray);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  return ResizeDynamicAssignment(dynamic, -1, -1, width, -1);
+}
+
+/**
+ * @brief  Deletes a row of a tracked matrix and restores the optimal
+ *         solution. The last row cannot be deleted.
+ * @param  dynamic  - The dynamic assignment.
+ * @param  rowIndex - The row to be deleted.
+ * @retval `INVALID_MATRIX_OR_INDICES` - No dynamic assignment provided, or
+ *                                       the matrix has a single row.
+ * @retval `OUT_OF_BOUNDS`             - Position does not exist.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int DynamicDeleteRow(DynamicAssignment* dynamic, int rowIndex) {
+  if (dynamic == NULL || dynamic->matrix->height <= 1) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  int status = DeleteRow(dynamic->matrix, rowIndex);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  return ResizeDynamicAssignment(dynamic, -1, rowIndex, -1, -1);
+}
+
+/**
+ * @brief  Deletes a column of a tracked matrix and restores the optimal
+ *         solution. The last column cannot be deleted.
+ * @param  dynamic  - The dynamic assignment.
+ * @param  colIndex - The column to be deleted.
+ * @retval `INVALID_MATRIX_OR_INDICES` - No dynamic assignment provided, or
+ *                                       the matrix has a single column.
+ * @retval `OUT_OF_BOUNDS`             - Position does not exist.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int DynamicDeleteColumn(DynamicAssignment* dynamic, int colIndex) {
+  if (dynamic == NULL || dynamic->matrix->width <= 1) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  int status = DeleteColumn(dynamic->matrix, colIndex);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  return ResizeDynamicAssignment(dynamic, -1, -1, -1, colIndex);
+}
+
+/**
+ * @brief Frees a dynamic assignment. The tracked matrix is not freed.
+ * @param dynamic - The dynamic assignment to be freed.
+ */
+void FreeDynamicAssignment(DynamicAssignment* dynamic) {
+  if (dynamic == NULL) {
+    return;
+  }
+
+  free(dynamic->costs.costs);
+  FreeHungarianSolution(dynamic->solution);
+  free(dynamic);
+}
@@ -2,7 +2,10 @@
  *  @file      hungarian.h
  *  @brief     Header file for the Hungarian algorithm.
  *  @details   This header file contains function declarations and
- *             data structures related to the Hungarian algorithm.
+ *             data structures related to the Hungarian algorithm. The
+ *             solvers accept any n x m matrix, assign every row or column of
+ *             the smaller dimension, and always terminate with an optimal
+ *             assignment in O(n^2 m) time for n <= m.
  *  @author    Enrique Rodrigues
  *  @date      14.03.2024
  *  @copyright  Enrique Rodrigues, 2024. All right reserved.
@@ -10,16 +13,231 @@
 #ifndef HUNGARIAN_ALGORITHM
 #define HUNGARIAN_ALGORITHM
 
+#include "assignment.h"
 #include "matrix_core.h"
+#include "matrix_dense.h"
+#include "matrix_io.h"
+#include "solver_workspace.h"
 
 /**
- * @struct Zero
- * @brief Structure representing a zero in the matrix.
+ * @struct HungarianSolution
+ * @brief Optimal assignment of a matrix together with the dual potentials
+ *        that prove it optimal.
+ *
+ * For every cell, `rowPotentials[i] + colPotentials[j] >= value[i][j]`, with
+ * equality on the chosen cells. The solution of a matrix can be given back
+ * to `HungarianResolve` after some values change, to solve the new matrix
+ * without starting from scratch.
  */
-typedef struct Zero {
-  int row;  // Row where the zero is
-  int col;  // Column where the zero is
-} Zero;
+typedef struct HungarianSolution {
+  int width;              // Number of columns of the matrix
+  int height;             // Number of rows of the matrix
+  int* rowToCol;          // Column chosen in each row, or -1
+  int* colToRow;          // Row chosen in each column, or -1
+  double* rowPotentials;  // Potential of each row
+  double* colPotentials;  // Potential of each column
+  double totalValue;      // Sum of the chosen values
+} HungarianSolution;
+
+/**
+ * @brief Optimal solution of a matrix kept up to date as the matrix changes
+ *        through the `Dynamic` functions.
+ */
+typedef struct DynamicAssignment DynamicAssignment;
+
+/**
+ * @brief Implements the Hungarian algorithm, keeping the row and column of
+ *        each chosen element. Every row of a wide matrix and every column
+ *        of a tall one is assigned; a tall matrix is solved by columns.
+ * @param matrix - Pointer to the input matrix.
+ * @param result - Pointer to store the chosen elements; free it with
+ *                 `FreeAssignmentResult`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix or the provided indices are
+ *                                       invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure for the new
+ *                                       matrix element.
+ * @retval `SUCCESS`                    - Operation successful.
+ */
+__declspec(dllexport) int HungarianAssignment(Matrix* matrix,
+                                              AssignmentResult** result);
+
+/**
+ * @brief Implements the Hungarian algorithm reading the values of the
+ *        matrix in place, without copying them. The result is as optimal
+ *        as the one of `HungarianAssignment`.
+ * @details Each row is negated into a buffer as it is read, so the extra
+ *          memory is O(n + m) instead of the O(n m) costs copied by
+ *          `HungarianAssignment`, at the price of walking the elements of a
+ *          row on every read. A matrix with more rows than columns is solved
+ *          with columns of cost 0 added, in O(n^3) time for n rows.
+ * @param matrix - Pointer to the input matrix, which is not changed.
+ * @param result - Pointer to store the chosen elements; free it with
+ *                 `FreeAssignmentResult`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int HungarianAssignmentInPlace(
+    const Matrix* matrix, AssignmentResult** result);
+
+/**
+ * @brief Implements the Hungarian algorithm with the memory of a workspace.
+ *        The result is the one of `HungarianAssignment`.
+ * @details Meant for many solves in a row: the costs, the engine arrays and
+ *          the potentials come from the workspace, and the chosen elements
+ *          replace the ones of the result, so once the workspace fits the
+ *          matrix and the result has room for its elements, the solve makes
+ *          no allocation.
+ * @param matrix    - Pointer to the input matrix.
+ * @param workspace - The workspace, from `CreateSolverWorkspace`; it is
+ *                    grown if the matrix does not fit.
+ * @param result    - The result, from `CreateAssignmentResult`; its
+ *                    previous elements are discarded.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int HungarianAssignmentWithWorkspace(
+    Matrix* matrix, SolverWorkspace* workspace, AssignmentResult* result);
+
+/**
+ * @brief Implements the Hungarian algorithm with a time and iteration
+ *        budget, for callers that must answer within a latency target.
+ * @details The budget is checked before each shortest path search, so the
+ *          time limit is overrun by at most one search, O(n m). When it runs
+ *          out, each row not assigned yet takes its best free column, which
+ *          gives a feasible result, and the column potentials reached so
+ *          far give an upper bound on the optimum in one more pass over the
+ *          values. Both are stored in `gap`; a result solved to the end has
+ *          a gap of 0.
+ * @param matrix         - Pointer to the input matrix.
+ * @param timeLimit      - Seconds after which the solve stops, or 0 for no
+ *                         limit.
+ * @param iterationLimit - Shortest path searches after which the solve
+ *                         stops, or 0 for no limit.
+ * @param result         - Pointer to store the chosen elements, also when
+ *                         the budget runs out; free it with
+ *                         `FreeAssignmentResult`.
+ * @param gap            - Pointer to store the gap of the result, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix or the limits are
+ *                                       invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `TIME_LIMIT_REACHED`        - The budget ran out; the result is
+ *                                       feasible but may not be optimal.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int HungarianAssignmentWithBudget(
+    Matrix* matrix, double timeLimit, int iterationLimit,
+    AssignmentResult** result, AssignmentGap* gap);
+
+/**
+ * @brief Implements the Hungarian algorithm starting from reductions that
+ *        were computed while the matrix was loaded. The reduced column minima
+ *        are feasible column potentials of the negated matrix, so the
+ *        Jonker-Volgenant initialization is replaced by a single pass that
+ *        assigns tight cells.
+ * @param matrix     - Pointer to the input matrix.
+ * @param reductions - Reductions of the matrix, from
+ *                     `CreateMatrixFromFileWithReductions`.
+ * @param result     - Pointer to store the chosen elements; free it with
+ *                     `FreeAssignmentResult`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid or does not
+ *                                       match the reductions.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure for the new
+ *                                       matrix element.
+ * @retval `SUCCESS`                    - Operation successful.
+ */
+__declspec(dllexport) int HungarianAssignmentWithReductions(
+    Matrix* matrix, const MatrixReductions* reductions,
+    AssignmentResult** result);
+
+/**
+ * @brief Implements the Hungarian algorithm on a dense matrix, reading its
+ *        rows in place without building a `Matrix`.
+ * @param matrix - Pointer to the input matrix.
+ * @param result - Pointer to store the chosen elements; free it with
+ *                 `FreeAssignmentResult`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix holds a value that is not
+ *                                       finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int HungarianAssignmentDense(const DenseMatrix* matrix,
+                                                   AssignmentResult** result);
+
+/**
+ * @brief Implements the Hungarian algorithm on a dense matrix with the
+ *        memory of a workspace, see `HungarianAssignmentWithWorkspace`. The
+ *        rows are read in place, so the costs of the workspace are unused.
+ * @param matrix    - Pointer to the input matrix.
+ * @param workspace - The workspace; it is grown if the matrix does not fit.
+ * @param result    - The result; its previous elements are discarded.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix has no data or holds a
+ *                                       value that is not finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int HungarianAssignmentDenseWithWorkspace(
+    const DenseMatrix* matrix, SolverWorkspace* workspace,
+    AssignmentResult* result);
+
+/**
+ * @brief Implements the Hungarian algorithm on a dense matrix with a time
+ *        and iteration budget, see `HungarianAssignmentWithBudget`.
+ * @param matrix         - Pointer to the input matrix.
+ * @param timeLimit      - Seconds after which the solve stops, or 0 for no
+ *                         limit.
+ * @param iterationLimit - Shortest path searches after which the solve
+ *                         stops, or 0 for no limit.
+ * @param result         - Pointer to store the chosen elements, also when
+ *                         the budget runs out.
+ * @param gap            - Pointer to store the gap of the result, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The limits are invalid, or the
+ *                                       matrix has no data or holds a value
+ *                                       that is not finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `TIME_LIMIT_REACHED`        - The budget ran out; the result is
+ *                                       feasible but may not be optimal.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int HungarianAssignmentDenseWithBudget(
+    const DenseMatrix* matrix, double timeLimit, int iterationLimit,
+    AssignmentResult** result, AssignmentGap* gap);
+
+/**
+ * @brief Implements the Hungarian algorithm with the column scan of each
+ *        shortest path search split among several threads. Threads are
+ *        only used when every thread gets at least
+ *        `PARALLEL_SOLVE_MIN_COLUMNS` columns, and the result is the same as
+ *        the one of `HungarianAssignment`.
+ * @param matrix      - Pointer to the input matrix.
+ * @param threadCount - Number of threads, or 0 for one per processor.
+ * @param result      - Pointer to store the chosen elements; free it with
+ *                      `FreeAssignmentResult`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int HungarianAssignmentParallel(
+    Matrix* matrix, int threadCount, AssignmentResult** result);
+
+/**
+ * @brief Implements the Hungarian algorithm on a dense matrix with the
+ *        column scan of each shortest path search split among several
+ *        threads. Threads are only used when every thread gets at least
+ *        `PARALLEL_SOLVE_MIN_COLUMNS` columns, and the result is the same as
+ *        the one of `HungarianAssignmentDense`.
+ * @param matrix      - Pointer to the input matrix.
+ * @param threadCount - Number of threads, or 0 for one per processor.
+ * @param result      - Pointer to store the chosen elements; free it with
+ *                      `FreeAssignmentResult`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix holds a value that is not
+ *                                       finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int HungarianAssignmentDenseParallel(
+    const DenseMatrix* matrix, int threadCount, AssignmentResult** result);
 
 /**
  * @brief Implements the Hungarian algorithm to find the solution to the
@@ -38,4 +256,195 @@ typedef struct Zero {
 __declspec(dllexport) int HungarianAlgorithm(Matrix* matrix,
                                              int** chosenElements, int* result);
 
+/**
+ * @brief  Creates an empty solution for a matrix: no element chosen and
+ *         every potential set to zero.
+ * @param  width    - The number of columns of the matrix.
+ * @param  height   - The number of rows of the matrix.
+ * @param  solution - The new solution; free it with `FreeHungarianSolution`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - Invalid size.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CreateHungarianSolution(
+    int width, int height, HungarianSolution** solution);
+
+/**
+ * @brief Free allocated memory of a solution.
+ * @param solution - The solution to be freed.
+ */
+__declspec(dllexport) void FreeHungarianSolution(HungarianSolution* solution);
+
+/**
+ * @brief  Implements the Hungarian algorithm from scratch, keeping the
+ *         potentials of the optimal assignment so later solves of a similar
+ *         matrix can start from it with `HungarianResolve`.
+ * @param  matrix   - Pointer to the input matrix.
+ * @param  solution - Pointer to store the solution; free it with
+ *                    `FreeHungarianSolution`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int HungarianSolve(Matrix* matrix,
+                                         HungarianSolution** solution);
+
+/**
+ * @brief  Implements the Hungarian algorithm starting from a previous
+ *         solution, usually of the same matrix before some values changed.
+ * @details Each row gets the potential that makes its best cell tight, which
+ *          restores the dual feasibility broken by the changes, and keeps its
+ *          previous column only if that cell is still tight. Only the rows
+ *          that lost their column are augmented again, so a few changes cost
+ *          one pass over the matrix plus one shortest path search per
+ *          affected row. Any assignment and potentials are accepted as a
+ *          start; invalid or repeated columns are dropped.
+ * @param  matrix   - Pointer to the input matrix.
+ * @param  solution - The previous solution, overwritten with the optimal
+ *                    solution of the matrix.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid or its size
+ *                                       does not match the solution.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int HungarianResolve(Matrix* matrix,
+                                           HungarianSolution* solution);
+
+/**
+ * @brief  Implements the Hungarian algorithm on a dense matrix from
+ *         scratch, keeping the potentials of the optimal assignment.
+ * @param  matrix   - Pointer to the input matrix.
+ * @param  solution - Pointer to store the solution; free it with
+ *                    `FreeHungarianSolution`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid or holds a
+ *                                       value that is not finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int HungarianSolveDense(const DenseMatrix* matrix,
+                                              HungarianSolution** solution);
+
+/**
+ * @brief  Implements the Hungarian algorithm on a dense matrix starting from
+ *         a previous solution, as `HungarianResolve` does.
+ * @param  matrix   - Pointer to the input matrix.
+ * @param  solution - The previous solution, overwritten with the optimal
+ *                    solution of the matrix.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid, holds a value
+ *                                       that is not finite or its size does
+ *                                       not match the solution.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int HungarianResolveDense(const DenseMatrix* matrix,
+                                                HungarianSolution* solution);
+
+/**
+ * @brief  Solves a matrix and keeps its optimal solution up to date through
+ *         the `Dynamic` functions, which change the matrix and repair the
+ *         solution incrementally instead of solving again.
+ * @param  matrix  - Pointer to the matrix. While it is tracked, it must only
+ *                   be changed through the `Dynamic` functions.
+ * @param  dynamic - Pointer to store the dynamic assignment; free it with
+ *                   `FreeDynamicAssignment`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CreateDynamicAssignment(
+    Matrix* matrix, DynamicAssignment** dynamic);
+
+/**
+ * @brief  Gets the current optimal solution of a tracked matrix.
+ * @param  dynamic - The dynamic assignment.
+ * @retval The solution, owned by the dynamic assignment and updated by every
+ *         change, or NULL if `dynamic` is NULL.
+ */
+__declspec(dllexport) const HungarianSolution* GetDynamicSolution(
+    const DynamicAssignment* dynamic);
+
+/**
+ * @brief  Replaces a value of a tracked matrix and restores the optimal
+ *         solution.
+ * @details A chosen value that grows, or a value that stays below the sum of
+ *          the potentials of its row and column, keeps the solution optimal
+ *          and costs O(1). Any other change costs one pass over the matrix
+ *          plus one augmentation.
+ * @param  dynamic - The dynamic assignment.
+ * @param  row     - The row of the value.
+ * @param  col     - The column of the value.
+ * @param  value   - The new value.
+ * @retval `INVALID_MATRIX_OR_INDICES` - No dynamic assignment provided.
+ * @retval `OUT_OF_BOUNDS`             - Invalid matrix position.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int DynamicReplaceValue(DynamicAssignment* dynamic,
+                                              int row, int col, int value);
+
+/**
+ * @brief  Inserts a row at the beginning of a tracked matrix, as `InsertRow`
+ *         does, and restores the optimal solution.
+ * @param  dynamic   - The dynamic assignment.
+ * @param  newRow    - Array with the values of the new row.
+ * @param  sizeArray - Size of the array.
+ * @retval `INVALID_MATRIX_OR_INDICES` - No dynamic assignment provided.
+ * @retval `OUT_OF_BOUNDS`             - Size of the array is different from
+ *                                       the width of the matrix.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int DynamicInsertRow(DynamicAssignment* dynamic,
+                                           const int* newRow, int sizeArray);
+
+/**
+ * @brief  Inserts a column at the end of a tracked matrix, as
+ *         `InsertColumn` does, and restores the optimal solution.
+ * @param  dynamic   - The dynamic assignment.
+ * @param  newColumn - Array with the values of the new column.
+ * @param  sizeArray - Size of the array.
+ * @retval `INVALID_MATRIX_OR_INDICES` - No dynamic assignment provided.
+ * @retval `OUT_OF_BOUNDS`             - Size of the array is different from
+ *                                       the height of the matrix.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int DynamicInsertColumn(DynamicAssignment* dynamic,
+                                              const int* newColumn,
+                                              int sizeArray);
+
+/**
+ * @brief  Deletes a row of a tracked matrix and restores the optimal
+ *         solution. The last row cannot be deleted.
+ * @param  dynamic  - The dynamic assignment.
+ * @param  rowIndex - The row to be deleted.
+ * @retval `INVALID_MATRIX_OR_INDICES` - No dynamic assignment provided, or
+ *                                       the matrix has a single row.
+ * @retval `OUT_OF_BOUNDS`             - Position does not exist.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int DynamicDeleteRow(DynamicAssignment* dynamic,
+                                           int rowIndex);
+
+/**
+ * @brief  Deletes a column of a tracked matrix and restores the optimal
+ *         solution. The last column cannot be deleted.
+ * @param  dynamic  - The dynamic assignment.
+ * @param  colIndex - The column to be deleted.
+ * @retval `INVALID_MATRIX_OR_INDICES` - No dynamic assignment provided, or
+ *                                       the matrix has a single column.
+ * @retval `OUT_OF_BOUNDS`             - Position does not exist.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int DynamicDeleteColumn(DynamicAssignment* dynamic,
+                                              int colIndex);
+
+/**
+ * @brief Frees a dynamic assignment. The tracked matrix is not freed.
+ * @param dynamic - The dynamic assignment to be freed.
+ */
+__declspec(dllexport) void FreeDynamicAssignment(DynamicAssignment* dynamic);
+
 #endif  // !HUNGARIAN_ALGORITHM
@@ -0,0 +1,524 @@
+/**
+ *
+ *  @file      hungarian_batch.c
+ *  @brief     Implementation of the Hungarian algorithm on batches of
+ *             matrices.
+ *  @details   This file contains the pool of threads of the batch solvers.
+ *             Each thread starts with a contiguous range of the matrices and
+ *             takes them from the front; when its range is empty, it takes
+ *             the back half of the range of another thread. Every matrix is
+ *             negated into the costs of the thread, transposed if it has
+ *             more rows than columns, and solved by the shortest augmenting
+ *             path engine, or by the bitmask solver when it is tiny.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "hungarian_batch.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "assignment.h"
+#include "constants.h"
+#include "error_codes.h"
+#include "lap_core.h"
+#include "lap_small.h"
+#include "matrix_batch.h"
+#include "matrix_core.h"
+#include "matrix_dense.h"
+#include "platform.h"
+
+typedef struct BatchSolve BatchSolve;
+
+/**
+ * @struct BatchWorker
+ * @brief A thread of a batch solve, with its range of matrices and the
+ *        memory it reuses from one matrix to the next.
+ *
+ * The workspace and the state are created for `rows` x `cols` problems and
+ * also serve the smaller ones.
+ */
+typedef struct BatchWorker {
+  BatchSolve* solve;        // The batch solve
+  int index;                // Position of the thread in `solve->workers`
+  Mutex lock;               // Guards `next` and `end`
+  int next;                 // First matrix of the range not taken yet
+  int end;                  // End of the range
+  int rows;                 // Number of rows of the workspace
+  int cols;                 // Number of columns of the workspace
+  int width;                // Number of columns of the current costs
+  double* costs;            // Costs of the current matrix, row by row
+  size_t costCapacity;      // Number of costs that fit in `costs`
+  LapWorkspace* workspace;  // Scratch memory of the engine
+  LapState* state;          // Assignment and potentials of the engine
+  int failedIndex;          // First matrix that failed, or -1
+  int failedStatus;         // Status of `failedIndex`
+} BatchWorker;
+
+/**
+ * @struct BatchSolve
+ * @brief Matrices, results and threads of a batch solve. Exactly one of
+ *        `matrices`, `pooled` and `dense` holds the matrices.
+ */
+struct BatchSolve {
+  int count;                        // Number of matrices
+  Matrix* const* matrices;          // Linked-list matrices, or NULL
+  const Matrix* pooled;             // Matrices of a `MatrixBatch`, or NULL
+  const DenseMatrix* const* dense;  // Dense matrices, or NULL
+  AssignmentResult** results;       // Chosen elements of each matrix
+  int* statuses;                    // Status of each matrix, or NULL
+  BatchWorker* workers;             // The threads
+  int workerCount;                  // Number of threads
+};
+
+/**
+ * @brief  Gets a row of the costs of a thread, for `LapCost`.
+ * @param  context - The `BatchWorker`.
+ * @param  row     - The row.
+ * @param  buffer  - Unused; the row is returned in place.
+ * @retval Pointer to the costs of the row.
+ */
+static const double* GetWorkerRow(void* context, int row, double* buffer) {
+  const BatchWorker* worker = context;
+  (void)buffer;
+  return worker->costs + (size_t)row * worker->width;
+}
+
+/**
+ * @brief  Makes the memory of a thread large enough for a matrix.
+ * @param  worker - The thread.
+ * @param  rows   - Number of rows of the costs.
+ * @param  cols   - Number of columns of the costs.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int ReserveWorker(BatchWorker* worker, int rows, int cols) {
+  size_t cells = (size_t)rows * cols;
+  if (cells > worker->costCapacity) {
+    double* costs = realloc(worker->costs, cells * sizeof(double));
+    if (costs == NULL) {
+      return MEMORY_ALLOCATION_FAILURE;
+    }
+    worker->costs = costs;
+    worker->costCapacity = cells;
+  }
+
+  if (rows > worker->rows || cols > worker->cols) {
+    int newRows = rows > worker->rows ? rows : worker->rows;
+    int newCols = cols > worker->cols ? cols : worker->cols;
+    FreeLapWorkspace(worker->workspace);
+    FreeLapState(worker->state);
+    worker->workspace = NULL;
+    worker->state = NULL;
+    worker->rows = 0;
+    worker->cols = 0;
+    if (CreateLapWorkspace(newRows, newCols, &worker->workspace) != SUCCESS ||
+        CreateLapState(newRows, newCols, &worker->state) != SUCCESS) {
+      return MEMORY_ALLOCATION_FAILURE;
+    }
+    worker->rows = newRows;
+    worker->cols = newCols;
+  }
+
+  worker->width = cols;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Fills the costs of a thread with the negated values of a
+ *         linked-list matrix, transposed if it has more rows than columns.
+ *         Missing elements cost 0, as in `HungarianAssignment`.
+ * @param  worker - The thread.
+ * @param  matrix - The matrix.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int LoadLinkedCosts(BatchWorker* worker, const Matrix* matrix) {
+  if (matrix == NULL || matrix->width <= 0 || matrix->height <= 0) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  int transposed = matrix->height > matrix->width;
+  int rows = transposed ? matrix->width : matrix->height;
+  int cols = transposed ? matrix->height : matrix->width;
+  if (ReserveWorker(worker, rows, cols) != SUCCESS) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  memset(worker->costs, 0, (size_t)rows * cols * sizeof(double));
+
+  // Position of a cell in `costs`: row * rowStride + col * colStride
+  size_t rowStride = transposed ? 1 : (size_t)cols;
+  size_t colStride = transposed ? (size_t)cols : 1;
+  int row = 0;
+  for (const MatrixRowNode* rowNode = matrix->head; rowNode != NULL;
+       rowNode = rowNode->nextRow, row++) {
+    if (row >= matrix->height) {
+      return INVALID_MATRIX_OR_INDICES;
+    }
+    for (const MatrixElement* element = rowNode->row; element != NULL;
+         element = element->nextCol) {
+      if (element->column < 0 || element->column >= matrix->width) {
+        return INVALID_MATRIX_OR_INDICES;
+      }
+      worker->costs[row * rowStride + element->column * colStride] =
+          -(double)element->value;
+    }
+  }
+
+  return SUCCESS;
+}
+
+/**
+ * @brief  Fills the costs of a thread with the negated values of a dense
+ *         matrix, transposed if it has more rows than columns.
+ * @param  worker - The thread.
+ * @param  matrix - The matrix.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is empty or holds a value
+ *                                       that is not finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int LoadDenseCosts(BatchWorker* worker, const DenseMatrix* matrix) {
+  if (matrix == NULL || matrix->data == NULL || matrix->width <= 0 ||
+      matrix->height <= 0) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  int transposed = matrix->height > matrix->width;
+  int rows = transposed ? matrix->width : matrix->height;
+  int cols = transposed ? matrix->height : matrix->width;
+  if (ReserveWorker(worker, rows, cols) != SUCCESS) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  // Value `k` of the matrix goes to `costs[k]`, or to its transposed cell
+  size_t count = (size_t)matrix->width * matrix->height;
+  for (size_t k = 0; k < count; k++) {
+    double value;
+    switch (matrix->type) {
+      case DENSE_INT32:
+        value = ((const int*)matrix->data)[k];
+        break;
+      case DENSE_INT64:
+        value = (double)((const long long*)matrix->data)[k];
+        break;
+      default:
+        value = ((const double*)matrix->data)[k];
+        if (!isfinite(value)) {
+          return INVALID_MATRIX_OR_INDICES;
+        }
+        break;
+    }
+    size_t width = (size_t)matrix->width;
+    size_t cell = transposed ? k % width * cols + k / width : k;
+    worker->costs[cell] = -value;
+  }
+
+  return SUCCESS;
+}
+
+/**
+ * @brief  Creates the result of the matrix solved by a thread, in the row
+ *         order of the matrix.
+ * @param  worker     - The thread, with the optimal assignment.
+ * @param  rows       - Number of rows of the costs.
+ * @param  transposed - Whether the rows of the costs are the columns of the
+ *                      matrix.
+ * @param  result     - Pointer to store the chosen elements.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int ExtractWorkerResult(const BatchWorker* worker, int rows,
+                               int transposed, AssignmentResult** result) {
+  AssignmentResult* selection = NULL;
+  if (CreateAssignmentResult(rows, &selection) != SUCCESS) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  int status = SUCCESS;
+  int originalRows = transposed ? worker->width : rows;
+  for (int row = 0; row < originalRows && status == SUCCESS; row++) {
+    int costRow = transposed ? worker->state->colToRow[row] : row;
+    if (costRow < 0) {
+      continue;
+    }
+    int costCol = transposed ? row : worker->state->rowToCol[row];
+    double cost = worker->costs[(size_t)costRow * worker->width + costCol];
+    status = AddAssignment(selection, row, transposed ? costRow : costCol,
+                           -cost);
+  }
+
+  if (status != SUCCESS) {
+    FreeAssignmentResult(selection);
+    return status;
+  }
+
+  *result = selection;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Solves one matrix of a batch with the memory of a thread.
+ * @param  worker - The thread.
+ * @param  index  - Index of the matrix.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int SolveBatchMatrix(BatchWorker* worker, int index) {
+  const BatchSolve* solve = worker->solve;
+  int status;
+  int width;
+  int height;
+  if (solve->dense != NULL) {
+    const DenseMatrix* matrix = solve->dense[index];
+    status = LoadDenseCosts(worker, matrix);
+    width = status == SUCCESS ? matrix->width : 0;
+    height = status == SUCCESS ? matrix->height : 0;
+  } else {
+    const Matrix* matrix = solve->matrices != NULL ? solve->matrices[index]
+                                                   : &solve->pooled[index];
+    status = LoadLinkedCosts(worker, matrix);
+    width = status == SUCCESS ? matrix->width : 0;
+    height = status == SUCCESS ? matrix->height : 0;
+  }
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  int transposed = height > width;
+  int rows = transposed ? width : height;
+  LapCost cost = {rows, worker->width, GetWorkerRow, worker};
+  if (worker->width <= SMALL_SOLVE_DISPATCH_SIZE) {
+    status = SolveSmallLap(&cost, worker->state);
+  } else {
+    status = SolveLap(&cost, worker->workspace, worker->state);
+  }
+  if (status != SUCCESS) {
+    return status;
+  }
+  return ExtractWorkerResult(worker, rows, transposed,
+                             &solve->results[index]);
+}
+
+/**
+ * @brief  Takes the next matrix of a thread: the front of its own range, or
+ *         else the back half of the range of another thread, which becomes
+ *         its own.
+ * @param  worker - The thread.
+ * @retval Index of the matrix, or -1 when every range is empty.
+ */
+static int TakeBatchMatrix(BatchWorker* worker) {
+  int index = -1;
+  LockMutex(&worker->lock);
+  if (worker->next < worker->end) {
+    index = worker->next++;
+  }
+  UnlockMutex(&worker->lock);
+  if (index >= 0) {
+    return index;
+  }
+
+  const BatchSolve* solve = worker->solve;
+  for (int k = 1; k < solve->workerCount; k++) {
+    BatchWorker* victim =
+        &solve->workers[(worker->index + k) % solve->workerCount];
+    LockMutex(&victim->lock);
+    int remaining = victim->end - victim->next;
+    int start = victim->end - (remaining + 1) / 2;
+    int end = victim->end;
+    if (remaining > 0) {
+      victim->end = start;
+    }
+    UnlockMutex(&victim->lock);
+
+    if (remaining > 0) {
+      LockMutex(&worker->lock);
+      worker->next = start + 1;
+      worker->end = end;
+      UnlockMutex(&worker->lock);
+      return start;
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief Solves matrices until every range is empty, for `StartThread`.
+ * @param argument - The `BatchWorker`.
+ */
+static void RunBatchWorker(void* argument) {
+  BatchWorker* worker = argument;
+  const BatchSolve* solve = worker->solve;
+  int index;
+  while ((index = TakeBatchMatrix(worker)) >= 0) {
+    int status = SolveBatchMatrix(worker, index);
+    if (solve->statuses != NULL) {
+      solve->statuses[index] = status;
+    }
+    if (status != SUCCESS &&
+        (worker->failedIndex < 0 || index < worker->failedIndex)) {
+      worker->failedIndex = index;
+      worker->failedStatus = status;
+    }
+  }
+}
+
+/**
+ * @brief  Solves every matrix of a batch, each thread starting with an
+ *         equal share of them.
+ * @param  solve       - The batch solve, with the matrices and results set.
+ * @param  threadCount - Number of threads, or 0 for one per processor.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval The status of the first matrix that failed, or `SUCCESS`.
+ */
+static int SolveBatch(BatchSolve* solve, int threadCount) {
+  for (int i = 0; i < solve->count; i++) {
+    solve->results[i] = NULL;
+  }
+  if (solve->count == 0) {
+    return SUCCESS;
+  }
+
+  if (threadCount <= 0) {
+    threadCount = GetProcessorCount();
+  }
+  if (threadCount > solve->count) {
+    threadCount = solve->count;
+  }
+  solve->workerCount = threadCount;
+  solve->workers = calloc((size_t)threadCount, sizeof(BatchWorker));
+  ThreadHandle* threads = malloc((size_t)threadCount * sizeof(ThreadHandle));
+  int* started = calloc((size_t)threadCount, sizeof(int));
+  if (solve->workers == NULL || threads == NULL || started == NULL) {
+    free(solve->workers);
+    free(threads);
+    free(started);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  for (int t = 0; t < threadCount; t++) {
+    BatchWorker* worker = &solve->workers[t];
+    worker->solve = solve;
+    worker->index = t;
+    worker->next = (int)((long long)solve->count * t / threadCount);
+    worker->end = (int)((long long)solve->count * (t + 1) / threadCount);
+    worker->failedIndex = -1;
+    InitMutex(&worker->lock);
+  }
+
+  // The calling thread is the first worker; the range of a thread that
+  // cannot be created is stolen by the others
+  for (int t = 1; t < threadCount; t++) {
+    started[t] = StartThread(&threads[t], RunBatchWorker,
+                             &solve->workers[t]) == SUCCESS;
+  }
+  RunBatchWorker(&solve->workers[0]);
+
+  int failedIndex = -1;
+  int status = SUCCESS;
+  for (int t = 0; t < threadCount; t++) {
+    BatchWorker* worker = &solve->workers[t];
+    if (started[t]) {
+      JoinThread(threads[t]);
+    }
+    if (worker->failedIndex >= 0 &&
+        (failedIndex < 0 || worker->failedIndex < failedIndex)) {
+      failedIndex = worker->failedIndex;
+      status = worker->failedStatus;
+    }
+    DestroyMutex(&worker->lock);
+    free(worker->costs);
+    FreeLapWorkspace(worker->workspace);
+    FreeLapState(worker->state);
+  }
+
+  free(solve->workers);
+  free(threads);
+  free(started);
+  return status;
+}
+
+/**
+ * @brief  Implements the Hungarian algorithm on many matrices at once. Each
+ *         result is the one `HungarianAssignment` gives for its matrix.
+ * @param  matrices    - Array with the matrices.
+ * @param  count       - Number of matrices.
+ * @param  threadCount - Number of threads, or 0 for one per processor.
+ * @param  results     - Array of `count` pointers to store the chosen
+ *                       elements of each matrix.
+ * @param  statuses    - Array of `count` integers to store the status of
+ *                       each matrix, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The arguments are invalid, or some
+ *                                       matrix is.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Every matrix was solved.
+ */
+int HungarianAssignmentBatch(Matrix* const* matrices, int count,
+                             int threadCount, AssignmentResult** results,
+                             int* statuses) {
+  if ((matrices == NULL && count > 0) || count < 0 || results == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  BatchSolve solve = {count,   matrices, NULL, NULL, results,
+                      statuses, NULL,     0};
+  return SolveBatch(&solve, threadCount);
+}
+
+/**
+ * @brief  Implements the Hungarian algorithm on every matrix of a batch
+ *         loaded with `LoadMatrixBatch`, see `HungarianAssignmentBatch`.
+ * @param  batch       - The batch.
+ * @param  threadCount - Number of threads, or 0 for one per processor.
+ * @param  results     - Array of `batch->count` pointers to store the chosen
+ *                       elements of each matrix.
+ * @param  statuses    - Array of `batch->count` integers to store the status
+ *                       of each matrix, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The arguments are invalid, or some
+ *                                       matrix is.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Every matrix was solved.
+ */
+int HungarianAssignmentMatrixBatch(const MatrixBatch* batch, int threadCount,
+                                   AssignmentResult** results,
+                                   int* statuses) {
+  if (batch == NULL || (batch->matrices == NULL && batch->count > 0) ||
+      batch->count < 0 || results == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  BatchSolve solve = {batch->count, NULL,     batch->matrices, NULL,
+                      results,      statuses, NULL,            0};
+  return SolveBatch(&solve, threadCount);
+}
+
+/**
+ * @brief  Implements the Hungarian algorithm on many dense matrices at once,
+ *         see `HungarianAssignmentBatch`.
+ * @param  matrices    - Array with the matrices.
+ * @param  count       - Number of matrices.
+ * @param  threadCount - Number of threads, or 0 for one per processor.
+ * @param  results     - Array of `count` pointers to store the chosen
+ *                       elements of each matrix.
+ * @param  statuses    - Array of `count` integers to store the status of
+ *                       each matrix, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The arguments are invalid, or some
+ *                                       matrix is empty or holds a value
+ *                                       that is not finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Every matrix was solved.
+ */
+int HungarianAssignmentDenseBatch(const DenseMatrix* const* matrices,
+                                  int count, int threadCount,
+                                  AssignmentResult** results, int* statuses) {
+  if ((matrices == NULL && count > 0) || count < 0 || results == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  BatchSolve solve = {count,   NULL, NULL, matrices, results,
+                      statuses, NULL, 0};
+  return SolveBatch(&solve, threadCount);
+}
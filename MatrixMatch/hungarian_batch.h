@@ -0,0 +1,86 @@
+/**
+ *  @file      hungarian_batch.h
+ *  @brief     Header file for the Hungarian algorithm on batches of matrices.
+ *  @details   This header file contains the declaration of the batch solvers,
+ *             meant for many small independent problems. The matrices are
+ *             split among a pool of threads, and a thread that runs out of
+ *             matrices steals half of the ones another thread has left. Each
+ *             thread keeps its costs, engine workspace and potentials from
+ *             one matrix to the next, growing them only for a larger matrix,
+ *             so a solve allocates nothing but its result.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef HUNGARIAN_BATCH_H
+#define HUNGARIAN_BATCH_H
+
+#include "assignment.h"
+#include "matrix_batch.h"
+#include "matrix_core.h"
+#include "matrix_dense.h"
+
+/**
+ * @brief  Implements the Hungarian algorithm on many matrices at once. Each
+ *         result is the one `HungarianAssignment` gives for its matrix.
+ * @details A matrix that cannot be solved does not stop the others; its
+ *          result is set to NULL, its status says why, and the status of
+ *          the first such matrix is returned.
+ * @param  matrices    - Array with the matrices.
+ * @param  count       - Number of matrices.
+ * @param  threadCount - Number of threads, or 0 for one per processor.
+ * @param  results     - Array of `count` pointers to store the chosen
+ *                       elements of each matrix; free each one with
+ *                       `FreeAssignmentResult`.
+ * @param  statuses    - Array of `count` integers to store the status of
+ *                       each matrix, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The arguments are invalid, or some
+ *                                       matrix is.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Every matrix was solved.
+ */
+__declspec(dllexport) int HungarianAssignmentBatch(Matrix* const* matrices,
+                                                   int count, int threadCount,
+                                                   AssignmentResult** results,
+                                                   int* statuses);
+
+/**
+ * @brief  Implements the Hungarian algorithm on every matrix of a batch
+ *         loaded with `LoadMatrixBatch`, see `HungarianAssignmentBatch`.
+ * @param  batch       - The batch.
+ * @param  threadCount - Number of threads, or 0 for one per processor.
+ * @param  results     - Array of `batch->count` pointers to store the chosen
+ *                       elements of each matrix.
+ * @param  statuses    - Array of `batch->count` integers to store the status
+ *                       of each matrix, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The arguments are invalid, or some
+ *                                       matrix is.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Every matrix was solved.
+ */
+__declspec(dllexport) int HungarianAssignmentMatrixBatch(
+    const MatrixBatch* batch, int threadCount, AssignmentResult** results,
+    int* statuses);
+
+/**
+ * @brief  Implements the Hungarian algorithm on many dense matrices at once,
+ *         see `HungarianAssignmentBatch`. Each result is the one
+ *         `HungarianAssignmentDense` gives for its matrix.
+ * @param  matrices    - Array with the matrices.
+ * @param  count       - Number of matrices.
+ * @param  threadCount - Number of threads, or 0 for one per processor.
+ * @param  results     - Array of `count` pointers to store the chosen
+ *                       elements of each matrix.
+ * @param  statuses    - Array of `count` integers to store the status of
+ *                       each matrix, or NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The arguments are invalid, or some
+ *                                       matrix is empty or holds a value
+ *                                       that is not finite.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Every matrix was solved.
+ */
+__declspec(dllexport) int HungarianAssignmentDenseBatch(
+    const DenseMatrix* const* matrices, int count, int threadCount,
+    AssignmentResult** results, int* statuses);
+
+#endif  // !HUNGARIAN_BATCH_H
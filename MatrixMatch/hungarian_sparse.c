@@ -0,0 +1,537 @@
+/**
+ *
+ *  @file      hungarian_sparse.c
+ *  @brief     Implementation of the Hungarian algorithm on sparse matrices.
+ *  @details   This file contains the shortest augmenting path solver for
+ *             sparse matrices. The problem is the minimization of the
+ *             negated values, with rows as the smaller side. Columns have
+ *             potentials `v`, and every assigned row is assigned to the
+ *             column with the smallest `cost - v` among its cells, so the
+ *             distances of the Dijkstra searches are never negative. Each
+ *             search keeps the columns it reached in a list, and only those
+ *             are reset afterwards.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "hungarian_sparse.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "assignment.h"
+#include "error_codes.h"
+#include "matrix_sparse.h"
+
+// Passes of augmenting row reduction before the shortest path searches
+#define ROW_REDUCTION_PASSES 2
+
+/**
+ * @struct SparseLap
+ * @brief Cells, potentials and assignment of a sparse solve.
+ *
+ * The cells of row `i` are at positions `rowStart[i]` to `rowStart[i + 1] - 1`
+ * of `arcCols` and `arcValues`. They are the arrays of the matrix itself,
+ * or a transposed copy when it has more rows than columns.
+ */
+typedef struct SparseLap {
+  int rows;               // Number of rows, the smaller side
+  int cols;               // Number of columns
+  const int* rowStart;    // First cell of each row, plus the total at the end
+  const int* arcCols;     // Column of each cell
+  const int* arcValues;   // Value of each cell; its cost is the negation
+  int* transposed;        // Allocation of the transposed cells, or NULL
+  double* v;              // Potential of each column
+  int* rowToCol;          // Column assigned to each row, or -1
+  int* colToRow;          // Row assigned to each column, or -1
+  double* assignedCosts;  // Cost of the cell assigned to each row
+  double* distances;      // Distance of each column in the current search
+  int* predecessors;      // Row before each column in the current search
+  double* pathCosts;      // Cost of the cell from `predecessors`
+  int* heap;              // Binary heap of columns ordered by distance
+  int* heapPositions;     // Position in `heap`, -1 unreached, -2 scanned
+  int heapSize;           // Number of columns in `heap`
+  int* reached;           // Columns reached by the current search
+  int reachedCount;       // Number of columns in `reached`
+  int* freeRows;          // Rows without a column
+  int freeCount;          // Number of rows in `freeRows`
+} SparseLap;
+
+/**
+ * @brief Frees the arrays of a solve.
+ * @param solver - The solve.
+ */
+static void FreeSparseLap(SparseLap* solver) {
+  free(solver->transposed);
+  free(solver->v);
+  free(solver->rowToCol);
+  free(solver->colToRow);
+  free(solver->assignedCosts);
+  free(solver->distances);
+  free(solver->predecessors);
+  free(solver->pathCosts);
+  free(solver->heap);
+  free(solver->heapPositions);
+  free(solver->reached);
+  free(solver->freeRows);
+}
+
+/**
+ * @brief  Allocates the arrays of a solve, with every potential at zero,
+ *         nothing assigned and no column reached.
+ * @param  solver - The solve, with its size set.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int AllocateSparseLap(SparseLap* solver) {
+  size_t rows = (size_t)solver->rows;
+  size_t cols = (size_t)solver->cols;
+  solver->v = calloc(cols, sizeof(double));
+  solver->rowToCol = malloc(rows * sizeof(int));
+  solver->colToRow = malloc(cols * sizeof(int));
+  solver->assignedCosts = malloc(rows * sizeof(double));
+  solver->distances = malloc(cols * sizeof(double));
+  solver->predecessors = malloc(cols * sizeof(int));
+  solver->pathCosts = malloc(cols * sizeof(double));
+  solver->heap = malloc(cols * sizeof(int));
+  solver->heapPositions = malloc(cols * sizeof(int));
+  solver->reached = malloc(cols * sizeof(int));
+  solver->freeRows = malloc(rows * sizeof(int));
+  if (solver->v == NULL || solver->rowToCol == NULL ||
+      solver->colToRow == NULL || solver->assignedCosts == NULL ||
+      solver->distances == NULL || solver->predecessors == NULL ||
+      solver->pathCosts == NULL || solver->heap == NULL ||
+      solver->heapPositions == NULL || solver->reached == NULL ||
+      solver->freeRows == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  for (int i = 0; i < solver->rows; i++) {
+    solver->rowToCol[i] = -1;
+    solver->freeRows[i] = i;
+  }
+  solver->freeCount = solver->rows;
+  for (int j = 0; j < solver->cols; j++) {
+    solver->colToRow[j] = -1;
+    solver->distances[j] = HUGE_VAL;
+    solver->heapPositions[j] = -1;
+  }
+  return SUCCESS;
+}
+
+/**
+ * @brief  Points the cells of a solve at the matrix, or at a copy sorted by
+ *         column if the matrix has more rows than columns, and allocates
+ *         the rest of the solve.
+ * @param  matrix - The sparse matrix.
+ * @param  solver - The solve.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int BuildSparseLap(const SparseMatrix* matrix, SparseLap* solver) {
+  if (matrix->height <= matrix->width) {
+    solver->rows = matrix->height;
+    solver->cols = matrix->width;
+    solver->rowStart = matrix->rowOffsets;
+    solver->arcCols = matrix->colIndices;
+    solver->arcValues = matrix->values;
+    return AllocateSparseLap(solver);
+  }
+
+  solver->rows = matrix->width;
+  solver->cols = matrix->height;
+  size_t count = (size_t)matrix->entryCount;
+  solver->transposed =
+      malloc(((size_t)solver->rows + 1 + 2 * count) * sizeof(int));
+  int* cursor = malloc((size_t)solver->rows * sizeof(int));
+  if (solver->transposed == NULL || cursor == NULL) {
+    free(cursor);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  // Counting sort of the cells by column; rows come out in order
+  int* rowStart = solver->transposed;
+  int* arcCols = rowStart + solver->rows + 1;
+  int* arcValues = arcCols + count;
+  for (int i = 0; i <= solver->rows; i++) {
+    rowStart[i] = 0;
+  }
+  for (size_t k = 0; k < count; k++) {
+    rowStart[matrix->colIndices[k] + 1]++;
+  }
+  for (int i = 0; i < solver->rows; i++) {
+    rowStart[i + 1] += rowStart[i];
+    cursor[i] = rowStart[i];
+  }
+  for (int row = 0; row < matrix->height; row++) {
+    for (int k = matrix->rowOffsets[row]; k < matrix->rowOffsets[row + 1];
+         k++) {
+      int position = cursor[matrix->colIndices[k]]++;
+      arcCols[position] = row;
+      arcValues[position] = matrix->values[k];
+    }
+  }
+  free(cursor);
+
+  solver->rowStart = rowStart;
+  solver->arcCols = arcCols;
+  solver->arcValues = arcValues;
+  return AllocateSparseLap(solver);
+}
+
+/**
+ * @brief Moves a column of the heap up to its place.
+ * @param solver - The solve.
+ * @param col    - The column.
+ */
+static void SiftUp(SparseLap* solver, int col) {
+  int position = solver->heapPositions[col];
+  while (position > 0) {
+    int parent = (position - 1) / 2;
+    int parentCol = solver->heap[parent];
+    if (solver->distances[parentCol] <= solver->distances[col]) {
+      break;
+    }
+    solver->heap[position] = parentCol;
+    solver->heapPositions[parentCol] = position;
+    position = parent;
+  }
+  solver->heap[position] = col;
+  solver->heapPositions[col] = position;
+}
+
+/**
+ * @brief  Removes the column with the smallest distance from the heap.
+ * @param  solver - The solve.
+ * @retval The column, marked as scanned.
+ */
+static int PopColumn(SparseLap* solver) {
+  int top = solver->heap[0];
+  int last = solver->heap[--solver->heapSize];
+  solver->heapPositions[top] = -2;
+
+  int position = 0;
+  while (solver->heapSize > 0) {
+    int child = 2 * position + 1;
+    if (child >= solver->heapSize) {
+      break;
+    }
+    if (child + 1 < solver->heapSize &&
+        solver->distances[solver->heap[child + 1]] <
+            solver->distances[solver->heap[child]]) {
+      child++;
+    }
+    if (solver->distances[solver->heap[child]] >= solver->distances[last]) {
+      break;
+    }
+    solver->heap[position] = solver->heap[child];
+    solver->heapPositions[solver->heap[position]] = position;
+    position = child;
+  }
+  if (solver->heapSize > 0) {
+    solver->heap[position] = last;
+    solver->heapPositions[last] = position;
+  }
+  return top;
+}
+
+/**
+ * @brief Column reduction of a square problem: the potential of each column
+ *        is its cheapest cell, and each row takes the column of smallest
+ *        potential among those whose cheapest cell it holds. Every reduced
+ *        cost is then non negative, and zero on the assigned cells. Columns
+ *        without cells keep a zero potential. The rows left without a column
+ *        are stored in `freeRows`.
+ * @param solver - The solve, with nothing assigned.
+ */
+static void ReduceColumns(SparseLap* solver) {
+  int* minimumRows = solver->predecessors;
+  double* minimumCosts = solver->pathCosts;
+  for (int j = 0; j < solver->cols; j++) {
+    minimumRows[j] = -1;
+    minimumCosts[j] = HUGE_VAL;
+  }
+  for (int i = 0; i < solver->rows; i++) {
+    for (int k = solver->rowStart[i]; k < solver->rowStart[i + 1]; k++) {
+      int col = solver->arcCols[k];
+      double cost = -(double)solver->arcValues[k];
+      if (cost < minimumCosts[col]) {
+        minimumCosts[col] = cost;
+        minimumRows[col] = i;
+      }
+    }
+  }
+
+  for (int j = 0; j < solver->cols; j++) {
+    int i = minimumRows[j];
+    if (i < 0) {
+      continue;
+    }
+    solver->v[j] = minimumCosts[j];
+    int assigned = solver->rowToCol[i];
+    if (assigned < 0 || solver->v[j] < solver->v[assigned]) {
+      if (assigned >= 0) {
+        solver->colToRow[assigned] = -1;
+      }
+      solver->rowToCol[i] = j;
+      solver->colToRow[j] = i;
+      solver->assignedCosts[i] = minimumCosts[j];
+    }
+  }
+
+  solver->freeCount = 0;
+  for (int i = 0; i < solver->rows; i++) {
+    if (solver->rowToCol[i] < 0) {
+      solver->freeRows[solver->freeCount++] = i;
+    }
+  }
+}
+
+/**
+ * @brief  Augmenting row reduction: each free row takes the column of its
+ *         cheapest reduced cell, lowering the potential of that column to
+ *         the second cheapest one, and the row it displaces becomes free.
+ * @details A row displaced by a strict decrease is processed again right
+ *          away, at most `rows` times per pass; the others are left in
+ *          `freeRows` for the next pass or the shortest path searches. A row
+ *          with a single cell takes it without changing the potential.
+ * @param  solver - The solve, with the free rows.
+ * @retval `NO_FEASIBLE_ASSIGNMENT` - A row has no cells.
+ * @retval `SUCCESS`                - Operation successful.
+ */
+static int ReduceAugmentingRows(SparseLap* solver) {
+  int* freeRows = solver->freeRows;
+
+  for (int pass = 0; pass < ROW_REDUCTION_PASSES; pass++) {
+    int previousCount = solver->freeCount;
+    int repeats = 0;
+    int k = 0;
+    solver->freeCount = 0;
+
+    while (k < previousCount) {
+      int i = freeRows[k++];
+
+      // Cheapest and second cheapest reduced cells of the row
+      double first = HUGE_VAL;
+      double second = HUGE_VAL;
+      int firstArc = -1;
+      int secondArc = -1;
+      for (int a = solver->rowStart[i]; a < solver->rowStart[i + 1]; a++) {
+        double reduced =
+            -(double)solver->arcValues[a] - solver->v[solver->arcCols[a]];
+        if (reduced < second) {
+          if (reduced >= first) {
+            second = reduced;
+            secondArc = a;
+          } else {
+            second = first;
+            secondArc = firstArc;
+            first = reduced;
+            firstArc = a;
+          }
+        }
+      }
+      if (firstArc < 0) {
+        return NO_FEASIBLE_ASSIGNMENT;
+      }
+
+      int arc = firstArc;
+      int displaced = solver->colToRow[solver->arcCols[arc]];
+      int decreased = first < second && secondArc >= 0;
+      if (decreased) {
+        solver->v[solver->arcCols[arc]] -= second - first;
+      } else if (displaced >= 0 && secondArc >= 0) {
+        arc = secondArc;
+        displaced = solver->colToRow[solver->arcCols[arc]];
+      }
+
+      int col = solver->arcCols[arc];
+      if (displaced >= 0) {
+        solver->rowToCol[displaced] = -1;
+      }
+      solver->rowToCol[i] = col;
+      solver->colToRow[col] = i;
+      solver->assignedCosts[i] = -(double)solver->arcValues[arc];
+
+      if (displaced >= 0) {
+        if (decreased && repeats < solver->rows) {
+          freeRows[--k] = displaced;
+          repeats++;
+        } else {
+          freeRows[solver->freeCount++] = displaced;
+        }
+      }
+    }
+  }
+  return SUCCESS;
+}
+
+/**
+ * @brief Relaxes the cells of a row reached at a given distance.
+ * @param solver - The solve.
+ * @param row    - The row.
+ * @param offset - Distance of the row minus the smallest `cost - v` of its
+ *                 cells, which is the one of its assigned cell.
+ */
+static void RelaxRow(SparseLap* solver, int row, double offset) {
+  for (int k = solver->rowStart[row]; k < solver->rowStart[row + 1]; k++) {
+    int col = solver->arcCols[k];
+    if (solver->heapPositions[col] == -2) {
+      continue;
+    }
+
+    double cost = -(double)solver->arcValues[k];
+    double distance = offset + cost - solver->v[col];
+    if (distance >= solver->distances[col]) {
+      continue;
+    }
+    if (solver->heapPositions[col] == -1) {
+      solver->reached[solver->reachedCount++] = col;
+      solver->heapPositions[col] = solver->heapSize++;
+    }
+    solver->distances[col] = distance;
+    solver->predecessors[col] = row;
+    solver->pathCosts[col] = cost;
+    SiftUp(solver, col);
+  }
+}
+
+/**
+ * @brief  Assigns a free row with a Dijkstra search over the existing cells
+ *         for the closest free column, then updates the potentials of the
+ *         scanned columns and flips the path.
+ * @details The potentials of the scanned columns are raised by their
+ *          distance minus the one of the free column, which keeps every
+ *          reduced cost non negative. Only the reached columns are reset.
+ * @param  solver - The solve.
+ * @param  root   - The free row.
+ * @retval `NO_FEASIBLE_ASSIGNMENT` - No free column can be reached, so no
+ *                                    assignment covers every row.
+ * @retval `SUCCESS`                - Operation successful.
+ */
+static int AugmentRow(SparseLap* solver, int root) {
+  solver->reachedCount = 0;
+  solver->heapSize = 0;
+  RelaxRow(solver, root, 0.0);
+
+  int sink = -1;
+  while (solver->heapSize > 0) {
+    int col = PopColumn(solver);
+    int row = solver->colToRow[col];
+    if (row < 0) {
+      sink = col;
+      break;
+    }
+    RelaxRow(solver, row,
+             solver->distances[col] - solver->assignedCosts[row] +
+                 solver->v[col]);
+  }
+
+  if (sink >= 0) {
+    double sinkDistance = solver->distances[sink];
+    for (int r = 0; r < solver->reachedCount; r++) {
+      int col = solver->reached[r];
+      if (solver->heapPositions[col] == -2) {
+        solver->v[col] += solver->distances[col] - sinkDistance;
+      }
+    }
+
+    int col = sink;
+    while (1) {
+      int row = solver->predecessors[col];
+      int previous = solver->rowToCol[row];
+      solver->rowToCol[row] = col;
+      solver->colToRow[col] = row;
+      solver->assignedCosts[row] = solver->pathCosts[col];
+      if (row == root) {
+        break;
+      }
+      col = previous;
+    }
+  }
+
+  for (int r = 0; r < solver->reachedCount; r++) {
+    int col = solver->reached[r];
+    solver->distances[col] = HUGE_VAL;
+    solver->heapPositions[col] = -1;
+  }
+  return sink >= 0 ? SUCCESS : NO_FEASIBLE_ASSIGNMENT;
+}
+
+/**
+ * @brief  Creates the result of a solve, in the row order of the matrix.
+ * @param  matrix - The sparse matrix.
+ * @param  solver - The solve.
+ * @param  result - Pointer to store the chosen elements.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int ExtractSparseResult(const SparseMatrix* matrix,
+                               const SparseLap* solver,
+                               AssignmentResult** result) {
+  AssignmentResult* selection = NULL;
+  if (CreateAssignmentResult(solver->rows, &selection) != SUCCESS) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  int transposed = solver->transposed != NULL;
+  int status = SUCCESS;
+  for (int row = 0; row < matrix->height && status == SUCCESS; row++) {
+    int solverRow = transposed ? solver->colToRow[row] : row;
+    if (solverRow < 0) {
+      continue;
+    }
+    int solverCol = transposed ? row : solver->rowToCol[row];
+    status = AddAssignment(selection, row, transposed ? solverRow : solverCol,
+                           -solver->assignedCosts[solverRow]);
+  }
+
+  if (status != SUCCESS) {
+    FreeAssignmentResult(selection);
+    return status;
+  }
+
+  *result = selection;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Implements the Hungarian algorithm on a sparse matrix, keeping the
+ *         row and column of each chosen element.
+ * @param  matrix - The sparse matrix.
+ * @param  result - Pointer to store the chosen elements.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `NO_FEASIBLE_ASSIGNMENT`    - The existing cells cannot cover every
+ *                                       row of a wide matrix or column of a
+ *                                       tall one.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int HungarianAssignmentSparse(const SparseMatrix* matrix,
+                              AssignmentResult** result) {
+  if (matrix == NULL || result == NULL || matrix->width <= 0 ||
+      matrix->height <= 0) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  SparseLap solver = {0};
+  int status = BuildSparseLap(matrix, &solver);
+  if (status == SUCCESS) {
+    // Free columns must keep a zero potential, so only square problems
+    // start from the column minima
+    if (solver.rows == solver.cols) {
+      ReduceColumns(&solver);
+    }
+    status = ReduceAugmentingRows(&solver);
+  }
+  for (int k = 0; k < solver.freeCount && status == SUCCESS; k++) {
+    status = AugmentRow(&solver, solver.freeRows[k]);
+  }
+  if (status == SUCCESS) {
+    status = ExtractSparseResult(matrix, &solver, result);
+  }
+
+  FreeSparseLap(&solver);
+  return status;
+}
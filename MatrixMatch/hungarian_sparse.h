@@ -0,0 +1,42 @@
+/**
+ *  @file      hungarian_sparse.h
+ *  @brief     Header file for the Hungarian algorithm on sparse matrices.
+ *  @details   This header file contains the declaration of a shortest
+ *             augmenting path solver in the style of the LAPJVsp code of
+ *             Jonker and Volgenant, for matrices where most cells do not
+ *             exist. Each Dijkstra search only follows the existing cells,
+ *             with a binary heap of the columns it reached, so the memory
+ *             used is O(n + m + entries) and a search costs nothing for the
+ *             columns it never reaches.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef HUNGARIAN_SPARSE_H
+#define HUNGARIAN_SPARSE_H
+
+#include "assignment.h"
+#include "matrix_sparse.h"
+
+/**
+ * @brief  Implements the Hungarian algorithm on a sparse matrix, keeping the
+ *         row and column of each chosen element. Only existing cells can be
+ *         chosen; every row of a wide matrix and every column of a tall one
+ *         is assigned, with the largest possible total.
+ * @details A tall matrix is solved by columns. When the search of a row ends
+ *          without reaching a free column, no assignment of the existing
+ *          cells covers every row, and the solve stops there.
+ * @param  matrix - The sparse matrix.
+ * @param  result - Pointer to store the chosen elements; free it with
+ *                  `FreeAssignmentResult`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `NO_FEASIBLE_ASSIGNMENT`    - The existing cells cannot cover every
+ *                                       row of a wide matrix or column of a
+ *                                       tall one.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int HungarianAssignmentSparse(
+    const SparseMatrix* matrix, AssignmentResult** result);
+
+#endif  // !HUNGARIAN_SPARSE_H
@@ -0,0 +1,863 @@
+/**
+ *
+ *  @file      lap_core.c
+ *  @brief     Implementation of the shortest augmenting path engine used by
+ *             the Hungarian algorithm.
+ *  @details   This file contains the Jonker-Volgenant initialization and the
+ *             Dijkstra shortest augmenting path search with dual potentials.
+ *             Each search scans every column once per step, keeping the
+ *             distances in flat arrays, so a search is O(n^2) and a whole
+ *             problem is O(n^3) in the worst case.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "lap_core.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "error_codes.h"
+#include "platform.h"
+
+// Passes of augmenting row reduction, as in the original Jonker-Volgenant
+#define ROW_REDUCTION_PASSES 2
+
+/**
+ * @brief  Creates the scratch memory for problems of a given size.
+ * @param  rows      - Number of rows.
+ * @param  cols      - Number of columns.
+ * @param  workspace - The new workspace.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateLapWorkspace(int rows, int cols, LapWorkspace** workspace) {
+  LapWorkspace* newWorkspace = calloc(1, sizeof(LapWorkspace));
+  if (newWorkspace == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  newWorkspace->rows = rows;
+  newWorkspace->cols = cols;
+  newWorkspace->distances = malloc((size_t)cols * sizeof(double));
+  newWorkspace->blocked = malloc((size_t)cols * sizeof(double));
+  newWorkspace->predecessors = malloc((size_t)cols * sizeof(int));
+  newWorkspace->scanned = malloc((size_t)cols * sizeof(int));
+  newWorkspace->freeRows = malloc((size_t)rows * sizeof(int));
+  newWorkspace->rowBuffer = malloc((size_t)cols * sizeof(double));
+  newWorkspace->relax = GetFastestLapRelaxKernel();
+  if (newWorkspace->distances == NULL || newWorkspace->blocked == NULL ||
+      newWorkspace->predecessors == NULL || newWorkspace->scanned == NULL ||
+      newWorkspace->freeRows == NULL || newWorkspace->rowBuffer == NULL) {
+    FreeLapWorkspace(newWorkspace);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  *workspace = newWorkspace;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Lets the shortest path searches of a workspace split their columns
+ *         among several threads. Problems too small to gain from it stay
+ *         serial; the results are the same either way.
+ * @param  workspace   - The workspace.
+ * @param  threadCount - Number of threads, counting the caller.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int LapEnableThreads(LapWorkspace* workspace, int threadCount) {
+  FreeLapParallel(workspace->parallel);
+  return CreateLapParallel(threadCount, workspace->cols, workspace->relax,
+                           &workspace->parallel);
+}
+
+/**
+ * @brief Frees the scratch memory of the engine.
+ * @param workspace - The workspace.
+ */
+void FreeLapWorkspace(LapWorkspace* workspace) {
+  if (workspace == NULL) {
+    return;
+  }
+
+  free(workspace->distances);
+  free(workspace->blocked);
+  free(workspace->predecessors);
+  free(workspace->scanned);
+  free(workspace->freeRows);
+  free(workspace->rowBuffer);
+  FreeLapParallel(workspace->parallel);
+  free(workspace);
+}
+
+/**
+ * @brief  Creates an empty assignment with zero potentials.
+ * @param  rows  - Number of rows.
+ * @param  cols  - Number of columns.
+ * @param  state - The new state.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateLapState(int rows, int cols, LapState** state) {
+  LapState* newState = calloc(1, sizeof(LapState));
+  if (newState == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  newState->rows = rows;
+  newState->cols = cols;
+  newState->u = malloc((size_t)rows * sizeof(double));
+  newState->v = malloc((size_t)cols * sizeof(double));
+  newState->rowToCol = malloc((size_t)rows * sizeof(int));
+  newState->colToRow = malloc((size_t)cols * sizeof(int));
+  if (newState->u == NULL || newState->v == NULL ||
+      newState->rowToCol == NULL || newState->colToRow == NULL) {
+    FreeLapState(newState);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  ResetLapState(newState);
+  *state = newState;
+  return SUCCESS;
+}
+
+/**
+ * @brief Clears the assignment and the potentials of a state.
+ * @param state - The state.
+ */
+void ResetLapState(LapState* state) {
+  for (int i = 0; i < state->rows; i++) {
+    state->u[i] = 0.0;
+    state->rowToCol[i] = -1;
+  }
+  for (int j = 0; j < state->cols; j++) {
+    state->v[j] = 0.0;
+    state->colToRow[j] = -1;
+  }
+}
+
+/**
+ * @brief Frees a state.
+ * @param state - The state.
+ */
+void FreeLapState(LapState* state) {
+  if (state == NULL) {
+    return;
+  }
+
+  free(state->u);
+  free(state->v);
+  free(state->rowToCol);
+  free(state->colToRow);
+  free(state);
+}
+
+/**
+ * @brief Column reduction: each column gets the smallest cost of the column
+ *        as its potential and is assigned to the row holding it, unless that
+ *        row already has a column with a smaller potential.
+ * @param cost      - The costs.
+ * @param workspace - The workspace; `scanned` holds, for each row, how many
+ *                    columns had their minimum in it.
+ * @param state     - The state.
+ */
+static void ReduceColumns(const LapCost* cost, LapWorkspace* workspace,
+                          LapState* state) {
+  int n = cost->cols;
+  int* minimumRow = workspace->predecessors;
+  int* matches = workspace->scanned;
+
+  // Costs are read by row, so the column minima are found in a single sweep
+  for (int j = 0; j < n; j++) {
+    state->v[j] = HUGE_VAL;
+    minimumRow[j] = 0;
+    matches[j] = 0;
+  }
+  for (int i = 0; i < n; i++) {
+    const double* costs = cost->getRow(cost->context, i, workspace->rowBuffer);
+    for (int j = 0; j < n; j++) {
+      if (costs[j] < state->v[j]) {
+        state->v[j] = costs[j];
+        minimumRow[j] = i;
+      }
+    }
+  }
+
+  for (int j = n - 1; j >= 0; j--) {
+    int i = minimumRow[j];
+    if (++matches[i] == 1) {
+      state->rowToCol[i] = j;
+      state->colToRow[j] = i;
+    } else if (state->v[j] < state->v[state->rowToCol[i]]) {
+      state->colToRow[state->rowToCol[i]] = -1;
+      state->rowToCol[i] = j;
+      state->colToRow[j] = i;
+    }
+  }
+}
+
+/**
+ * @brief Reduction transfer: a row that was the minimum of exactly one
+ *        column moves the slack of its second cheapest cell into the
+ *        potential of that column. Rows without a column are stored in
+ *        `workspace->freeRows`.
+ * @param cost      - The costs.
+ * @param workspace - The workspace, after `ReduceColumns`.
+ * @param state     - The state.
+ */
+static void TransferReductions(const LapCost* cost, LapWorkspace* workspace,
+                               LapState* state) {
+  int n = cost->cols;
+  const int* matches = workspace->scanned;
+
+  workspace->freeCount = 0;
+  for (int i = 0; i < n; i++) {
+    if (matches[i] == 0) {
+      workspace->freeRows[workspace->freeCount++] = i;
+      continue;
+    }
+
+    int assigned = state->rowToCol[i];
+    if (matches[i] > 1 || n == 1) {
+      state->u[i] = 0.0;
+      continue;
+    }
+
+    const double* costs = cost->getRow(cost->context, i, workspace->rowBuffer);
+    double minimum = HUGE_VAL;
+    for (int j = 0; j < n; j++) {
+      if (j != assigned && costs[j] - state->v[j] < minimum) {
+        minimum = costs[j] - state->v[j];
+      }
+    }
+    state->v[assigned] -= minimum;
+    state->u[i] = minimum;
+  }
+}
+
+/**
+ * @brief Augmenting row reduction: each free row takes the column of its
+ *        cheapest reduced cell, lowering the potential of that column to
+ *        the second cheapest one, and the row it displaces becomes free.
+ * @details A row displaced by a strict decrease is processed again right
+ *          away. Those repeats are limited to `n` per pass, so a pass is
+ *          O(n^2); past the limit the displaced row is left for the shortest
+ *          path phase. Once the deadline of the workspace passes, every row
+ *          left is.
+ * @param cost      - The costs.
+ * @param workspace - The workspace, with the free rows.
+ * @param state     - The state.
+ */
+static void ReduceAugmentingRows(const LapCost* cost, LapWorkspace* workspace,
+                                 LapState* state) {
+  int n = cost->cols;
+  int* freeRows = workspace->freeRows;
+
+  for (int pass = 0; pass < ROW_REDUCTION_PASSES; pass++) {
+    int previousCount = workspace->freeCount;
+    int repeats = 0;
+    int k = 0;
+    workspace->freeCount = 0;
+
+    while (k < previousCount) {
+      if (workspace->deadline > 0.0 &&
+          GetMonotonicTime() > workspace->deadline) {
+        // The rows not reduced yet are left to the shortest path phase,
+        // which stops before its first search
+        while (k < previousCount) {
+          freeRows[workspace->freeCount++] = freeRows[k++];
+        }
+        return;
+      }
+
+      int i = freeRows[k++];
+      const double* costs =
+          cost->getRow(cost->context, i, workspace->rowBuffer);
+
+      // Cheapest and second cheapest reduced cells of the row
+      double first = costs[0] - state->v[0];
+      double second = HUGE_VAL;
+      int firstCol = 0;
+      int secondCol = 0;
+      for (int j = 1; j < n; j++) {
+        double reduced = costs[j] - state->v[j];
+        if (reduced < second) {
+          if (reduced >= first) {
+            second = reduced;
+            secondCol = j;
+          } else {
+            second = first;
+            secondCol = firstCol;
+            first = reduced;
+            firstCol = j;
+          }
+        }
+      }
+
+      int col = firstCol;
+      int displaced = state->colToRow[col];
+      if (first < second) {
+        state->v[col] -= second - first;
+      } else if (displaced >= 0) {
+        col = secondCol;
+        displaced = state->colToRow[col];
+      }
+
+      if (displaced >= 0) {
+        state->rowToCol[displaced] = -1;
+      }
+      state->rowToCol[i] = col;
+      state->colToRow[col] = i;
+      state->u[i] = second;
+
+      if (displaced >= 0) {
+        if (first < second && repeats < n) {
+          freeRows[--k] = displaced;
+          repeats++;
+        } else {
+          freeRows[workspace->freeCount++] = displaced;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief  Builds the initial assignment of a square problem with the
+ *         Jonker-Volgenant column reduction, reduction transfer and two
+ *         passes of augmenting row reduction. The rows left without a column
+ *         are stored in `workspace->freeRows`.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state, overwritten.
+ */
+void LapInitialize(const LapCost* cost, LapWorkspace* workspace,
+                   LapState* state) {
+  ResetLapState(state);
+  ReduceColumns(cost, workspace, state);
+  TransferReductions(cost, workspace, state);
+  if (cost->cols > 1) {
+    ReduceAugmentingRows(cost, workspace, state);
+  }
+}
+
+/**
+ * @brief  Builds an initial assignment from the column potentials of the
+ *         state: each row gets the potential that makes its cheapest cell
+ *         tight, and takes the first free tight column. The rows left
+ *         without a column are stored in `workspace->freeRows`.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state, with the column potentials set.
+ */
+void LapAssignTightCells(const LapCost* cost, LapWorkspace* workspace,
+                         LapState* state) {
+  for (int i = 0; i < cost->rows; i++) {
+    state->rowToCol[i] = -1;
+  }
+  for (int j = 0; j < cost->cols; j++) {
+    state->colToRow[j] = -1;
+  }
+
+  workspace->freeCount = 0;
+  for (int i = 0; i < cost->rows; i++) {
+    const double* costs = cost->getRow(cost->context, i, workspace->rowBuffer);
+    double minimum = HUGE_VAL;
+    int col = -1;
+    for (int j = 0; j < cost->cols; j++) {
+      double reduced = costs[j] - state->v[j];
+      if (reduced < minimum) {
+        minimum = reduced;
+        col = state->colToRow[j] < 0 ? j : -1;
+      } else if (reduced == minimum && col < 0 && state->colToRow[j] < 0) {
+        col = j;
+      }
+    }
+
+    state->u[i] = minimum < HUGE_VAL ? minimum : 0.0;
+    if (col >= 0 && minimum < HUGE_VAL) {
+      state->rowToCol[i] = col;
+      state->colToRow[col] = i;
+    } else {
+      workspace->freeRows[workspace->freeCount++] = i;
+    }
+  }
+}
+
+/**
+ * @brief  Relaxes the distances of the unscanned columns through a row and
+ *         finds the unscanned column with the smallest distance.
+ * @param  costs     - Costs of the row.
+ * @param  v         - Column potentials.
+ * @param  offset    - Distance of the row minus its potential.
+ * @param  row       - The row.
+ * @param  workspace - The workspace.
+ * @param  cols      - Number of columns.
+ * @retval The closest unscanned column, the lowest index on ties, or -1 if
+ *         no unscanned column can be reached.
+ */
+static int RelaxRow(const double* costs, const double* v, double offset,
+                    int row, LapWorkspace* workspace, int cols) {
+  if (workspace->parallel != NULL) {
+    return LapParallelRelax(workspace->parallel, costs, v, offset, row,
+                            workspace->distances, workspace->blocked,
+                            workspace->predecessors);
+  }
+  return workspace->relax(costs, v, offset, row, workspace->distances,
+                          workspace->blocked, workspace->predecessors, cols);
+}
+
+/**
+ * @brief  Assigns a free row with a shortest augmenting path, updating the
+ *         potentials so they stay feasible.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state.
+ * @param  row       - The free row.
+ * @retval `NO_FEASIBLE_ASSIGNMENT` - No path reaches a free column.
+ * @retval `SUCCESS`                - Operation successful.
+ */
+int LapAugmentRow(const LapCost* cost, LapWorkspace* workspace,
+                  LapState* state, int row) {
+  int cols = cost->cols;
+  double* distances = workspace->distances;
+  int* scanned = workspace->scanned;
+
+  for (int j = 0; j < cols; j++) {
+    distances[j] = HUGE_VAL;
+    workspace->blocked[j] = 0.0;
+  }
+
+  // Dijkstra over the columns: each step scans the closest column and, if
+  // it is assigned, relaxes the columns through its row
+  int scannedCount = 0;
+  int sink = -1;
+  int i = row;
+  double minimum = 0.0;
+  while (sink < 0) {
+    const double* costs = cost->getRow(cost->context, i, workspace->rowBuffer);
+    int j = RelaxRow(costs, state->v, minimum - state->u[i], i, workspace,
+                     cols);
+    if (j < 0) {
+      return NO_FEASIBLE_ASSIGNMENT;
+    }
+
+    minimum = distances[j];
+    workspace->blocked[j] = HUGE_VAL;
+    scanned[scannedCount++] = j;
+    if (state->colToRow[j] < 0) {
+      sink = j;
+    } else {
+      i = state->colToRow[j];
+    }
+  }
+
+  // Potentials of the scanned rows and columns
+  state->u[row] += minimum;
+  for (int k = 0; k < scannedCount; k++) {
+    int j = scanned[k];
+    double slack = minimum - distances[j];
+    if (state->colToRow[j] >= 0) {
+      state->u[state->colToRow[j]] += slack;
+    }
+    state->v[j] -= slack;
+  }
+
+  // Flip the path from the sink back to the row
+  int j = sink;
+  while (1) {
+    i = workspace->predecessors[j];
+    state->colToRow[j] = i;
+    int previous = state->rowToCol[i];
+    state->rowToCol[i] = j;
+    if (i == row) {
+      break;
+    }
+    j = previous;
+  }
+
+  return SUCCESS;
+}
+
+/**
+ * @brief  Finds the unscanned column with the smallest distance.
+ * @param  workspace - The workspace.
+ * @param  cols      - Number of columns.
+ * @retval The closest unscanned column, the lowest index on ties, or -1 if
+ *         no unscanned column can be reached.
+ */
+static int FindClosestColumn(const LapWorkspace* workspace, int cols) {
+  int closest = -1;
+  double closestDistance = HUGE_VAL;
+  for (int j = 0; j < cols; j++) {
+    double key = workspace->distances[j] + workspace->blocked[j];
+    if (key < closestDistance) {
+      closestDistance = key;
+      closest = j;
+    }
+  }
+
+  return closest;
+}
+
+/**
+ * @brief Releases a free column whose potential is below `level`, the
+ *        potential shared by the other free columns of a problem with more
+ *        columns than rows.
+ * @details The column is handled as if a virtual row with zero costs held
+ *          it. A shortest path search from that row ends when it scans the
+ *          column; the rows on the path move one column along it, and the
+ *          virtual row keeps the first column of the path, which becomes
+ *          free. The other free columns end their branch of the search:
+ *          those at the level are held by virtual rows that cannot shorten
+ *          any distance, and those below it stay below the new level.
+ * @param cost      - The costs.
+ * @param workspace - The workspace.
+ * @param state     - The state, with feasible potentials.
+ * @param col       - The free column.
+ * @param level     - Potential of the free columns, not below the potential
+ *                    of any assigned column.
+ */
+static void ReleaseColumn(const LapCost* cost, LapWorkspace* workspace,
+                          LapState* state, int col, double level) {
+  int cols = cost->cols;
+  double* distances = workspace->distances;
+  int* predecessors = workspace->predecessors;
+  int* scanned = workspace->scanned;
+
+  for (int j = 0; j < cols; j++) {
+    distances[j] = level - state->v[j];
+    workspace->blocked[j] = 0.0;
+    predecessors[j] = -1;
+  }
+
+  int scannedCount = 0;
+  double minimum = 0.0;
+  int j = FindClosestColumn(workspace, cols);
+  while (j >= 0 && j != col) {
+    minimum = distances[j];
+    workspace->blocked[j] = HUGE_VAL;
+    scanned[scannedCount++] = j;
+
+    int i = state->colToRow[j];
+    if (i < 0) {
+      j = FindClosestColumn(workspace, cols);
+    } else {
+      const double* costs =
+          cost->getRow(cost->context, i, workspace->rowBuffer);
+      j = RelaxRow(costs, state->v, minimum - state->u[i], i, workspace,
+                   cols);
+    }
+  }
+  if (j < 0) {
+    return;
+  }
+
+  // Potentials of the scanned rows and columns
+  minimum = distances[col];
+  for (int k = 0; k < scannedCount; k++) {
+    int scannedCol = scanned[k];
+    double slack = minimum - distances[scannedCol];
+    if (state->colToRow[scannedCol] >= 0) {
+      state->u[state->colToRow[scannedCol]] += slack;
+    }
+    state->v[scannedCol] -= slack;
+  }
+
+  // Flip the path from the column back to the virtual row
+  int i = predecessors[col];
+  j = col;
+  while (i >= 0) {
+    int previous = state->rowToCol[i];
+    state->rowToCol[i] = j;
+    state->colToRow[j] = i;
+    j = previous;
+    i = predecessors[j];
+  }
+  state->colToRow[j] = -1;
+}
+
+/**
+ * @brief  Brings every free column of a problem with more columns than rows
+ *         to a common potential, not below the potential of any assigned
+ *         column, which together with feasible potentials proves that the
+ *         assigned rows use the best columns.
+ * @details Free columns above the largest assigned potential are lowered to
+ *          it, which keeps the potentials feasible. Free columns below it
+ *          are released one at a time with `ReleaseColumn`.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state, with feasible potentials.
+ */
+static void ReleaseFreeColumns(const LapCost* cost, LapWorkspace* workspace,
+                               LapState* state) {
+  while (1) {
+    double level = -HUGE_VAL;
+    double lowest = HUGE_VAL;
+    for (int j = 0; j < cost->cols; j++) {
+      lowest = state->v[j] < lowest ? state->v[j] : lowest;
+      if (state->colToRow[j] >= 0 && state->v[j] > level) {
+        level = state->v[j];
+      }
+    }
+    if (level == -HUGE_VAL) {
+      level = lowest;
+    }
+
+    int col = -1;
+    for (int j = 0; j < cost->cols; j++) {
+      if (state->colToRow[j] >= 0) {
+        continue;
+      }
+      if (state->v[j] >= level) {
+        state->v[j] = level;
+      } else if (col < 0) {
+        col = j;
+      }
+    }
+    if (col < 0) {
+      return;
+    }
+
+    ReleaseColumn(cost, workspace, state, col, level);
+  }
+}
+
+/**
+ * @brief  Repairs a previous assignment and its potentials after the costs
+ *         changed, so that only the rows that lost their column need a
+ *         shortest path search.
+ * @details Each row gets the potential that makes its cheapest cell tight,
+ *          which restores dual feasibility, and keeps its column only if
+ *          that cell is still tight. With more columns than rows, the free
+ *          columns are then brought to a common potential with
+ *          `ReleaseFreeColumns`, one shortest path search per free column
+ *          below the assigned ones. When more free columns than rows need
+ *          that search, the previous solution is discarded and the
+ *          assignment restarts from zero potentials.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace; the rows left without a column are
+ *                     stored in `freeRows`.
+ * @param  state     - The state, with the previous assignment in
+ *                     `rowToCol` and the previous column potentials.
+ */
+void LapRepairState(const LapCost* cost, LapWorkspace* workspace,
+                    LapState* state) {
+  // Rebuild `colToRow`, dropping invalid or repeated columns
+  for (int j = 0; j < cost->cols; j++) {
+    state->colToRow[j] = -1;
+  }
+  for (int i = 0; i < cost->rows; i++) {
+    int j = state->rowToCol[i];
+    if (j < 0 || j >= cost->cols || state->colToRow[j] >= 0) {
+      state->rowToCol[i] = -1;
+    } else {
+      state->colToRow[j] = i;
+    }
+  }
+
+  workspace->freeCount = 0;
+  for (int i = 0; i < cost->rows; i++) {
+    const double* costs = cost->getRow(cost->context, i, workspace->rowBuffer);
+    double minimum = HUGE_VAL;
+    for (int j = 0; j < cost->cols; j++) {
+      double reduced = costs[j] - state->v[j];
+      minimum = reduced < minimum ? reduced : minimum;
+    }
+    state->u[i] = minimum < HUGE_VAL ? minimum : 0.0;
+
+    // A cell that cannot be assigned is never kept, even in a row where
+    // every cell is one
+    int j = state->rowToCol[i];
+    if (j >= 0 && !(costs[j] < HUGE_VAL && costs[j] - state->v[j] <= minimum)) {
+      state->rowToCol[i] = -1;
+      state->colToRow[j] = -1;
+    }
+    if (state->rowToCol[i] < 0) {
+      workspace->freeRows[workspace->freeCount++] = i;
+    }
+  }
+
+  // Square problems end with every column assigned, so the potentials of
+  // the free columns do not matter
+  if (cost->rows == cost->cols) {
+    return;
+  }
+
+  double level = -HUGE_VAL;
+  for (int j = 0; j < cost->cols; j++) {
+    if (state->colToRow[j] >= 0 && state->v[j] > level) {
+      level = state->v[j];
+    }
+  }
+  int below = 0;
+  for (int j = 0; j < cost->cols; j++) {
+    below += state->colToRow[j] < 0 && state->v[j] < level;
+  }
+
+  if (below > cost->rows) {
+    for (int j = 0; j < cost->cols; j++) {
+      state->v[j] = 0.0;
+    }
+    LapAssignTightCells(cost, workspace, state);
+    return;
+  }
+
+  ReleaseFreeColumns(cost, workspace, state);
+}
+
+/**
+ * @brief  Assigns every row in `workspace->freeRows`, stopping before a
+ *         search once the deadline or the search limit is reached.
+ * @details The clock is read once per search, which costs far less than
+ *          the O(n m) search itself, so a deadline is overrun by at most
+ *          one search.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state.
+ * @retval `NO_FEASIBLE_ASSIGNMENT` - Some row cannot be assigned.
+ * @retval `TIME_LIMIT_REACHED`     - The deadline or the search limit was
+ *                                    reached; the rows left are in
+ *                                    `workspace->freeRows`.
+ * @retval `SUCCESS`                - Operation successful.
+ */
+int LapAugmentFreeRows(const LapCost* cost, LapWorkspace* workspace,
+                       LapState* state) {
+  for (int k = 0; k < workspace->freeCount; k++) {
+    if ((workspace->searchLimit > 0 &&
+         workspace->searchCount >= workspace->searchLimit) ||
+        (workspace->deadline > 0.0 &&
+         GetMonotonicTime() > workspace->deadline)) {
+      // Keep the rows not assigned yet at the front of `freeRows`
+      for (int i = k; i < workspace->freeCount; i++) {
+        workspace->freeRows[i - k] = workspace->freeRows[i];
+      }
+      workspace->freeCount -= k;
+      return TIME_LIMIT_REACHED;
+    }
+    if (workspace->searchLimit > 0) {
+      workspace->searchCount++;
+    }
+
+    int status = LapAugmentRow(cost, workspace, state, workspace->freeRows[k]);
+    if (status != SUCCESS) {
+      return status;
+    }
+  }
+  workspace->freeCount = 0;
+
+  return SUCCESS;
+}
+
+/**
+ * @brief  Assigns each row in `workspace->freeRows` the cheapest column
+ *         still free, without updating the potentials.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state.
+ * @retval `NO_FEASIBLE_ASSIGNMENT` - Some row has no free column left.
+ * @retval `SUCCESS`                - Operation successful.
+ */
+int LapCompleteGreedily(const LapCost* cost, LapWorkspace* workspace,
+                        LapState* state) {
+  for (int k = 0; k < workspace->freeCount; k++) {
+    int i = workspace->freeRows[k];
+    const double* costs = cost->getRow(cost->context, i, workspace->rowBuffer);
+    int best = -1;
+    for (int j = 0; j < cost->cols; j++) {
+      if (state->colToRow[j] < 0 && costs[j] < HUGE_VAL &&
+          (best < 0 || costs[j] < costs[best])) {
+        best = j;
+      }
+    }
+    if (best < 0) {
+      return NO_FEASIBLE_ASSIGNMENT;
+    }
+    state->rowToCol[i] = best;
+    state->colToRow[best] = i;
+  }
+  workspace->freeCount = 0;
+
+  return SUCCESS;
+}
+
+/**
+ * @brief  Orders two potentials, for `qsort`.
+ * @param  a - The first potential.
+ * @param  b - The second potential.
+ * @retval Negative, zero or positive as `a` is below, equal or above `b`.
+ */
+static int ComparePotentials(const void* a, const void* b) {
+  double x = *(const double*)a;
+  double y = *(const double*)b;
+  return (x > y) - (x < y);
+}
+
+/**
+ * @brief  Computes a lower bound on the cost of every assignment from the
+ *         column potentials of a state.
+ * @details For any assignment, the cost of row `i` on column `j` is its
+ *          reduced cost `c(i, j) - v(j)`, at least the smallest one of the
+ *          row, plus `v(j)`; the columns of the assignment are distinct, so
+ *          their potentials add up to at least the `rows` smallest ones.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace; its distances are overwritten.
+ * @param  state     - The state.
+ * @retval The lower bound, or `HUGE_VAL` if some row has no allowed cell.
+ */
+double LapLowerBound(const LapCost* cost, LapWorkspace* workspace,
+                     const LapState* state) {
+  double bound = 0.0;
+  for (int i = 0; i < cost->rows; i++) {
+    const double* costs = cost->getRow(cost->context, i, workspace->rowBuffer);
+    double smallest = HUGE_VAL;
+    for (int j = 0; j < cost->cols; j++) {
+      double reduced = costs[j] - state->v[j];
+      smallest = reduced < smallest ? reduced : smallest;
+    }
+    if (smallest == HUGE_VAL) {
+      return HUGE_VAL;
+    }
+    bound += smallest;
+  }
+
+  double* potentials = workspace->distances;
+  for (int j = 0; j < cost->cols; j++) {
+    potentials[j] = state->v[j];
+  }
+  if (cost->rows < cost->cols) {
+    qsort(potentials, cost->cols, sizeof(double), ComparePotentials);
+  }
+  for (int j = 0; j < cost->rows; j++) {
+    bound += potentials[j];
+  }
+  return bound;
+}
+
+/**
+ * @brief  Solves an assignment problem from scratch, assigning every row.
+ * @details Square problems start with the Jonker-Volgenant initialization.
+ *          When there are more columns than rows, the columns start with zero
+ *          potentials, which keeps the potential of every unassigned column
+ *          at zero as required for optimality, and each row takes its
+ *          cheapest free cell before the shortest path phase.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state, overwritten with the optimal assignment
+ *                     and potentials.
+ * @retval `NO_FEASIBLE_ASSIGNMENT` - Some row cannot be assigned.
+ * @retval `TIME_LIMIT_REACHED`     - The deadline or the search limit was
+ *                                    reached.
+ * @retval `SUCCESS`                - Operation successful.
+ */
+int SolveLap(const LapCost* cost, LapWorkspace* workspace, LapState* state) {
+  if (cost->rows == cost->cols) {
+    LapInitialize(cost, workspace, state);
+  } else {
+    ResetLapState(state);
+    LapAssignTightCells(cost, workspace, state);
+  }
+  return LapAugmentFreeRows(cost, workspace, state);
+}
@@ -0,0 +1,248 @@
+/**
+ *  @file      lap_core.h
+ *  @brief     Header file for the shortest augmenting path engine used by
+ *             the Hungarian algorithm.
+ *  @details   This header file declares the internal engine that solves
+ *             linear assignment problems in minimization form with the
+ *             Jonker-Volgenant initialization (column reduction, reduction
+ *             transfer and augmenting row reduction) followed by one
+ *             Dijkstra shortest augmenting path search per free row, in
+ *             O(n^2 m) time for n rows and m >= n columns. The engine reads
+ *             costs one row at a time through `LapCost`, so it does not
+ *             depend on how the matrix is stored. These functions are not
+ *             exported by the library.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef LAP_CORE_H
+#define LAP_CORE_H
+
+#include "lap_parallel.h"
+#include "lap_simd.h"
+
+/**
+ * @brief  Gets the costs of one row of an assignment problem.
+ * @param  context - The `context` of the `LapCost`.
+ * @param  row     - The row.
+ * @param  buffer  - Array of `cols` doubles that may be filled with the
+ *                   costs.
+ * @retval Pointer to the `cols` costs of the row: either `buffer` or memory
+ *         owned by the context that stays valid until the next call.
+ */
+typedef const double* (*LapRowFunction)(void* context, int row,
+                                        double* buffer);
+
+/**
+ * @struct LapCost
+ * @brief Cost matrix of an assignment problem, read one row at a time.
+ *
+ * Costs are minimized. Every cost must be finite, or `HUGE_VAL` for cells
+ * that cannot be assigned.
+ */
+typedef struct LapCost {
+  int rows;               // Number of rows
+  int cols;               // Number of columns, at least `rows`
+  LapRowFunction getRow;  // Gets the costs of a row
+  void* context;          // Argument of `getRow`
+} LapCost;
+
+/**
+ * @struct LapState
+ * @brief Assignment and dual potentials of an assignment problem.
+ *
+ * The potentials are feasible (`cost[i][j] - u[i] - v[j] >= 0`) for every
+ * assigned row, with equality on the assigned cells.
+ */
+typedef struct LapState {
+  int rows;       // Number of rows
+  int cols;       // Number of columns
+  double* u;      // Potential of each row
+  double* v;      // Potential of each column
+  int* rowToCol;  // Column assigned to each row, or -1
+  int* colToRow;  // Row assigned to each column, or -1
+} LapState;
+
+/**
+ * @struct LapWorkspace
+ * @brief Scratch memory of the engine, reusable between problems of the
+ *        same size or smaller ones.
+ */
+typedef struct LapWorkspace {
+  int rows;               // Number of rows
+  int cols;               // Number of columns
+  double* distances;      // Shortest path distance of each column
+  double* blocked;        // 0 for columns not scanned yet, `HUGE_VAL` after
+  int* predecessors;      // Row before each column in the shortest paths
+  int* scanned;           // Columns scanned by the current search
+  int* freeRows;          // Rows without a column
+  int freeCount;          // Number of rows in `freeRows`
+  double* rowBuffer;      // Buffer given to `LapCost.getRow`
+  LapRelaxKernel relax;   // Kernel of the shortest path searches
+  LapParallel* parallel;  // Threads sharing the searches, or NULL
+  double deadline;        // Time after which no search starts, or 0
+  int searchLimit;        // Searches allowed, or 0 for no limit
+  int searchCount;        // Searches run while `searchLimit` is set
+} LapWorkspace;
+
+/**
+ * @brief  Creates the scratch memory for problems of a given size.
+ * @param  rows      - Number of rows.
+ * @param  cols      - Number of columns.
+ * @param  workspace - The new workspace.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateLapWorkspace(int rows, int cols, LapWorkspace** workspace);
+
+/**
+ * @brief  Lets the shortest path searches of a workspace split their columns
+ *         among several threads. Problems too small to gain from it stay
+ *         serial; the results are the same either way.
+ * @param  workspace   - The workspace.
+ * @param  threadCount - Number of threads, counting the caller.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int LapEnableThreads(LapWorkspace* workspace, int threadCount);
+
+/**
+ * @brief Frees the scratch memory of the engine.
+ * @param workspace - The workspace.
+ */
+void FreeLapWorkspace(LapWorkspace* workspace);
+
+/**
+ * @brief  Creates an empty assignment with zero potentials.
+ * @param  rows  - Number of rows.
+ * @param  cols  - Number of columns.
+ * @param  state - The new state.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateLapState(int rows, int cols, LapState** state);
+
+/**
+ * @brief Clears the assignment and the potentials of a state.
+ * @param state - The state.
+ */
+void ResetLapState(LapState* state);
+
+/**
+ * @brief Frees a state.
+ * @param state - The state.
+ */
+void FreeLapState(LapState* state);
+
+/**
+ * @brief  Builds the initial assignment of a square problem with the
+ *         Jonker-Volgenant column reduction, reduction transfer and two
+ *         passes of augmenting row reduction. The rows left without a column
+ *         are stored in `workspace->freeRows`.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state, overwritten.
+ */
+void LapInitialize(const LapCost* cost, LapWorkspace* workspace,
+                   LapState* state);
+
+/**
+ * @brief  Builds an initial assignment from the column potentials of the
+ *         state: each row gets the potential that makes its cheapest cell
+ *         tight, and takes the first free tight column. The rows left
+ *         without a column are stored in `workspace->freeRows`.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state, with the column potentials set.
+ */
+void LapAssignTightCells(const LapCost* cost, LapWorkspace* workspace,
+                         LapState* state);
+
+/**
+ * @brief  Repairs a previous assignment and its potentials after the costs
+ *         changed: each row gets the potential that makes its cheapest cell
+ *         tight and keeps its column only if that cell is still tight.
+ *         With more columns than rows, the free columns are then brought to
+ *         a common potential above the assigned ones. The rows left without
+ *         a column are stored in `workspace->freeRows`.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state, with the previous assignment in
+ *                     `rowToCol` and the previous column potentials.
+ */
+void LapRepairState(const LapCost* cost, LapWorkspace* workspace,
+                    LapState* state);
+
+/**
+ * @brief  Assigns a free row with a shortest augmenting path, updating the
+ *         potentials so they stay feasible.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state.
+ * @param  row       - The free row.
+ * @retval `NO_FEASIBLE_ASSIGNMENT` - No path reaches a free column.
+ * @retval `SUCCESS`                - Operation successful.
+ */
+int LapAugmentRow(const LapCost* cost, LapWorkspace* workspace,
+                  LapState* state, int row);
+
+/**
+ * @brief  Assigns every row in `workspace->freeRows`. Before each search,
+ *         the deadline and the search limit of the workspace are checked;
+ *         once either is reached, the rows not assigned yet are left in
+ *         `workspace->freeRows`.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state.
+ * @retval `NO_FEASIBLE_ASSIGNMENT` - Some row cannot be assigned.
+ * @retval `TIME_LIMIT_REACHED`     - The deadline or the search limit was
+ *                                    reached.
+ * @retval `SUCCESS`                - Operation successful.
+ */
+int LapAugmentFreeRows(const LapCost* cost, LapWorkspace* workspace,
+                       LapState* state);
+
+/**
+ * @brief  Assigns each row in `workspace->freeRows` the cheapest column
+ *         still free, without updating the potentials, so the assignment is
+ *         complete but no longer optimal.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state.
+ * @retval `NO_FEASIBLE_ASSIGNMENT` - Some row has no free column left.
+ * @retval `SUCCESS`                - Operation successful.
+ */
+int LapCompleteGreedily(const LapCost* cost, LapWorkspace* workspace,
+                        LapState* state);
+
+/**
+ * @brief  Computes a lower bound on the cost of every assignment from the
+ *         column potentials of a state, which need not be optimal: each row
+ *         costs at least its smallest reduced cost, and the columns taken
+ *         add at least the `rows` smallest potentials. At the optimum the
+ *         bound is the optimal cost.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state.
+ * @retval The lower bound, or `HUGE_VAL` if some row has no allowed cell.
+ */
+double LapLowerBound(const LapCost* cost, LapWorkspace* workspace,
+                     const LapState* state);
+
+/**
+ * @brief  Solves an assignment problem from scratch, assigning every row.
+ *         Square problems start with the Jonker-Volgenant initialization;
+ *         with more columns than rows, the columns start with zero
+ *         potentials.
+ * @param  cost      - The costs.
+ * @param  workspace - The workspace.
+ * @param  state     - The state, overwritten with the optimal assignment
+ *                     and potentials.
+ * @retval `NO_FEASIBLE_ASSIGNMENT` - Some row cannot be assigned.
+ * @retval `TIME_LIMIT_REACHED`     - The deadline or the search limit was
+ *                                    reached.
+ * @retval `SUCCESS`                - Operation successful.
+ */
+int SolveLap(const LapCost* cost, LapWorkspace* workspace, LapState* state);
+
+#endif  // !LAP_CORE_H
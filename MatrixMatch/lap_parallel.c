@@ -0,0 +1,258 @@
+/**
+ *
+ *  @file      lap_parallel.c
+ *  @brief     Implementation of the parallel relaxation of the shortest
+ *             augmenting path engine.
+ *  @details   This file contains the pool of threads that relaxes blocks of
+ *             columns. The caller publishes each step through a
+ *             `StepBarrier`, relaxes the first block itself and busy waits
+ *             until every worker has counted its block as finished; the closest
+ *             column of each block lives in its own cache line.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "lap_parallel.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "constants.h"
+#include "error_codes.h"
+#include "platform.h"
+
+/**
+ * @struct LapBlock
+ * @brief Block of columns of one thread and the closest column it found in
+ *        the last step. Blocks are stored one per cache line.
+ */
+typedef struct LapBlock {
+  LapParallel* parallel;  // The pool
+  int first;              // First column of the block
+  int count;              // Number of columns of the block
+  int closest;            // Closest column of the last step, or -1
+  double distance;        // Distance of `closest`
+} LapBlock;
+
+struct LapParallel {
+  int threadCount;        // Number of threads, counting the caller
+  LapRelaxKernel kernel;  // Kernel run on each block
+  ThreadHandle* threads;  // The workers; entry 0 is unused
+  char* blockMemory;      // Allocation holding the blocks
+  char* blocks;           // First block, aligned to a cache line
+  size_t blockStride;     // Bytes between consecutive blocks
+
+  // Step being relaxed, written before it is published
+  const double* costs;    // Costs of the row
+  const double* v;        // Column potentials
+  double offset;          // Distance of the row minus its potential
+  int row;                // The row
+  double* distances;      // Shortest path distance of each column
+  const double* blocked;  // 0 for unscanned columns, `HUGE_VAL` otherwise
+  int* predecessors;      // Row before each column in the shortest paths
+  int stop;               // Whether the workers must return
+
+  StepBarrier barrier;  // Steps published and blocks relaxed by the workers
+};
+
+/**
+ * @brief  Gets a block of a pool.
+ * @param  parallel - The pool.
+ * @param  index    - Index of the block.
+ * @retval The block.
+ */
+static LapBlock* GetBlock(const LapParallel* parallel, int index) {
+  return (LapBlock*)(parallel->blocks + (size_t)index * parallel->blockStride);
+}
+
+/**
+ * @brief Relaxes the columns of a block in the current step.
+ * @param parallel - The pool.
+ * @param block    - The block.
+ */
+static void RelaxBlock(const LapParallel* parallel, LapBlock* block) {
+  int first = block->first;
+  int closest = parallel->kernel(
+      parallel->costs + first, parallel->v + first, parallel->offset,
+      parallel->row, parallel->distances + first, parallel->blocked + first,
+      parallel->predecessors + first, block->count);
+
+  block->closest = closest < 0 ? -1 : first + closest;
+  block->distance =
+      closest < 0 ? HUGE_VAL : parallel->distances[first + closest];
+}
+
+/**
+ * @brief Loop of a worker: waits for each step and relaxes its block.
+ * @param argument - The `LapBlock` of the worker.
+ */
+static void RunWorker(void* argument) {
+  LapBlock* block = argument;
+  LapParallel* parallel = block->parallel;
+  long seen = 0;
+
+  while (1) {
+    seen = WaitForStep(&parallel->barrier, seen);
+    if (parallel->stop) {
+      return;
+    }
+
+    RelaxBlock(parallel, block);
+    FinishStep(&parallel->barrier);
+  }
+}
+
+/**
+ * @brief Stops the workers that were started and waits for them.
+ * @param parallel - The pool.
+ * @param started  - Number of threads running, counting the caller.
+ */
+static void StopWorkers(LapParallel* parallel, int started) {
+  parallel->stop = 1;
+  PublishStep(&parallel->barrier);
+  for (int t = 1; t < started; t++) {
+    JoinThread(parallel->threads[t]);
+  }
+}
+
+/**
+ * @brief  Starts the threads of a pool, at most one per processor. Each
+ *         thread gets at least `PARALLEL_SOLVE_MIN_COLUMNS` columns; when
+ *         that leaves a single thread, no pool is created and `parallel` is
+ *         set to NULL.
+ * @details Threads busy wait for each step, so there are never more threads
+ *          than processors. The blocks start at multiples of 8 columns, so
+ *          no two threads write to the same cache line of the distances.
+ *          When a thread cannot be started, the pool is not created either
+ *          and the search stays serial.
+ * @param  threadCount - Number of threads wanted, counting the caller.
+ * @param  cols        - Number of columns of the problems.
+ * @param  kernel      - Kernel run by every thread on its block.
+ * @param  parallel    - The new pool, or NULL.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateLapParallel(int threadCount, int cols, LapRelaxKernel kernel,
+                      LapParallel** parallel) {
+  *parallel = NULL;
+  if (threadCount > GetProcessorCount()) {
+    threadCount = GetProcessorCount();
+  }
+  if (threadCount > cols / PARALLEL_SOLVE_MIN_COLUMNS) {
+    threadCount = cols / PARALLEL_SOLVE_MIN_COLUMNS;
+  }
+  if (threadCount < 2) {
+    return SUCCESS;
+  }
+
+  LapParallel* pool = calloc(1, sizeof(LapParallel));
+  if (pool == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  pool->threadCount = threadCount;
+  pool->kernel = kernel;
+  pool->blockStride = (sizeof(LapBlock) + CACHE_LINE_SIZE - 1) /
+                      CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+  pool->threads = malloc((size_t)threadCount * sizeof(ThreadHandle));
+  pool->blockMemory =
+      malloc((size_t)threadCount * pool->blockStride + CACHE_LINE_SIZE);
+  if (pool->threads == NULL || pool->blockMemory == NULL) {
+    free(pool->threads);
+    free(pool->blockMemory);
+    free(pool);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  uintptr_t address = (uintptr_t)pool->blockMemory;
+  pool->blocks = pool->blockMemory +
+                 (CACHE_LINE_SIZE - address % CACHE_LINE_SIZE) %
+                     CACHE_LINE_SIZE;
+  for (int t = 0; t < threadCount; t++) {
+    LapBlock* block = GetBlock(pool, t);
+    int first = (int)((long long)cols * t / threadCount) & ~7;
+    int end = t + 1 == threadCount
+                  ? cols
+                  : (int)((long long)cols * (t + 1) / threadCount) & ~7;
+    block->parallel = pool;
+    block->first = first;
+    block->count = end - first;
+    block->closest = -1;
+    block->distance = HUGE_VAL;
+  }
+
+  for (int t = 1; t < threadCount; t++) {
+    if (StartThread(&pool->threads[t], RunWorker, GetBlock(pool, t)) !=
+        SUCCESS) {
+      StopWorkers(pool, t);
+      FreeLapParallel(pool);
+      return SUCCESS;
+    }
+  }
+
+  *parallel = pool;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Relaxes a row with every thread of the pool, see
+ *         `LapRelaxKernel`. The caller relaxes the first block.
+ * @param  parallel     - The pool.
+ * @param  costs        - Costs of the row.
+ * @param  v            - Column potentials.
+ * @param  offset       - Distance of the row minus its potential.
+ * @param  row          - The row.
+ * @param  distances    - Shortest path distance of each column.
+ * @param  blocked      - 0 for unscanned columns, `HUGE_VAL` for scanned ones.
+ * @param  predecessors - Row before each column in the shortest paths.
+ * @retval The closest unscanned column, the lowest index on ties, or -1 if
+ *         no unscanned column can be reached.
+ */
+int LapParallelRelax(LapParallel* parallel, const double* costs,
+                     const double* v, double offset, int row,
+                     double* distances, const double* blocked,
+                     int* predecessors) {
+  parallel->costs = costs;
+  parallel->v = v;
+  parallel->offset = offset;
+  parallel->row = row;
+  parallel->distances = distances;
+  parallel->blocked = blocked;
+  parallel->predecessors = predecessors;
+  PublishStep(&parallel->barrier);
+
+  RelaxBlock(parallel, GetBlock(parallel, 0));
+  WaitForWorkers(&parallel->barrier, parallel->threadCount - 1);
+
+  // Blocks are in column order, so a strict comparison keeps the lowest
+  // column on ties, as the serial kernel does
+  int closest = -1;
+  double closestDistance = HUGE_VAL;
+  for (int t = 0; t < parallel->threadCount; t++) {
+    const LapBlock* block = GetBlock(parallel, t);
+    if (block->closest >= 0 && block->distance < closestDistance) {
+      closestDistance = block->distance;
+      closest = block->closest;
+    }
+  }
+
+  return closest;
+}
+
+/**
+ * @brief Stops the threads of a pool and frees it.
+ * @param parallel - The pool.
+ */
+void FreeLapParallel(LapParallel* parallel) {
+  if (parallel == NULL) {
+    return;
+  }
+
+  if (!parallel->stop) {
+    StopWorkers(parallel, parallel->threadCount);
+  }
+  free(parallel->threads);
+  free(parallel->blockMemory);
+  free(parallel);
+}
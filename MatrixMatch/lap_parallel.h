@@ -0,0 +1,66 @@
+/**
+ *  @file      lap_parallel.h
+ *  @brief     Header file for the parallel relaxation of the shortest
+ *             augmenting path engine.
+ *  @details   This header file declares a pool of threads that splits the
+ *             columns relaxed by each Dijkstra step into contiguous blocks,
+ *             one per thread. The threads busy wait between steps, so a step
+ *             costs one relaxation of a block and one pass over a barrier.
+ *             The closest column of each block is merged in block order, so
+ *             the result is exactly the one of the serial kernel. These
+ *             functions are not exported by the library.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef LAP_PARALLEL_H
+#define LAP_PARALLEL_H
+
+#include "lap_simd.h"
+
+/**
+ * @brief Pool of threads that relax blocks of columns.
+ */
+typedef struct LapParallel LapParallel;
+
+/**
+ * @brief  Starts the threads of a pool, at most one per processor. Each
+ *         thread gets at least `PARALLEL_SOLVE_MIN_COLUMNS` columns; when
+ *         that leaves a single thread, no pool is created and `parallel` is
+ *         set to NULL.
+ * @param  threadCount - Number of threads wanted, counting the caller.
+ * @param  cols        - Number of columns of the problems.
+ * @param  kernel      - Kernel run by every thread on its block.
+ * @param  parallel    - The new pool, or NULL.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateLapParallel(int threadCount, int cols, LapRelaxKernel kernel,
+                      LapParallel** parallel);
+
+/**
+ * @brief  Relaxes a row with every thread of the pool, see
+ *         `LapRelaxKernel`. The caller relaxes the first block.
+ * @param  parallel     - The pool.
+ * @param  costs        - Costs of the row.
+ * @param  v            - Column potentials.
+ * @param  offset       - Distance of the row minus its potential.
+ * @param  row          - The row.
+ * @param  distances    - Shortest path distance of each column.
+ * @param  blocked      - 0 for unscanned columns, `HUGE_VAL` for scanned ones.
+ * @param  predecessors - Row before each column in the shortest paths.
+ * @retval The closest unscanned column, the lowest index on ties, or -1 if
+ *         no unscanned column can be reached.
+ */
+int LapParallelRelax(LapParallel* parallel, const double* costs,
+                     const double* v, double offset, int row,
+                     double* distances, const double* blocked,
+                     int* predecessors);
+
+/**
+ * @brief Stops the threads of a pool and frees it.
+ * @param parallel - The pool.
+ */
+void FreeLapParallel(LapParallel* parallel);
+
+#endif  // !LAP_PARALLEL_H
@@ -0,0 +1,403 @@
+/**
+ *
+ *  @file      lap_simd.c
+ *  @brief     Implementation of the relaxation kernels of the shortest
+ *             augmenting path engine.
+ *  @details   This file contains the scalar kernel, the SSE2, AVX2 and
+ *             AVX-512 kernels, and the CPUID checks that choose among them.
+ *             The vector kernels keep the smallest distance and its column in
+ *             every lane, with a strict comparison so each lane keeps its
+ *             lowest column on ties, and merge the lanes at the end; the
+ *             columns left over are handled by the scalar loop.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "lap_simd.h"
+
+#include <math.h>
+
+#include "platform.h"
+
+#if !defined(LAP_NO_SIMD) && (defined(_M_X64) || defined(_M_IX86) || \
+                              defined(__x86_64__) || defined(__i386__))
+#define LAP_X86
+#endif
+
+#ifdef LAP_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define LAP_TARGET(features)
+#else
+#include <cpuid.h>
+#define LAP_TARGET(features) __attribute__((target(features)))
+#endif
+#endif
+
+/**
+ * @brief  Relaxes the columns from `first` to `cols - 1`, continuing the
+ *         search for the closest column.
+ * @param  costs           - Costs of the row.
+ * @param  v               - Column potentials.
+ * @param  offset          - Distance of the row minus its potential.
+ * @param  row             - The row.
+ * @param  distances       - Shortest path distance of each column.
+ * @param  blocked         - 0 for unscanned columns, `HUGE_VAL` otherwise.
+ * @param  predecessors    - Row before each column in the shortest paths.
+ * @param  first           - First column to relax.
+ * @param  cols            - Number of columns.
+ * @param  closest         - Closest column before `first`, or -1.
+ * @param  closestDistance - Distance of `closest`, or `HUGE_VAL`.
+ * @retval The closest unscanned column, or -1.
+ */
+static int RelaxRange(const double* costs, const double* v, double offset,
+                      int row, double* distances, const double* blocked,
+                      int* predecessors, int first, int cols, int closest,
+                      double closestDistance) {
+  for (int j = first; j < cols; j++) {
+    double distance = offset + costs[j] - v[j] + blocked[j];
+    if (distance < distances[j]) {
+      distances[j] = distance;
+      predecessors[j] = row;
+    }
+    double key = distances[j] + blocked[j];
+    if (key < closestDistance) {
+      closestDistance = key;
+      closest = j;
+    }
+  }
+
+  return closest;
+}
+
+/**
+ * @brief  Scalar reference kernel, see `LapRelaxKernel`.
+ */
+int LapRelaxScalar(const double* costs, const double* v, double offset,
+                   int row, double* distances, const double* blocked,
+                   int* predecessors, int cols) {
+  return RelaxRange(costs, v, offset, row, distances, blocked, predecessors,
+                    0, cols, -1, HUGE_VAL);
+}
+
+#ifdef LAP_X86
+
+/**
+ * @brief  Merges the closest column kept by each lane of a vector kernel.
+ * @param  best            - Smallest distance of each lane.
+ * @param  index           - Column of that distance, or -1.
+ * @param  lanes           - Number of lanes.
+ * @param  closestDistance - Variable that will hold the smallest distance.
+ * @retval The closest column, the lowest index on ties, or -1.
+ */
+static int MergeLanes(const double* best, const double* index, int lanes,
+                      double* closestDistance) {
+  int closest = -1;
+  *closestDistance = HUGE_VAL;
+  for (int k = 0; k < lanes; k++) {
+    if (index[k] < 0.0) {
+      continue;
+    }
+    if (best[k] < *closestDistance ||
+        (best[k] == *closestDistance && (int)index[k] < closest)) {
+      *closestDistance = best[k];
+      closest = (int)index[k];
+    }
+  }
+
+  return closest;
+}
+
+/**
+ * @brief  SSE2 kernel, see `LapRelaxKernel`.
+ */
+LAP_TARGET("sse2")
+static int RelaxSse2(const double* costs, const double* v, double offset,
+                     int row, double* distances, const double* blocked,
+                     int* predecessors, int cols) {
+  __m128d offsetVector = _mm_set1_pd(offset);
+  __m128d best = _mm_set1_pd(HUGE_VAL);
+  __m128d bestIndex = _mm_set1_pd(-1.0);
+  __m128d index = _mm_set_pd(1.0, 0.0);
+  __m128d step = _mm_set1_pd(2.0);
+
+  // SSE2 has no blend, so selections are built with and, andnot and or
+  int j = 0;
+  for (; j + 2 <= cols; j += 2) {
+    __m128d block = _mm_loadu_pd(blocked + j);
+    __m128d distance = _mm_add_pd(
+        _mm_sub_pd(_mm_add_pd(offsetVector, _mm_loadu_pd(costs + j)),
+                   _mm_loadu_pd(v + j)),
+        block);
+    __m128d current = _mm_loadu_pd(distances + j);
+    __m128d shorter = _mm_cmplt_pd(distance, current);
+    int mask = _mm_movemask_pd(shorter);
+    if (mask != 0) {
+      current = _mm_or_pd(_mm_and_pd(shorter, distance),
+                          _mm_andnot_pd(shorter, current));
+      _mm_storeu_pd(distances + j, current);
+      if (mask & 1) {
+        predecessors[j] = row;
+      }
+      if (mask & 2) {
+        predecessors[j + 1] = row;
+      }
+    }
+
+    __m128d key = _mm_add_pd(current, block);
+    __m128d smaller = _mm_cmplt_pd(key, best);
+    best = _mm_or_pd(_mm_and_pd(smaller, key), _mm_andnot_pd(smaller, best));
+    bestIndex = _mm_or_pd(_mm_and_pd(smaller, index),
+                          _mm_andnot_pd(smaller, bestIndex));
+    index = _mm_add_pd(index, step);
+  }
+
+  double bestLanes[2];
+  double indexLanes[2];
+  _mm_storeu_pd(bestLanes, best);
+  _mm_storeu_pd(indexLanes, bestIndex);
+  double closestDistance;
+  int closest = MergeLanes(bestLanes, indexLanes, 2, &closestDistance);
+
+  return RelaxRange(costs, v, offset, row, distances, blocked, predecessors, j,
+                    cols, closest, closestDistance);
+}
+
+/**
+ * @brief  AVX2 kernel, see `LapRelaxKernel`.
+ */
+LAP_TARGET("avx2")
+static int RelaxAvx2(const double* costs, const double* v, double offset,
+                     int row, double* distances, const double* blocked,
+                     int* predecessors, int cols) {
+  __m256d offsetVector = _mm256_set1_pd(offset);
+  __m256d best = _mm256_set1_pd(HUGE_VAL);
+  __m256d bestIndex = _mm256_set1_pd(-1.0);
+  __m256d index = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+  __m256d step = _mm256_set1_pd(4.0);
+  __m128i rowVector = _mm_set1_epi32(row);
+  __m256i lowHalves = _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0);
+
+  int j = 0;
+  for (; j + 4 <= cols; j += 4) {
+    __m256d block = _mm256_loadu_pd(blocked + j);
+    __m256d distance = _mm256_add_pd(
+        _mm256_sub_pd(_mm256_add_pd(offsetVector, _mm256_loadu_pd(costs + j)),
+                      _mm256_loadu_pd(v + j)),
+        block);
+    __m256d current = _mm256_loadu_pd(distances + j);
+    __m256d shorter = _mm256_cmp_pd(distance, current, _CMP_LT_OQ);
+    if (_mm256_movemask_pd(shorter) != 0) {
+      current = _mm256_blendv_pd(current, distance, shorter);
+      _mm256_storeu_pd(distances + j, current);
+
+      // One 32-bit mask per 64-bit lane, for the predecessors
+      __m128i mask = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(
+          _mm256_castpd_si256(shorter), lowHalves));
+      _mm_maskstore_epi32(predecessors + j, mask, rowVector);
+    }
+
+    __m256d key = _mm256_add_pd(current, block);
+    __m256d smaller = _mm256_cmp_pd(key, best, _CMP_LT_OQ);
+    best = _mm256_blendv_pd(best, key, smaller);
+    bestIndex = _mm256_blendv_pd(bestIndex, index, smaller);
+    index = _mm256_add_pd(index, step);
+  }
+
+  double bestLanes[4];
+  double indexLanes[4];
+  _mm256_storeu_pd(bestLanes, best);
+  _mm256_storeu_pd(indexLanes, bestIndex);
+  double closestDistance;
+  int closest = MergeLanes(bestLanes, indexLanes, 4, &closestDistance);
+
+  return RelaxRange(costs, v, offset, row, distances, blocked, predecessors, j,
+                    cols, closest, closestDistance);
+}
+
+/**
+ * @brief  AVX-512 kernel, see `LapRelaxKernel`.
+ */
+LAP_TARGET("avx512f,avx512vl")
+static int RelaxAvx512(const double* costs, const double* v, double offset,
+                       int row, double* distances, const double* blocked,
+                       int* predecessors, int cols) {
+  __m512d offsetVector = _mm512_set1_pd(offset);
+  __m512d best = _mm512_set1_pd(HUGE_VAL);
+  __m512d bestIndex = _mm512_set1_pd(-1.0);
+  __m512d index = _mm512_setr_pd(0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0);
+  __m512d step = _mm512_set1_pd(8.0);
+  __m256i rowVector = _mm256_set1_epi32(row);
+
+  int j = 0;
+  for (; j + 8 <= cols; j += 8) {
+    __m512d block = _mm512_loadu_pd(blocked + j);
+    __m512d distance = _mm512_add_pd(
+        _mm512_sub_pd(_mm512_add_pd(offsetVector, _mm512_loadu_pd(costs + j)),
+                      _mm512_loadu_pd(v + j)),
+        block);
+    __m512d current = _mm512_loadu_pd(distances + j);
+    __mmask8 shorter = _mm512_cmp_pd_mask(distance, current, _CMP_LT_OQ);
+    if (shorter != 0) {
+      current = _mm512_mask_blend_pd(shorter, current, distance);
+      _mm512_storeu_pd(distances + j, current);
+      _mm256_mask_storeu_epi32(predecessors + j, shorter, rowVector);
+    }
+
+    __m512d key = _mm512_add_pd(current, block);
+    __mmask8 smaller = _mm512_cmp_pd_mask(key, best, _CMP_LT_OQ);
+    best = _mm512_mask_blend_pd(smaller, best, key);
+    bestIndex = _mm512_mask_blend_pd(smaller, bestIndex, index);
+    index = _mm512_add_pd(index, step);
+  }
+
+  double bestLanes[8];
+  double indexLanes[8];
+  _mm512_storeu_pd(bestLanes, best);
+  _mm512_storeu_pd(indexLanes, bestIndex);
+  double closestDistance;
+  int closest = MergeLanes(bestLanes, indexLanes, 8, &closestDistance);
+
+  return RelaxRange(costs, v, offset, row, distances, blocked, predecessors, j,
+                    cols, closest, closestDistance);
+}
+
+/**
+ * @brief Runs the CPUID instruction.
+ * @param leaf      - The leaf.
+ * @param subleaf   - The subleaf.
+ * @param registers - Array that will hold EAX, EBX, ECX and EDX.
+ */
+static void ReadCpuid(int leaf, int subleaf, unsigned int registers[4]) {
+#ifdef _MSC_VER
+  int values[4];
+  __cpuidex(values, leaf, subleaf);
+  for (int k = 0; k < 4; k++) {
+    registers[k] = (unsigned int)values[k];
+  }
+#else
+  __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2],
+                registers[3]);
+#endif
+}
+
+/**
+ * @brief  Reads the register state enabled by the operating system (XCR0).
+ * @retval The low 32 bits of XCR0.
+ */
+static unsigned int ReadEnabledState(void) {
+#ifdef _MSC_VER
+  return (unsigned int)_xgetbv(0);
+#else
+  unsigned int low;
+  unsigned int high;
+  __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+  return low;
+#endif
+}
+
+#endif  // LAP_X86
+
+/**
+ * @brief  Asks the processor for the best instruction set it supports, and
+ *         the operating system for the wider registers.
+ * @retval The kernel level, `LAP_KERNEL_SCALAR` without x86 SIMD support.
+ */
+static LapKernelLevel DetectLapKernelLevel(void) {
+#ifdef LAP_X86
+  unsigned int registers[4];
+  ReadCpuid(0, 0, registers);
+  unsigned int highestLeaf = registers[0];
+  if (highestLeaf < 1) {
+    return LAP_KERNEL_SCALAR;
+  }
+
+  ReadCpuid(1, 0, registers);
+  if (!(registers[3] & (1u << 26))) {
+    return LAP_KERNEL_SCALAR;
+  }
+
+  // AVX registers are only usable if the operating system saves them
+  int osSavesAvx = (registers[2] & (1u << 27)) && (registers[2] & (1u << 28));
+  if (!osSavesAvx || highestLeaf < 7) {
+    return LAP_KERNEL_SSE2;
+  }
+  unsigned int enabled = ReadEnabledState();
+  if ((enabled & 0x6) != 0x6) {
+    return LAP_KERNEL_SSE2;
+  }
+
+  ReadCpuid(7, 0, registers);
+  int hasAvx2 = (registers[1] & (1u << 5)) != 0;
+  int hasAvx512 = (registers[1] & (1u << 16)) && (registers[1] & (1u << 31));
+  if (hasAvx512 && (enabled & 0xE6) == 0xE6) {
+    return LAP_KERNEL_AVX512;
+  }
+  return hasAvx2 ? LAP_KERNEL_AVX2 : LAP_KERNEL_SSE2;
+#else
+  return LAP_KERNEL_SCALAR;
+#endif
+}
+
+/**
+ * @brief  Gets the best instruction set supported by the processor, and by
+ *         the operating system for the wider registers. The processor is
+ *         only asked once, since `cpuid` can take microseconds in a virtual
+ *         machine.
+ * @retval The kernel level, `LAP_KERNEL_SCALAR` without x86 SIMD support.
+ */
+LapKernelLevel GetLapKernelLevel(void) {
+  static volatile long detectedLevel = -1;
+  long level = AtomicLoad(&detectedLevel);
+  if (level < 0) {
+    // Threads racing here detect and store the same level
+    level = (long)DetectLapKernelLevel();
+    AtomicStore(&detectedLevel, level);
+  }
+  return (LapKernelLevel)level;
+}
+
+/**
+ * @brief  Gets the kernel of an instruction set, falling back to the best
+ *         supported one below it.
+ * @param  level - The wanted instruction set.
+ * @retval The kernel.
+ */
+LapRelaxKernel GetLapRelaxKernel(LapKernelLevel level) {
+#ifdef LAP_X86
+  LapKernelLevel supported = GetLapKernelLevel();
+  if (level > supported) {
+    level = supported;
+  }
+  switch (level) {
+    case LAP_KERNEL_AVX512:
+      return RelaxAvx512;
+    case LAP_KERNEL_AVX2:
+      return RelaxAvx2;
+    case LAP_KERNEL_SSE2:
+      return RelaxSse2;
+    default:
+      break;
+  }
+#else
+  (void)level;
+#endif
+  return LapRelaxScalar;
+}
+
+/**
+ * @brief  Gets the fastest kernel of the machine: the AVX-512 or AVX2 one
+ *         when supported, the scalar one otherwise.
+ * @details The SSE2 kernel stays within a few percent of the scalar loop,
+ *          slower or faster depending on the machine (see
+ *          `benchmarks/lap_simd_benchmark.c`), so without AVX2 the scalar
+ *          reference kernel is used.
+ * @retval The kernel.
+ */
+LapRelaxKernel GetFastestLapRelaxKernel(void) {
+  LapKernelLevel level = GetLapKernelLevel();
+  return GetLapRelaxKernel(level >= LAP_KERNEL_AVX2 ? level
+                                                   : LAP_KERNEL_SCALAR);
+}
@@ -0,0 +1,87 @@
+/**
+ *  @file      lap_simd.h
+ *  @brief     Header file for the relaxation kernels of the shortest
+ *             augmenting path engine.
+ *  @details   This header file declares the kernel that relaxes the
+ *             distances of the columns through one row and finds the closest
+ *             unscanned column, the innermost loop of every Dijkstra search
+ *             in `lap_core.h`. Besides the scalar reference kernel there are
+ *             SSE2, AVX2 and AVX-512 kernels for x86 processors, chosen at
+ *             run time from the features reported by CPUID; the SSE2 one is
+ *             only used on request, being within a few percent of the scalar
+ *             loop (see `benchmarks/lap_simd_benchmark.c`). Every kernel
+ *             gives exactly the same distances, predecessors and closest
+ *             column as the scalar one. Defining `LAP_NO_SIMD` builds only
+ *             the scalar kernel. These functions are not exported by the
+ *             library.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef LAP_SIMD_H
+#define LAP_SIMD_H
+
+/**
+ * @brief  Relaxes the distances of the unscanned columns through a row and
+ *         finds the unscanned column with the smallest distance.
+ * @details For each column, `offset + costs[j] - v[j] + blocked[j]` replaces
+ *          `distances[j]` when it is smaller, setting `predecessors[j]` to
+ *          `row`. Scanned columns have `HUGE_VAL` in `blocked`, which keeps
+ *          them out of both the relaxation and the minimum.
+ * @param  costs        - Costs of the row.
+ * @param  v            - Column potentials.
+ * @param  offset       - Distance of the row minus its potential.
+ * @param  row          - The row.
+ * @param  distances    - Shortest path distance of each column.
+ * @param  blocked      - 0 for unscanned columns, `HUGE_VAL` for scanned ones.
+ * @param  predecessors - Row before each column in the shortest paths.
+ * @param  cols         - Number of columns.
+ * @retval The closest unscanned column, the lowest index on ties, or -1 if
+ *         no unscanned column can be reached.
+ */
+typedef int (*LapRelaxKernel)(const double* costs, const double* v,
+                              double offset, int row, double* distances,
+                              const double* blocked, int* predecessors,
+                              int cols);
+
+/**
+ * @enum LapKernelLevel
+ * @brief Instruction sets of the relaxation kernels.
+ */
+typedef enum LapKernelLevel {
+  LAP_KERNEL_SCALAR,  // Plain C
+  LAP_KERNEL_SSE2,    // 2 doubles per instruction
+  LAP_KERNEL_AVX2,    // 4 doubles per instruction
+  LAP_KERNEL_AVX512   // 8 doubles per instruction
+} LapKernelLevel;
+
+/**
+ * @brief  Scalar reference kernel, see `LapRelaxKernel`.
+ */
+int LapRelaxScalar(const double* costs, const double* v, double offset,
+                   int row, double* distances, const double* blocked,
+                   int* predecessors, int cols);
+
+/**
+ * @brief  Gets the best instruction set supported by the processor, and by
+ *         the operating system for the wider registers.
+ * @retval The kernel level, `LAP_KERNEL_SCALAR` without x86 SIMD support.
+ */
+LapKernelLevel GetLapKernelLevel(void);
+
+/**
+ * @brief  Gets the kernel of an instruction set, falling back to the best
+ *         supported one below it.
+ * @param  level - The wanted instruction set.
+ * @retval The kernel.
+ */
+LapRelaxKernel GetLapRelaxKernel(LapKernelLevel level);
+
+/**
+ * @brief  Gets the fastest kernel of the machine: the AVX-512 or AVX2 one
+ *         when supported, the scalar one otherwise.
+ * @retval The kernel.
+ */
+LapRelaxKernel GetFastestLapRelaxKernel(void);
+
+#endif  // !LAP_SIMD_H
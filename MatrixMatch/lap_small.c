@@ -0,0 +1,122 @@
+/**
+ *
+ *  @file      lap_small.c
+ *  @brief     Implementation of the exact solver of very small assignment
+ *             problems.
+ *  @details   This file contains the dynamic program over the sets of
+ *             assigned columns. Set `mask` holds the columns taken by the
+ *             first `popcount(mask)` rows, and its entry the smallest total
+ *             cost of doing so. Each set is final when it is reached in
+ *             increasing order, so the assignment is read back from the full
+ *             set without storing the choices.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "lap_small.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "constants.h"
+#include "error_codes.h"
+
+/**
+ * @brief  Counts the columns of a set.
+ * @param  mask - The set, one bit per column.
+ * @retval The number of bits set.
+ */
+static int CountColumns(unsigned int mask) {
+  int count = 0;
+  for (; mask != 0; mask &= mask - 1) {
+    count++;
+  }
+  return count;
+}
+
+/**
+ * @brief  Solves a small assignment problem exactly, assigning every row.
+ * @param  cost  - The costs, with at most `SMALL_SOLVE_MAX_SIZE` columns.
+ * @param  state - The state; only the assignment is set.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `NO_FEASIBLE_ASSIGNMENT`    - No assignment covers every row.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int SolveSmallLap(const LapCost* cost, LapState* state) {
+  int rows = cost->rows;
+  int cols = cost->cols;
+  double costs[SMALL_SOLVE_MAX_SIZE * SMALL_SOLVE_MAX_SIZE];
+  double buffer[SMALL_SOLVE_MAX_SIZE];
+  for (int i = 0; i < rows; i++) {
+    const double* row = cost->getRow(cost->context, i, buffer);
+    memcpy(costs + i * cols, row, (size_t)cols * sizeof(double));
+  }
+
+  // Entry `mask` is the smallest cost of the first rows on the columns of
+  // `mask`, the best of the last row taking each column of `mask`
+  unsigned int states = 1u << cols;
+  double stackTotals[SMALL_SOLVE_STACK_STATES];
+  double* totals = stackTotals;
+  if (states > SMALL_SOLVE_STACK_STATES) {
+    totals = malloc(states * sizeof(double));
+    if (totals == NULL) {
+      return MEMORY_ALLOCATION_FAILURE;
+    }
+  }
+
+  unsigned int bestMask = 0;
+  double best = HUGE_VAL;
+  totals[0] = 0.0;
+  for (unsigned int mask = 1; mask < states; mask++) {
+    int row = CountColumns(mask) - 1;
+    if (row >= rows) {
+      totals[mask] = HUGE_VAL;
+      continue;
+    }
+
+    // Written without branches on the columns of `mask`, which are
+    // impossible to predict
+    const double* rowCosts = costs + row * cols;
+    double total = HUGE_VAL;
+    for (int j = 0; j < cols; j++) {
+      unsigned int previous = mask & ~(1u << j);
+      double candidate = previous != mask ? totals[previous] + rowCosts[j]
+                                          : HUGE_VAL;
+      total = candidate < total ? candidate : total;
+    }
+    totals[mask] = total;
+    if (row == rows - 1 && total < best) {
+      best = total;
+      bestMask = mask;
+    }
+  }
+
+  int status = best < HUGE_VAL ? SUCCESS : NO_FEASIBLE_ASSIGNMENT;
+
+  // Walk back from the best set of `rows` columns: each row took the column
+  // whose removal gives exactly the total it was reached from
+  for (int j = 0; j < cols; j++) {
+    state->colToRow[j] = -1;
+  }
+  unsigned int mask = bestMask;
+  for (int row = rows - 1; row >= 0 && status == SUCCESS; row--) {
+    const double* rowCosts = costs + row * cols;
+    for (int j = 0; j < cols; j++) {
+      unsigned int previous = mask & ~(1u << j);
+      if (previous != mask && rowCosts[j] < HUGE_VAL &&
+          totals[previous] + rowCosts[j] == totals[mask]) {
+        state->rowToCol[row] = j;
+        state->colToRow[j] = row;
+        mask = previous;
+        break;
+      }
+    }
+  }
+
+  if (totals != stackTotals) {
+    free(totals);
+  }
+  return status;
+}
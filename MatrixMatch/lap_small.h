@@ -0,0 +1,33 @@
+/**
+ *  @file      lap_small.h
+ *  @brief     Header file for the exact solver of very small assignment
+ *             problems.
+ *  @details   This header file declares a dynamic program over the sets of
+ *             assigned columns, for problems with at most
+ *             `SMALL_SOLVE_MAX_SIZE` columns. It copies the costs into a
+ *             fixed array on the stack and needs no workspace, so tiny
+ *             problems do not pay for the setup of the shortest augmenting
+ *             path engine. These functions are not exported by the library.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef LAP_SMALL_H
+#define LAP_SMALL_H
+
+#include "lap_core.h"
+
+/**
+ * @brief  Solves a small assignment problem exactly, assigning every row.
+ *         The best cost of assigning the first rows to each set of columns
+ *         is built one row at a time, in O(2^m m) time for m columns. The
+ *         potentials are not computed.
+ * @param  cost  - The costs, with at most `SMALL_SOLVE_MAX_SIZE` columns.
+ * @param  state - The state; only `rowToCol` and `colToRow` are set.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `NO_FEASIBLE_ASSIGNMENT`    - No assignment covers every row.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int SolveSmallLap(const LapCost* cost, LapState* state);
+
+#endif  // !LAP_SMALL_H
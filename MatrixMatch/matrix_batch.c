@@ -0,0 +1,377 @@
+/**
+ *
+ *  @file      matrix_batch.c
+ *  @brief     Implementation of batch files holding many matrices.
+ *  @details   This file contains the functions that write matrices to a
+ *             batch file and load them back into pooled storage, avoiding
+ *             one file and thousands of allocations per matrix.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "matrix_batch.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "constants.h"
+#include "error_codes.h"
+#include "matrix_core.h"
+
+/**
+ * @brief Stores a 32-bit integer in little-endian byte order.
+ * @param bytes - Destination bytes.
+ * @param value - The integer.
+ */
+static void StoreInt32(unsigned char* bytes, int32_t value) {
+  uint32_t bits = (uint32_t)value;
+  for (int i = 0; i < 4; i++) {
+    bytes[i] = (unsigned char)(bits >> (8 * i));
+  }
+}
+
+/**
+ * @brief Stores a 64-bit integer in little-endian byte order.
+ * @param bytes - Destination bytes.
+ * @param value - The integer.
+ */
+static void StoreInt64(unsigned char* bytes, int64_t value) {
+  uint64_t bits = (uint64_t)value;
+  for (int i = 0; i < 8; i++) {
+    bytes[i] = (unsigned char)(bits >> (8 * i));
+  }
+}
+
+/**
+ * @brief  Reads a 32-bit integer stored in little-endian byte order.
+ * @param  bytes - Source bytes.
+ * @retval The integer.
+ */
+static int32_t LoadInt32(const unsigned char* bytes) {
+  uint32_t bits = 0;
+  for (int i = 3; i >= 0; i--) {
+    bits = (bits << 8) | bytes[i];
+  }
+  return (int32_t)bits;
+}
+
+/**
+ * @brief  Reads a 64-bit integer stored in little-endian byte order.
+ * @param  bytes - Source bytes.
+ * @retval The integer.
+ */
+static int64_t LoadInt64(const unsigned char* bytes) {
+  uint64_t bits = 0;
+  for (int i = 7; i >= 0; i--) {
+    bits = (bits << 8) | bytes[i];
+  }
+  return (int64_t)bits;
+}
+
+/**
+ * @brief  Moves the position of a file to an absolute 64-bit offset.
+ * @param  file   - The file.
+ * @param  offset - The offset from the start of the file.
+ * @retval 0 on success, non-zero otherwise.
+ */
+static int SeekFile(FILE* file, int64_t offset) {
+#ifdef _WIN32
+  return _fseeki64(file, offset, SEEK_SET);
+#else
+  return fseeko(file, (off_t)offset, SEEK_SET);
+#endif
+}
+
+/**
+ *  @brief  Writes matrices to a batch file.
+ *  @param  filename - The name of the file.
+ *  @param  matrices - Array with the matrices.
+ *  @param  count    - Number of matrices.
+ *  @retval `NULL_POINTER`              - No filename or matrices provided.
+ *  @retval `INVALID_MATRIX_OR_INDICES` - A matrix is NULL or empty.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `FILE_WRITE_ERROR`          - Error writing to the file.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+int WriteMatrixBatch(const char* filename, Matrix* const* matrices,
+                     int count) {
+  if (filename == NULL || (matrices == NULL && count > 0) || count < 0) {
+    return NULL_POINTER;
+  }
+  for (int i = 0; i < count; i++) {
+    if (matrices[i] == NULL || matrices[i]->width <= 0 ||
+        matrices[i]->height <= 0) {
+      return INVALID_MATRIX_OR_INDICES;
+    }
+  }
+
+  size_t tableSize = (size_t)count * BATCH_ENTRY_SIZE;
+  unsigned char* table = malloc(tableSize > 0 ? tableSize : 1);
+  unsigned char* block = malloc(BATCH_READ_BLOCK_SIZE * 4);
+  if (table == NULL || block == NULL) {
+    free(table);
+    free(block);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  unsigned char header[BATCH_HEADER_SIZE];
+  memcpy(header, BATCH_FILE_MAGIC, BATCH_MAGIC_SIZE);
+  StoreInt32(header + BATCH_MAGIC_SIZE, count);
+  StoreInt32(header + BATCH_MAGIC_SIZE + 4, 0);
+
+  // Values are stored one matrix after the other, right after the table
+  int64_t offset = BATCH_HEADER_SIZE + (int64_t)tableSize;
+  for (int i = 0; i < count; i++) {
+    unsigned char* entry = table + (size_t)i * BATCH_ENTRY_SIZE;
+    StoreInt64(entry, offset);
+    StoreInt32(entry + 8, matrices[i]->width);
+    StoreInt32(entry + 12, matrices[i]->height);
+    offset += (int64_t)matrices[i]->width * matrices[i]->height * 4;
+  }
+
+  FILE* file = fopen(filename, "wb");
+  if (file == NULL) {
+    free(table);
+    free(block);
+    return CANNOT_OPEN_FILE;
+  }
+
+  int status = SUCCESS;
+  if (fwrite(header, 1, BATCH_HEADER_SIZE, file) != BATCH_HEADER_SIZE ||
+      fwrite(table, 1, tableSize, file) != tableSize) {
+    status = FILE_WRITE_ERROR;
+  }
+
+  size_t used = 0;
+  for (int i = 0; i < count && status == SUCCESS; i++) {
+    for (const MatrixRowNode* rowNode = matrices[i]->head; rowNode != NULL;
+         rowNode = rowNode->nextRow) {
+      for (const MatrixElement* element = rowNode->row; element != NULL;
+           element = element->nextCol) {
+        StoreInt32(block + 4 * used++, element->value);
+        if (used == BATCH_READ_BLOCK_SIZE) {
+          if (fwrite(block, 4, used, file) != used) {
+            status = FILE_WRITE_ERROR;
+          }
+          used = 0;
+        }
+      }
+    }
+  }
+  if (status == SUCCESS && used > 0 &&
+      fwrite(block, 4, used, file) != used) {
+    status = FILE_WRITE_ERROR;
+  }
+
+  if (fclose(file) != 0 && status == SUCCESS) {
+    status = FILE_WRITE_ERROR;
+  }
+  free(table);
+  free(block);
+
+  return status;
+}
+
+/**
+ *  @brief  Reads the offset table of a batch file and allocates the batch
+ *          with pools large enough for all of its matrices.
+ *  @param  file    - The file, positioned after the header.
+ *  @param  count   - Number of matrices in the file.
+ *  @param  batch   - The new batch.
+ *  @param  offsets - Array that will hold the offset of each matrix.
+ *  @retval `INVALID_FILE_FORMAT`       - Invalid matrix sizes.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+static int ReadBatchTable(FILE* file, int count, MatrixBatch** batch,
+                          int64_t** offsets) {
+  size_t tableSize = (size_t)count * BATCH_ENTRY_SIZE;
+  unsigned char* table = malloc(tableSize > 0 ? tableSize : 1);
+  *offsets = malloc((count > 0 ? (size_t)count : 1) * sizeof(int64_t));
+  *batch = calloc(1, sizeof(MatrixBatch));
+  if (table == NULL || *offsets == NULL || *batch == NULL) {
+    free(table);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  (*batch)->count = count;
+  (*batch)->matrices =
+      malloc((count > 0 ? (size_t)count : 1) * sizeof(Matrix));
+  if ((*batch)->matrices == NULL) {
+    free(table);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  if (fread(table, 1, tableSize, file) != tableSize) {
+    free(table);
+    return FILE_READ_ERROR;
+  }
+
+  size_t totalRows = 0;
+  size_t totalElements = 0;
+  for (int i = 0; i < count; i++) {
+    const unsigned char* entry = table + (size_t)i * BATCH_ENTRY_SIZE;
+    (*offsets)[i] = LoadInt64(entry);
+    int width = LoadInt32(entry + 8);
+    int height = LoadInt32(entry + 12);
+    if (width <= 0 || height <= 0 || (*offsets)[i] < 0) {
+      free(table);
+      return INVALID_FILE_FORMAT;
+    }
+
+    Matrix* matrix = &(*batch)->matrices[i];
+    matrix->width = width;
+    matrix->height = height;
+    matrix->head = NULL;
+    totalRows += (size_t)height;
+    totalElements += (size_t)width * (size_t)height;
+  }
+  free(table);
+
+  if (totalElements > SIZE_MAX / sizeof(MatrixElement)) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  (*batch)->rowPool = malloc((totalRows > 0 ? totalRows : 1) *
+                             sizeof(MatrixRowNode));
+  (*batch)->elementPool = malloc((totalElements > 0 ? totalElements : 1) *
+                                 sizeof(MatrixElement));
+  if ((*batch)->rowPool == NULL || (*batch)->elementPool == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  return SUCCESS;
+}
+
+/**
+ *  @brief  Loads all matrices of a batch file in one sequential pass.
+ *  @param  filename - The name of the file.
+ *  @param  batch    - Batch that will contain the matrices.
+ *  @retval `NULL_POINTER`              - No filename or batch provided.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `INVALID_FILE_FORMAT`       - The file is not a valid batch file.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+int LoadMatrixBatch(const char* filename, MatrixBatch** batch) {
+  if (filename == NULL || batch == NULL) {
+    return NULL_POINTER;
+  }
+
+  FILE* file = fopen(filename, "rb");
+  if (file == NULL) {
+    return CANNOT_OPEN_FILE;
+  }
+
+  unsigned char header[BATCH_HEADER_SIZE];
+  if (fread(header, 1, BATCH_HEADER_SIZE, file) != BATCH_HEADER_SIZE) {
+    fclose(file);
+    return INVALID_FILE_FORMAT;
+  }
+  int count = LoadInt32(header + BATCH_MAGIC_SIZE);
+  if (memcmp(header, BATCH_FILE_MAGIC, BATCH_MAGIC_SIZE) != 0 || count < 0) {
+    fclose(file);
+    return INVALID_FILE_FORMAT;
+  }
+
+  MatrixBatch* newBatch = NULL;
+  int64_t* offsets = NULL;
+  unsigned char* block = malloc(BATCH_READ_BLOCK_SIZE * 4);
+  int status = block == NULL ? MEMORY_ALLOCATION_FAILURE
+                             : ReadBatchTable(file, count, &newBatch, &offsets);
+
+  int64_t position = BATCH_HEADER_SIZE + (int64_t)count * BATCH_ENTRY_SIZE;
+  MatrixRowNode* nextRow = status == SUCCESS ? newBatch->rowPool : NULL;
+  MatrixElement* nextElement = status == SUCCESS ? newBatch->elementPool : NULL;
+  for (int i = 0; i < count && status == SUCCESS; i++) {
+    Matrix* matrix = &newBatch->matrices[i];
+
+    // Files written by `WriteMatrixBatch` never need to seek
+    if (offsets[i] != position) {
+      if (SeekFile(file, offsets[i]) != 0) {
+        status = FILE_READ_ERROR;
+        break;
+      }
+      position = offsets[i];
+    }
+
+    // Link the rows and elements of this matrix inside the pools
+    matrix->head = nextRow;
+    for (int row = 0; row < matrix->height; row++) {
+      MatrixRowNode* rowNode = nextRow++;
+      rowNode->row = nextElement;
+      rowNode->nextRow = row + 1 < matrix->height ? nextRow : NULL;
+      for (int col = 0; col < matrix->width; col++) {
+        MatrixElement* element = nextElement++;
+        element->column = col;
+        element->nextCol = col + 1 < matrix->width ? nextElement : NULL;
+      }
+    }
+
+    // Fill the values, which are stored in the same order as the pool
+    MatrixElement* element = matrix->head->row;
+    size_t remaining = (size_t)matrix->width * (size_t)matrix->height;
+    while (remaining > 0) {
+      size_t wanted = remaining < BATCH_READ_BLOCK_SIZE ? remaining
+                                                        : BATCH_READ_BLOCK_SIZE;
+      if (fread(block, 4, wanted, file) != wanted) {
+        status = FILE_READ_ERROR;
+        break;
+      }
+      for (size_t j = 0; j < wanted; j++) {
+        element[j].value = LoadInt32(block + 4 * j);
+      }
+      element += wanted;
+      remaining -= wanted;
+    }
+    position += (int64_t)matrix->width * matrix->height * 4;
+  }
+
+  fclose(file);
+  free(block);
+  free(offsets);
+
+  if (status != SUCCESS) {
+    FreeMatrixBatch(newBatch);
+    return status;
+  }
+
+  *batch = newBatch;
+  return SUCCESS;
+}
+
+/**
+ *  @brief  Gets a matrix of a batch.
+ *  @param  batch - The batch.
+ *  @param  index - Index of the matrix.
+ *  @retval The matrix, or NULL if the index is invalid.
+ */
+Matrix* GetBatchMatrix(MatrixBatch* batch, int index) {
+  if (batch == NULL || index < 0 || index >= batch->count) {
+    return NULL;
+  }
+  return &batch->matrices[index];
+}
+
+/**
+ *  @brief Frees a batch and all of its matrices.
+ *  @param batch - The batch to be freed.
+ */
+void FreeMatrixBatch(MatrixBatch* batch) {
+  if (batch == NULL) {
+    return;
+  }
+
+  free(batch->matrices);
+  free(batch->rowPool);
+  free(batch->elementPool);
+  free(batch);
+}
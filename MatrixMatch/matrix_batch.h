@@ -0,0 +1,86 @@
+/**
+ *  @file      matrix_batch.h
+ *  @brief     Header file for batch files holding many matrices.
+ *  @details   This file contains the definitions of the structures and
+ *             functions used to store many small matrices in a single
+ *             binary file and to load them in one sequential pass into
+ *             pooled storage.
+ *
+ *             Batch file layout (all integers little-endian):
+ *             - Header: `BATCH_FILE_MAGIC` (8 bytes), number of matrices
+ *               (int32) and a reserved int32.
+ *             - Offset table: one entry per matrix with the offset of its
+ *               values from the start of the file (int64), its width
+ *               (int32) and its height (int32).
+ *             - Values: the elements of each matrix as int32, row by row.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef MATRIX_BATCH_H
+#define MATRIX_BATCH_H
+
+#include "matrix_core.h"
+
+/**
+ * @struct MatrixBatch
+ * @brief Matrices loaded from a batch file.
+ *
+ * All rows and elements of all matrices live in two pools, so a batch costs
+ * a handful of allocations regardless of the number of matrices. Each entry
+ * of `matrices` is a regular `Matrix` that can be given to the solvers.
+ * Functions that free or relink nodes (`FreeMatrix`, `InsertRow`,
+ * `DeleteRow`, `InsertColumn`, `DeleteColumn`) must not be used on them;
+ * values may be changed with `ReplaceValueAtPosition`.
+ */
+typedef struct MatrixBatch {
+  int count;                   // Number of matrices
+  Matrix* matrices;            // The matrices
+  MatrixRowNode* rowPool;      // Rows of all matrices
+  MatrixElement* elementPool;  // Elements of all matrices
+} MatrixBatch;
+
+/**
+ *  @brief  Writes matrices to a batch file.
+ *  @param  filename - The name of the file.
+ *  @param  matrices - Array with the matrices.
+ *  @param  count    - Number of matrices.
+ *  @retval `NULL_POINTER`              - No filename or matrices provided.
+ *  @retval `INVALID_MATRIX_OR_INDICES` - A matrix is NULL or empty.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `FILE_WRITE_ERROR`          - Error writing to the file.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int WriteMatrixBatch(const char* filename,
+                                           Matrix* const* matrices, int count);
+
+/**
+ *  @brief  Loads all matrices of a batch file in one sequential pass.
+ *  @param  filename - The name of the file.
+ *  @param  batch    - Batch that will contain the matrices.
+ *  @retval `NULL_POINTER`              - No filename or batch provided.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `INVALID_FILE_FORMAT`       - The file is not a valid batch file.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int LoadMatrixBatch(const char* filename,
+                                          MatrixBatch** batch);
+
+/**
+ *  @brief  Gets a matrix of a batch.
+ *  @param  batch - The batch.
+ *  @param  index - Index of the matrix.
+ *  @retval The matrix, or NULL if the index is invalid.
+ */
+__declspec(dllexport) Matrix* GetBatchMatrix(MatrixBatch* batch, int index);
+
+/**
+ *  @brief Frees a batch and all of its matrices.
+ *  @param batch - The batch to be freed.
+ */
+__declspec(dllexport) void FreeMatrixBatch(MatrixBatch* batch);
+
+#endif  // !MATRIX_BATCH_H
@@ -0,0 +1,162 @@
+/**
+ *
+ *  @file      matrix_dense.c
+ *  @brief     Implementation of dense matrices stored in one contiguous
+ *             block.
+ *  @details   This file contains the functions that create, query and free
+ *             dense matrices.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "matrix_dense.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "error_codes.h"
+#include "matrix_core.h"
+#include "platform.h"
+
+/**
+ * @brief  Gets the size in bytes of one value of a dense type.
+ * @param  type - The type.
+ * @retval The size of one value, or 0 if the type is invalid.
+ */
+size_t GetDenseTypeSize(DenseType type) {
+  switch (type) {
+    case DENSE_INT32:
+      return sizeof(int32_t);
+    case DENSE_INT64:
+      return sizeof(int64_t);
+    case DENSE_FLOAT64:
+      return sizeof(double);
+    default:
+      return 0;
+  }
+}
+
+/**
+ * @brief  Creates a dense matrix with every value set to zero.
+ * @param  width  - The number of columns of the matrix.
+ * @param  height - The number of rows of the matrix.
+ * @param  type   - The type of the values.
+ * @param  matrix - The new matrix.
+ * @retval `INVALID_MATRIX_OR_INDICES` - Invalid size or type.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateDenseMatrix(int width, int height, DenseType type,
+                      DenseMatrix** matrix) {
+  size_t typeSize = GetDenseTypeSize(type);
+  if (width <= 0 || height <= 0 || typeSize == 0) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  DenseMatrix* newMatrix = malloc(sizeof(DenseMatrix));
+  if (newMatrix == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  newMatrix->data = calloc((size_t)width * height, typeSize);
+  if (newMatrix->data == NULL) {
+    free(newMatrix);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  newMatrix->width = width;
+  newMatrix->height = height;
+  newMatrix->type = type;
+  newMatrix->mapping = NULL;
+
+  *matrix = newMatrix;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Creates a dense matrix of 32-bit integers with the values of a
+ *         linked-list matrix.
+ * @param  source - The linked-list matrix.
+ * @param  matrix - The new matrix.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The source matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateDenseMatrixFromMatrix(const Matrix* source, DenseMatrix** matrix) {
+  if (source == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  DenseMatrix* newMatrix = NULL;
+  int status =
+      CreateDenseMatrix(source->width, source->height, DENSE_INT32, &newMatrix);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  int32_t* values = newMatrix->data;
+  const MatrixRowNode* currentRow = source->head;
+  for (int row = 0; row < source->height && currentRow != NULL; row++) {
+    const MatrixElement* element = currentRow->row;
+    for (int col = 0; col < source->width && element != NULL; col++) {
+      values[(size_t)row * source->width + col] = element->value;
+      element = element->nextCol;
+    }
+    currentRow = currentRow->nextRow;
+  }
+
+  *matrix = newMatrix;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Gets the value of a cell of a dense matrix as a double.
+ * @param  matrix - The matrix.
+ * @param  row    - The row of the cell.
+ * @param  col    - The column of the cell.
+ * @param  value  - Variable that will hold the value of the cell.
+ * @retval `OUT_OF_BOUNDS` - Invalid matrix position.
+ * @retval `SUCCESS`       - Operation successful.
+ */
+int GetDenseValue(const DenseMatrix* matrix, int row, int col,
+                  double* value) {
+  if (matrix == NULL || row < 0 || row >= matrix->height || col < 0 ||
+      col >= matrix->width) {
+    return OUT_OF_BOUNDS;
+  }
+
+  size_t index = (size_t)row * matrix->width + col;
+  switch (matrix->type) {
+    case DENSE_INT32:
+      *value = ((const int32_t*)matrix->data)[index];
+      break;
+    case DENSE_INT64:
+      *value = (double)((const int64_t*)matrix->data)[index];
+      break;
+    case DENSE_FLOAT64:
+      *value = ((const double*)matrix->data)[index];
+      break;
+    default:
+      return OUT_OF_BOUNDS;
+  }
+
+  return SUCCESS;
+}
+
+/**
+ * @brief Free allocated memory of a dense matrix, unmapping its file if it
+ *        was loaded from one.
+ * @param matrix - The matrix to be freed.
+ */
+void FreeDenseMatrix(DenseMatrix* matrix) {
+  if (matrix == NULL) {
+    return;
+  }
+
+  if (matrix->mapping != NULL) {
+    UnmapFile(matrix->mapping);
+    free(matrix->mapping);
+  } else {
+    free(matrix->data);
+  }
+  free(matrix);
+}
@@ -0,0 +1,98 @@
+/**
+ *  @file      matrix_dense.h
+ *  @brief     Header file for dense matrices stored in one contiguous block.
+ *  @details   This file contains the structure used to hold cost matrices
+ *             as a row-major array of 32-bit integers, 64-bit integers or
+ *             doubles, either allocated by the library or mapped straight
+ *             from a file, and the functions to create and query them.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef MATRIX_DENSE_H
+#define MATRIX_DENSE_H
+
+#include <stddef.h>
+
+#include "matrix_core.h"
+
+/**
+ * @enum DenseType
+ * @brief Type of the values of a dense matrix.
+ */
+typedef enum DenseType {
+  DENSE_INT32,   // 32-bit signed integers
+  DENSE_INT64,   // 64-bit signed integers
+  DENSE_FLOAT64  // Double precision floating point numbers
+} DenseType;
+
+/**
+ * @struct DenseMatrix
+ * @brief A matrix stored row by row in one contiguous block.
+ *
+ * The value of row `i` and column `j` is element `i * width + j` of `data`,
+ * read as the type given by `type`. When the matrix was loaded from a file,
+ * `data` points into the memory-mapped file and `mapping` holds the mapping;
+ * changes to the values are private and never written back to the file.
+ */
+typedef struct DenseMatrix {
+  int width;                    // Number of columns
+  int height;                   // Number of rows
+  DenseType type;               // Type of the values
+  void* data;                   // The values, row by row
+  struct FileMapping* mapping;  // Mapped file holding `data`, or NULL
+} DenseMatrix;
+
+/**
+ * @brief  Gets the size in bytes of one value of a dense type.
+ * @param  type - The type.
+ * @retval The size of one value, or 0 if the type is invalid.
+ */
+__declspec(dllexport) size_t GetDenseTypeSize(DenseType type);
+
+/**
+ * @brief  Creates a dense matrix with every value set to zero.
+ * @param  width  - The number of columns of the matrix.
+ * @param  height - The number of rows of the matrix.
+ * @param  type   - The type of the values.
+ * @param  matrix - The new matrix.
+ * @retval `INVALID_MATRIX_OR_INDICES` - Invalid size or type.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CreateDenseMatrix(int width, int height,
+                                            DenseType type,
+                                            DenseMatrix** matrix);
+
+/**
+ * @brief  Creates a dense matrix of 32-bit integers with the values of a
+ *         linked-list matrix.
+ * @param  source - The linked-list matrix.
+ * @param  matrix - The new matrix.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The source matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CreateDenseMatrixFromMatrix(const Matrix* source,
+                                                      DenseMatrix** matrix);
+
+/**
+ * @brief  Gets the value of a cell of a dense matrix as a double.
+ * @param  matrix - The matrix.
+ * @param  row    - The row of the cell.
+ * @param  col    - The column of the cell.
+ * @param  value  - Variable that will hold the value of the cell.
+ * @retval `OUT_OF_BOUNDS` - Invalid matrix position.
+ * @retval `SUCCESS`       - Operation successful.
+ */
+__declspec(dllexport) int GetDenseValue(const DenseMatrix* matrix, int row,
+                                        int col, double* value);
+
+/**
+ * @brief Free allocated memory of a dense matrix, unmapping its file if it
+ *        was loaded from one.
+ * @param matrix - The matrix to be freed.
+ */
+__declspec(dllexport) void FreeDenseMatrix(DenseMatrix* matrix);
+
+#endif  // !MATRIX_DENSE_H
@@ -14,6 +14,10 @@
 
 #include "matrix_io.h"
 
+#include <ctype.h>
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -21,25 +25,268 @@
 #include "constants.h"
 #include "error_codes.h"
 #include "matrix_core.h"
+#include "matrix_dense.h"
+#include "matrix_sparse.h"
+#include "platform.h"
+
+/**
+ * @struct PrintBuffer
+ * @brief Formatted output buffer used by the matrix printing functions.
+ *
+ * Text is accumulated in `data` and written to `stdout` with a single
+ * `fwrite` whenever the buffer fills up, instead of one `printf` per element.
+ */
+typedef struct PrintBuffer {
+  char data[PRINT_BUFFER_SIZE];  // Pending output
+  size_t length;                 // Number of bytes used in `data`
+} PrintBuffer;
+
+/**
+ *  @brief Writes the pending contents of a print buffer to `stdout`.
+ *  @param buffer - The print buffer.
+ */
+static void FlushPrintBuffer(PrintBuffer* buffer) {
+  if (buffer->length > 0) {
+    fwrite(buffer->data, 1, buffer->length, stdout);
+    buffer->length = 0;
+  }
+}
+
+/**
+ *  @brief Appends a string to a print buffer, flushing it when full.
+ *  @param buffer - The print buffer.
+ *  @param text   - The string to append.
+ */
+static void AppendText(PrintBuffer* buffer, const char* text) {
+  while (*text != '\0') {
+    if (buffer->length == PRINT_BUFFER_SIZE) {
+      FlushPrintBuffer(buffer);
+    }
+    buffer->data[buffer->length++] = *text++;
+  }
+}
+
+/**
+ *  @brief Appends an integer followed by a separator to a print buffer.
+ *  @param buffer    - The print buffer.
+ *  @param value     - The integer to append.
+ *  @param separator - Character written after the integer.
+ */
+static void AppendInt(PrintBuffer* buffer, int value, char separator) {
+  char digits[16];
+  int count = 0;
+  // Work with the magnitude as unsigned so `INT_MIN` does not overflow
+  unsigned int magnitude =
+      value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+
+  do {
+    digits[count++] = (char)('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0);
+
+  // Sign, digits and separator take at most 13 bytes
+  if (PRINT_BUFFER_SIZE - buffer->length < 13) {
+    FlushPrintBuffer(buffer);
+  }
+  if (value < 0) {
+    buffer->data[buffer->length++] = '-';
+  }
+  while (count > 0) {
+    buffer->data[buffer->length++] = digits[--count];
+  }
+  buffer->data[buffer->length++] = separator;
+}
+
+/**
+ *  @brief Appends the first and last `edgeCols` values of a row to a print
+ *         buffer, with an ellipsis in between when columns are omitted.
+ *  @param buffer   - The print buffer.
+ *  @param rowNode  - The row to print.
+ *  @param width    - Number of columns of the matrix.
+ *  @param edgeCols - Number of columns to print at each end of the row.
+ */
+static void AppendRowPreview(PrintBuffer* buffer, const MatrixRowNode* rowNode,
+                             int width, int edgeCols) {
+  int skipFrom = edgeCols;        // First omitted column
+  int skipTo = width - edgeCols;  // First column printed after the gap
+  if (skipFrom >= skipTo) {
+    skipFrom = width;
+    skipTo = width;
+  }
+
+  int col = 0;
+  for (const MatrixElement* element = rowNode->row; element != NULL;
+       element = element->nextCol) {
+    if (col < skipFrom || col >= skipTo) {
+      AppendInt(buffer, element->value, '\t');
+    } else if (col == skipFrom) {
+      AppendText(buffer, "...\t");
+      if (skipTo == width) {
+        break;  // No column is printed after the gap
+      }
+    }
+    col++;
+  }
+  AppendText(buffer, "\n");
+}
 
 /**
  *  @brief Displays a matrix on the screen.
+ *  @details Matrices with more than `PRINT_FULL_MAX_ELEMENTS` elements are
+ *           shown with `PrintMatrixPreview` so that an accidental call on a
+ *           large matrix does not flood the terminal.
  *  @param matrix - The matrix to be displayed.
  */
 void PrintMatrix(const Matrix* matrix) {
-  MatrixRowNode* currentRow = matrix->head;
+  if (matrix == NULL) {
+    return;
+  }
 
-  while (currentRow != NULL) {
-    MatrixElement* currentElement = currentRow->row;
+  if ((long long)matrix->width * matrix->height > PRINT_FULL_MAX_ELEMENTS) {
+    PrintMatrixPreview(matrix, PRINT_PREVIEW_EDGE, PRINT_PREVIEW_EDGE);
+    return;
+  }
 
-    while (currentElement != NULL) {
-      printf("%d\t", currentElement->value);
-      currentElement = currentElement->nextCol;
+  PrintBuffer buffer;
+  buffer.length = 0;
+
+  for (const MatrixRowNode* currentRow = matrix->head; currentRow != NULL;
+       currentRow = currentRow->nextRow) {
+    for (const MatrixElement* currentElement = currentRow->row;
+         currentElement != NULL; currentElement = currentElement->nextCol) {
+      AppendInt(&buffer, currentElement->value, '\t');
+    }
+    AppendText(&buffer, "\n");
+  }
+
+  FlushPrintBuffer(&buffer);
+}
+
+/**
+ *  @brief Displays the head and tail rows and columns of a matrix, replacing
+ *         the omitted ones with ellipses.
+ *  @details Only the printed rows and columns are formatted, and the walk
+ *           stops after the last of them. Rows and columns are linked lists,
+ *           so reaching the bottom rows still follows every row link, and
+ *           reaching the right columns every element of a printed row: the
+ *           cost is O(height + printed rows * width), not O(printed cells).
+ *  @param matrix   - The matrix to be displayed.
+ *  @param edgeRows - Number of rows to print at the top and at the bottom.
+ *  @param edgeCols - Number of columns to print at the left and at the right.
+ */
+void PrintMatrixPreview(const Matrix* matrix, int edgeRows, int edgeCols) {
+  if (matrix == NULL) {
+    return;
+  }
+  if (edgeRows < 0) {
+    edgeRows = 0;
+  }
+  if (edgeCols < 0) {
+    edgeCols = 0;
+  }
+
+  PrintBuffer buffer;
+  buffer.length = 0;
+
+  int skipFrom = edgeRows;                 // First omitted row
+  int skipTo = matrix->height - edgeRows;  // First row printed after the gap
+  if (skipFrom >= skipTo) {
+    skipFrom = matrix->height;
+    skipTo = matrix->height;
+  }
+
+  int row = 0;
+  for (const MatrixRowNode* currentRow = matrix->head; currentRow != NULL;
+       currentRow = currentRow->nextRow) {
+    if (row < skipFrom || row >= skipTo) {
+      AppendRowPreview(&buffer, currentRow, matrix->width, edgeCols);
+    } else if (row == skipFrom) {
+      AppendText(&buffer, "...\n");
+      if (skipTo == matrix->height) {
+        break;  // No row is printed after the gap
+      }
+    }
+    row++;
+  }
+
+  AppendText(&buffer, "[");
+  AppendInt(&buffer, matrix->height, 'x');
+  AppendInt(&buffer, matrix->width, ']');
+  AppendText(&buffer, "\n");
+
+  FlushPrintBuffer(&buffer);
+}
+
+/**
+ *  @brief  Calculates summary statistics of a matrix.
+ *  @param  matrix - The matrix.
+ *  @param  stats  - Structure that will hold the statistics.
+ *  @retval `NULL_POINTER` - The matrix or `stats` is NULL.
+ *  @retval `SUCCESS`      - Operation successful.
+ */
+int GetMatrixStats(const Matrix* matrix, MatrixStats* stats) {
+  if (matrix == NULL || stats == NULL) {
+    return NULL_POINTER;
+  }
+
+  stats->width = matrix->width;
+  stats->height = matrix->height;
+  stats->minValue = 0;
+  stats->maxValue = 0;
+  stats->mean = 0.0;
+  stats->zeroCount = 0;
+  stats->sparsity = 0.0;
+
+  long long elementCount = 0;
+  long long rowCount = 0;
+  long long sum = 0;
+  for (const MatrixRowNode* rowNode = matrix->head; rowNode != NULL;
+       rowNode = rowNode->nextRow) {
+    for (const MatrixElement* element = rowNode->row; element != NULL;
+         element = element->nextCol) {
+      if (elementCount == 0 || element->value < stats->minValue) {
+        stats->minValue = element->value;
+      }
+      if (elementCount == 0 || element->value > stats->maxValue) {
+        stats->maxValue = element->value;
+      }
+      if (element->value == 0) {
+        stats->zeroCount++;
+      }
+      sum += element->value;
+      elementCount++;
     }
+    rowCount++;
+  }
+
+  if (elementCount > 0) {
+    stats->mean = (double)sum / (double)elementCount;
+    stats->sparsity = (double)stats->zeroCount / (double)elementCount;
+  }
+  stats->memoryFootprint = sizeof(Matrix) +
+                           (size_t)rowCount * sizeof(MatrixRowNode) +
+                           (size_t)elementCount * sizeof(MatrixElement);
+
+  return SUCCESS;
+}
 
-    printf("\n");
-    currentRow = currentRow->nextRow;
+/**
+ *  @brief Displays summary statistics of a matrix instead of its elements.
+ *  @param matrix - The matrix.
+ */
+void PrintMatrixStats(const Matrix* matrix) {
+  MatrixStats stats;
+  if (GetMatrixStats(matrix, &stats) != SUCCESS) {
+    return;
   }
+
+  printf("Dimensions: %d x %d\n", stats.height, stats.width);
+  printf("Min: %d\n", stats.minValue);
+  printf("Max: %d\n", stats.maxValue);
+  printf("Mean: %.4f\n", stats.mean);
+  printf("Sparsity: %.2f%% (%lld zeros)\n", stats.sparsity * 100.0,
+         stats.zeroCount);
+  printf("Memory: %zu bytes\n", stats.memoryFootprint);
 }
 
 /**
@@ -182,175 +429,2216 @@ int CreateMatrixFromFile(const char* filename, Matrix** matrix) {
 }
 
 /**
- *  @brief  Inserts a row into the matrix.
- *  @param  matrix       - The matrix where we will insert a new row.
- *  @param  newRow       - Array with the values of the new row.
- *  @param  sizeArray    - Size of the array.
- *  @retval `OUT_OF_BOUNDS`  - Size of the array is different from the size of
- *                             the matrix.
- *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
- *  @retval `SUCCESS`                   - Operation successful.
+ * @struct ReadBuffer
+ * @brief One of the two buffers shared by the reader and the parser threads
+ *        of an asynchronous load.
  */
-int InsertRow(Matrix* matrix, const int* newRow, const int sizeArray) {
-  if (matrix->width != sizeArray) {
-    return OUT_OF_BOUNDS;
-  }
+typedef struct ReadBuffer {
+  char* data;     // Bytes read from the file
+  size_t length;  // Number of valid bytes in `data`
+  int filled;     // 1 while the buffer holds data not parsed yet
+  int last;       // 1 if no data follows this buffer
+} ReadBuffer;
 
-  MatrixRowNode* newRowNode = malloc(sizeof(MatrixRowNode));
-  if (!newRowNode) {
-    return MEMORY_ALLOCATION_FAILURE;
-  }
+/**
+ * @struct MatrixLoadHandle
+ * @brief State of an asynchronous matrix load.
+ */
+struct MatrixLoadHandle {
+  FILE* file;                   // File being loaded
+  MatrixLoadCallback callback;  // Completion callback, or NULL
+  void* userData;               // Argument of the callback
+  ThreadHandle parserThread;    // Thread parsing the buffers
+  ReadBuffer buffers[2];        // Buffers filled in turns by the reader
+  Mutex mutex;                  // Protects the fields below and `buffers`
+  ConditionVariable condition;  // Signals changes of the fields below
+  int readStatus;               // `FILE_READ_ERROR` if a read failed
+  int stopReading;              // 1 when the parser no longer needs data
+  int complete;                 // 1 once the load has finished
+  int detached;                 // 1 if no handle was given to the caller
+  int status;                   // Result of the load
+  Matrix* matrix;               // Loaded matrix
+};
 
-  newRowNode->row = NULL;
+/**
+ * @struct ValueScanner
+ * @brief Incremental scanner of one value of a matrix file: an optional
+ *        minus sign and decimal digits in the range of `int`, with optional
+ *        blanks around them.
+ */
+typedef struct ValueScanner {
+  unsigned int magnitude;  // Digits of the value being scanned
+  int negative;            // 1 once a minus sign was read
+  int hasDigits;           // 1 once the value has at least one digit
+  int ended;               // 1 once blanks follow the value
+} ValueScanner;
 
-  // Add a new element to each column of the new line
-  for (int col = 0; col < matrix->width; col++) {
-    newRowNode->row = AddElementToRow(newRowNode->row, newRow[col], col);
-    if (!newRowNode->row) {
-      free(newRowNode);
-      return MEMORY_ALLOCATION_FAILURE;
-    }
+/**
+ *  @brief  Adds a character to the value being scanned. Separators and line
+ *          breaks are handled by the caller.
+ *  @param  scanner - The scanner.
+ *  @param  c       - The character.
+ *  @retval `FILE_READ_ERROR` - The character cannot be part of the value, or
+ *                              the value is out of the range of `int`.
+ *  @retval `SUCCESS`         - Operation successful.
+ */
+static int ScanValueChar(ValueScanner* scanner, char c) {
+  if (c == ' ' || c == '\t' || c == '\r') {
+    scanner->ended = scanner->hasDigits || scanner->negative;
+    return SUCCESS;
+  }
+  if (scanner->ended) {
+    return FILE_READ_ERROR;  // Blanks inside the value
+  }
+  if (c == '-' && !scanner->negative && !scanner->hasDigits) {
+    scanner->negative = 1;
+    return SUCCESS;
+  }
+  if (c < '0' || c > '9') {
+    return FILE_READ_ERROR;
   }
 
-  // Insert the new line to beginning of matrix
-  newRowNode->nextRow = matrix->head;
-  matrix->head = newRowNode;
-  matrix->height++;
-
+  unsigned int digit = (unsigned int)(c - '0');
+  unsigned int limit = (unsigned int)INT_MAX + (unsigned int)scanner->negative;
+  if (scanner->magnitude > (limit - digit) / 10) {
+    return FILE_READ_ERROR;
+  }
+  scanner->magnitude = scanner->magnitude * 10 + digit;
+  scanner->hasDigits = 1;
   return SUCCESS;
 }
 
 /**
- *  @brief  Inserts a column at the end of a row in the matrix.
- *  @param  matrix          - The matrix where we will insert the new column.
- *  @param  newColumn       - Array with the values of the new column.
- *  @param  sizeArray       - Size of the array.
- *  @retval `OUT_OF_BOUNDS`  - Size of the array is different from the size of
- *                             the matrix.
+ *  @brief  Ends the value being scanned and resets the scanner.
+ *  @param  scanner  - The scanner.
+ *  @param  value    - Variable that will hold the value.
+ *  @param  hasValue - Variable that will hold 0 if only blanks were scanned,
+ *                     which is an empty value, and 1 otherwise.
+ *  @retval `FILE_READ_ERROR` - A minus sign without digits.
+ *  @retval `SUCCESS`         - Operation successful.
+ */
+static int EndValue(ValueScanner* scanner, int* value, int* hasValue) {
+  int status = scanner->negative && !scanner->hasDigits ? FILE_READ_ERROR
+                                                         : SUCCESS;
+  *hasValue = scanner->hasDigits;
+  *value = !scanner->hasDigits ? 0
+           : scanner->negative ? -(int)(scanner->magnitude - 1) - 1
+                               : (int)scanner->magnitude;
+
+  scanner->magnitude = 0;
+  scanner->negative = 0;
+  scanner->hasDigits = 0;
+  scanner->ended = 0;
+  return status;
+}
+
+/**
+ * @struct MatrixParser
+ * @brief Incremental parser that builds a matrix from chunks of text that
+ *        may split values and rows at any byte.
+ */
+typedef struct MatrixParser {
+  Matrix* matrix;              // Matrix being built
+  MatrixRowNode* lastRow;      // Last row linked into the matrix
+  MatrixRowNode* currentRow;   // Row being parsed, not linked yet
+  MatrixElement* lastElement;  // Last element of `currentRow`
+  int columnCount;             // Elements parsed in `currentRow`
+  ValueScanner scanner;        // Value being parsed
+} MatrixParser;
+
+/**
+ *  @brief  Adds the value being parsed to the current row.
+ *  @param  parser - The parser.
  *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `FILE_READ_ERROR`           - Row longer than the first row, or
+ *                                        malformed value.
  *  @retval `SUCCESS`                   - Operation successful.
  */
-int InsertColumn(Matrix* matrix, const int* newColumn, const int sizeArray) {
-  if (matrix->height != sizeArray) {
-    return OUT_OF_BOUNDS;
+static int FinishElement(MatrixParser* parser) {
+  int value;
+  int hasValue;
+  int status = EndValue(&parser->scanner, &value, &hasValue);
+  if (status != SUCCESS || !hasValue) {
+    return status;  // Empty values are skipped, as `strtok` would
   }
 
-  // Calculate the new column index
-  int newColumnIndex = matrix->width;
+  if (parser->matrix->height > 0 &&
+      parser->columnCount == parser->matrix->width) {
+    return FILE_READ_ERROR;
+  }
 
-  // Iterate over the matrix to insert the new columns
-  MatrixRowNode* currentRowNode = matrix->head;
-  while (currentRowNode) {
-    // Add new element to the end of the line with the value of `newColumn`
-    currentRowNode->row =
-        AddElementToRow(currentRowNode->row, *newColumn, newColumnIndex);
-    if (!currentRowNode->row) {
+  if (parser->currentRow == NULL) {
+    parser->currentRow = malloc(sizeof(MatrixRowNode));
+    if (parser->currentRow == NULL) {
       return MEMORY_ALLOCATION_FAILURE;
     }
-
-    currentRowNode = currentRowNode->nextRow;
-    newColumn++;
+    parser->currentRow->row = NULL;
+    parser->currentRow->nextRow = NULL;
   }
 
-  matrix->width++;
+  MatrixElement* element = CreateMatrixElement(value, parser->columnCount);
+  if (element == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  if (parser->currentRow->row == NULL) {
+    parser->currentRow->row = element;
+  } else {
+    parser->lastElement->nextCol = element;
+  }
+  parser->lastElement = element;
+  parser->columnCount++;
 
   return SUCCESS;
 }
 
 /**
- *  @brief  Deletes a row from the matrix.
- *  @param  matrix   - The matrix.
- *  @param  rowIndex - The row of the matrix to be deleted.
- *  @retval `OUT_OF_BOUNDS` - Position does not exist.
- *  @retval `SUCCESS`       - Operation successful.
+ *  @brief  Links the row being parsed into the matrix. Empty lines are
+ *          ignored.
+ *  @param  parser - The parser.
+ *  @retval `FILE_READ_ERROR` - Row with a different size than the first row.
+ *  @retval `SUCCESS`         - Operation successful.
  */
-int DeleteRow(Matrix* matrix, int rowIndex) {
-  if (rowIndex < 0 || rowIndex >= matrix->height) {
-    return OUT_OF_BOUNDS;
-  }
-
-  MatrixRowNode* currentRowNode = matrix->head;
-  MatrixRowNode* previousRowNode = NULL;
-
-  for (int i = 0; i < rowIndex; i++) {
-    previousRowNode = currentRowNode;
-    currentRowNode = currentRowNode->nextRow;
+static int FinishRow(MatrixParser* parser) {
+  if (parser->currentRow == NULL) {
+    return SUCCESS;
   }
 
-  // If the line to be deleted is the first
-  if (previousRowNode == NULL) {
-    matrix->head = currentRowNode->nextRow;
+  Matrix* matrix = parser->matrix;
+  if (matrix->height == 0) {
+    matrix->width = parser->columnCount;
+    matrix->head = parser->currentRow;
+  } else if (parser->columnCount != matrix->width) {
+    return FILE_READ_ERROR;
   } else {
-    previousRowNode->nextRow = currentRowNode->nextRow;
-  }
-
-  // Free memory of the line to be deleted
-  MatrixElement* currentElement = currentRowNode->row;
-  while (currentElement != NULL) {
-    MatrixElement* temp = currentElement;
-    currentElement = currentElement->nextCol;
-    free(temp);
+    parser->lastRow->nextRow = parser->currentRow;
   }
-  free(currentRowNode);
+  matrix->height++;
 
-  matrix->height--;
+  parser->lastRow = parser->currentRow;
+  parser->currentRow = NULL;
+  parser->lastElement = NULL;
+  parser->columnCount = 0;
 
   return SUCCESS;
 }
 
 /**
- *  @brief  Deletes a column from the matrix.
- *  @param  matrix   - The matrix.
- *  @param  colIndex - The column to be deleted.
- *  @retval `OUT_OF_BOUNDS` - Position does not exist.
- *  @retval `SUCCESS`       - Operation successful.
+ *  @brief  Parses a chunk of the text of a matrix file.
+ *  @param  parser - The parser.
+ *  @param  data   - The chunk of text.
+ *  @param  length - Number of bytes in `data`.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `FILE_READ_ERROR`           - Rows with different sizes, or
+ *                                        malformed value.
+ *  @retval `SUCCESS`                   - Operation successful.
  */
-int DeleteColumn(Matrix* matrix, int colIndex) {
-  if (matrix == NULL || colIndex < 0 || colIndex >= matrix->width) {
-    return OUT_OF_BOUNDS;
+static int ParseChunk(MatrixParser* parser, const char* data, size_t length) {
+  int status = SUCCESS;
+
+  for (size_t i = 0; i < length && status == SUCCESS; i++) {
+    char c = data[i];
+    if (c == ELEMENT_SEPARATOR[0]) {
+      status = FinishElement(parser);
+    } else if (c == '\n') {
+      status = FinishElement(parser);
+      if (status == SUCCESS) {
+        status = FinishRow(parser);
+      }
+    } else {
+      status = ScanValueChar(&parser->scanner, c);
+    }
   }
 
-  // Iterate over each line of the matrix
-  MatrixRowNode* currentRowNode = matrix->head;
-  while (currentRowNode != NULL) {
-    if (currentRowNode->row == NULL) {
-      currentRowNode = currentRowNode->nextRow;
-      continue;
+  return status;
+}
+
+/**
+ *  @brief Frees the partially built matrix of a parser.
+ *  @param parser - The parser.
+ */
+static void DiscardParser(MatrixParser* parser) {
+  if (parser->currentRow != NULL) {
+    MatrixElement* element = parser->currentRow->row;
+    while (element != NULL) {
+      MatrixElement* temp = element;
+      element = element->nextCol;
+      free(temp);
     }
+    free(parser->currentRow);
+  }
+  FreeMatrix(parser->matrix);
+  parser->matrix = NULL;
+}
 
-    // Iterate over elements in line
-    MatrixElement* currentElement = currentRowNode->row;
-    MatrixElement* previousElement = NULL;
-    for (int i = 0; i < colIndex; i++) {
-      // Check if element exists
-      if (currentElement == NULL) {
-        break;  // Column was not found, we skip to next line
-      }
-      previousElement = currentElement;
-      currentElement = currentElement->nextCol;
+/**
+ *  @brief Reads the file of an asynchronous load into its two buffers in
+ *         turns, waiting whenever the parser has not emptied the next one.
+ *  @param argument - The `MatrixLoadHandle` of the load.
+ */
+static void ReaderThread(void* argument) {
+  MatrixLoadHandle* handle = argument;
+
+  for (int index = 0;; index ^= 1) {
+    ReadBuffer* buffer = &handle->buffers[index];
+
+    LockMutex(&handle->mutex);
+    while (buffer->filled && !handle->stopReading) {
+      WaitCondition(&handle->condition, &handle->mutex);
+    }
+    int stop = handle->stopReading;
+    UnlockMutex(&handle->mutex);
+    if (stop) {
+      return;
     }
 
-    // If column was not found, we pass to next line
-    if (currentElement == NULL) {
-      currentRowNode = currentRowNode->nextRow;
-      continue;
+    // The parser does not touch a buffer until it is marked as filled
+    size_t length = fread(buffer->data, 1, ASYNC_READ_BLOCK_SIZE, handle->file);
+    int last = length < ASYNC_READ_BLOCK_SIZE;
+
+    LockMutex(&handle->mutex);
+    if (ferror(handle->file)) {
+      handle->readStatus = FILE_READ_ERROR;
     }
+    buffer->length = length;
+    buffer->last = last;
+    buffer->filled = 1;
+    BroadcastCondition(&handle->condition);
+    UnlockMutex(&handle->mutex);
 
-    if (previousElement == NULL) {
-      // Here, `currentElement` is the first to be deleted
-      currentRowNode->row = currentElement->nextCol;
-    } else {
-      previousElement->nextCol = currentElement->nextCol;
+    if (last) {
+      return;
     }
+  }
+}
 
-    free(currentElement);
+/**
+ *  @brief  Parses the buffers filled by the reader thread into a matrix.
+ *  @param  handle - The load.
+ *  @param  matrix - Matrix that will contain the data of the file.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `THREAD_CREATION_FAILURE`   - The reader thread was not created.
+ *  @retval `FILE_READ_ERROR`           - Read error, empty file, rows with
+ *                                        different sizes or malformed values.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+static int ParseBufferedFile(MatrixLoadHandle* handle, Matrix** matrix) {
+  MatrixParser parser = {0};
+  parser.matrix = malloc(sizeof(Matrix));
+  if (parser.matrix == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  parser.matrix->head = NULL;
+  parser.matrix->width = 0;
+  parser.matrix->height = 0;
 
-    // Skip to next line
-    currentRowNode = currentRowNode->nextRow;
+  ThreadHandle readerThread;
+  int status = StartThread(&readerThread, ReaderThread, handle);
+  if (status != SUCCESS) {
+    DiscardParser(&parser);
+    return status;
   }
 
-  // Decrement the matrix width
-  matrix->width--;
+  for (int index = 0;; index ^= 1) {
+    ReadBuffer* buffer = &handle->buffers[index];
 
-  return SUCCESS;
+    LockMutex(&handle->mutex);
+    while (!buffer->filled) {
+      WaitCondition(&handle->condition, &handle->mutex);
+    }
+    UnlockMutex(&handle->mutex);
+
+    // Parse this buffer while the reader fills the other one
+    int last = buffer->last;
+    status = ParseChunk(&parser, buffer->data, buffer->length);
+
+    LockMutex(&handle->mutex);
+    buffer->filled = 0;
+    if (status != SUCCESS) {
+      handle->stopReading = 1;
+    }
+    BroadcastCondition(&handle->condition);
+    UnlockMutex(&handle->mutex);
+
+    if (last || status != SUCCESS) {
+      break;
+    }
+  }
+
+  JoinThread(readerThread);
+
+  if (status == SUCCESS) {
+    status = handle->readStatus;
+  }
+  // The last value and row may not end with a separator
+  if (status == SUCCESS) {
+    status = FinishElement(&parser);
+  }
+  if (status == SUCCESS) {
+    status = FinishRow(&parser);
+  }
+  if (status == SUCCESS && parser.matrix->height == 0) {
+    status = FILE_READ_ERROR;
+  }
+
+  if (status != SUCCESS) {
+    DiscardParser(&parser);
+    return status;
+  }
+
+  *matrix = parser.matrix;
+  return SUCCESS;
+}
+
+/**
+ *  @brief Releases the resources of an asynchronous load.
+ *  @param handle - The load.
+ */
+static void DestroyMatrixLoadHandle(MatrixLoadHandle* handle) {
+  if (handle->file != NULL) {
+    fclose(handle->file);
+  }
+  free(handle->buffers[0].data);
+  free(handle->buffers[1].data);
+  DestroyCondition(&handle->condition);
+  DestroyMutex(&handle->mutex);
+  free(handle);
+}
+
+/**
+ *  @brief Body of the parser thread of an asynchronous load.
+ *  @param argument - The `MatrixLoadHandle` of the load.
+ */
+static void LoaderThread(void* argument) {
+  MatrixLoadHandle* handle = argument;
+
+  Matrix* matrix = NULL;
+  int status = ParseBufferedFile(handle, &matrix);
+  fclose(handle->file);
+  handle->file = NULL;
+
+  if (handle->callback != NULL) {
+    handle->callback(status, matrix, handle->userData);
+  }
+
+  // `detached` never changes after the load starts
+  int detached = handle->detached;
+  LockMutex(&handle->mutex);
+  handle->status = status;
+  handle->matrix = matrix;
+  handle->complete = 1;
+  BroadcastCondition(&handle->condition);
+  UnlockMutex(&handle->mutex);
+
+  if (detached) {
+    DestroyMatrixLoadHandle(handle);
+  }
+}
+
+/**
+ *  @brief  Starts loading a matrix from a file in the background.
+ *  @details A reader thread fills two buffers of `ASYNC_READ_BLOCK_SIZE`
+ *           bytes in turns while a parser thread tokenizes the other one, so
+ *           disk reads overlap with parsing. The file is read only once.
+ *           When the load finishes, `callback` (if any) is called from the
+ *           parser thread. The loaded matrix belongs to the caller, whether
+ *           it is received in the callback or through `WaitMatrixLoad`.
+ *           Each value must be an integer in the range of `int`, with an
+ *           optional minus sign and blanks around it.
+ *  @param  filename - The name of the file.
+ *  @param  callback - Function called when the load finishes, or NULL.
+ *  @param  userData - Pointer passed to `callback`.
+ *  @param  handle   - Handle of the load, or NULL to run it detached (in that
+ *                     case `callback` is required).
+ *  @retval `NULL_POINTER`              - No filename, or neither a handle nor
+ *                                        a callback was provided.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `THREAD_CREATION_FAILURE`   - The loader thread was not created.
+ *  @retval `SUCCESS`                   - The load was started.
+ */
+int CreateMatrixFromFileAsync(const char* filename, MatrixLoadCallback callback,
+                              void* userData, MatrixLoadHandle** handle) {
+  if (filename == NULL || (handle == NULL && callback == NULL)) {
+    return NULL_POINTER;
+  }
+
+  MatrixLoadHandle* load = calloc(1, sizeof(MatrixLoadHandle));
+  if (load == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  load->buffers[0].data = malloc(ASYNC_READ_BLOCK_SIZE);
+  load->buffers[1].data = malloc(ASYNC_READ_BLOCK_SIZE);
+  if (load->buffers[0].data == NULL || load->buffers[1].data == NULL) {
+    free(load->buffers[0].data);
+    free(load->buffers[1].data);
+    free(load);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  InitMutex(&load->mutex);
+  InitCondition(&load->condition);
+
+  load->file = fopen(filename, "rb");
+  if (load->file == NULL) {
+    DestroyMatrixLoadHandle(load);
+    return CANNOT_OPEN_FILE;
+  }
+  load->callback = callback;
+  load->userData = userData;
+  load->detached = handle == NULL;
+  load->readStatus = SUCCESS;
+
+  int status = StartThread(&load->parserThread, LoaderThread, load);
+  if (status != SUCCESS) {
+    DestroyMatrixLoadHandle(load);
+    return status;
+  }
+
+  if (handle == NULL) {
+    DetachThread(load->parserThread);
+  } else {
+    *handle = load;
+  }
+
+  return SUCCESS;
+}
+
+/**
+ *  @brief  Checks whether an asynchronous matrix load has finished.
+ *  @param  handle - Handle of the load.
+ *  @retval 1 if the load has finished, 0 otherwise.
+ */
+int IsMatrixLoadComplete(MatrixLoadHandle* handle) {
+  if (handle == NULL) {
+    return 0;
+  }
+
+  LockMutex(&handle->mutex);
+  int complete = handle->complete;
+  UnlockMutex(&handle->mutex);
+
+  return complete;
+}
+
+/**
+ *  @brief  Waits for an asynchronous matrix load to finish.
+ *  @param  handle - Handle of the load.
+ *  @param  matrix - Matrix that will contain the loaded data, or NULL if the
+ *                   load failed. May be NULL when the matrix was already
+ *                   taken in the callback.
+ *  @retval `NULL_POINTER`              - The handle is NULL.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `THREAD_CREATION_FAILURE`   - The reader thread was not created.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file,
+ *                                        rows with different sizes or
+ *                                        malformed values.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+int WaitMatrixLoad(MatrixLoadHandle* handle, Matrix** matrix) {
+  if (handle == NULL) {
+    return NULL_POINTER;
+  }
+
+  LockMutex(&handle->mutex);
+  while (!handle->complete) {
+    WaitCondition(&handle->condition, &handle->mutex);
+  }
+  UnlockMutex(&handle->mutex);
+
+  if (matrix != NULL) {
+    *matrix = handle->matrix;
+  }
+  return handle->status;
+}
+
+/**
+ *  @brief Waits for an asynchronous matrix load to finish and frees its
+ *         handle. The loaded matrix is not freed.
+ *  @param handle - Handle of the load.
+ */
+void FreeMatrixLoadHandle(MatrixLoadHandle* handle) {
+  if (handle == NULL) {
+    return;
+  }
+
+  JoinThread(handle->parserThread);
+  DestroyMatrixLoadHandle(handle);
+}
+
+/**
+ *  @brief  Inserts a row into the matrix.
+ *  @param  matrix       - The matrix where we will insert a new row.
+ *  @param  newRow       - Array with the values of the new row.
+ *  @param  sizeArray    - Size of the array.
+ *  @retval `OUT_OF_BOUNDS`  - Size of the array is different from the size of
+ *                             the matrix.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+int InsertRow(Matrix* matrix, const int* newRow, const int sizeArray) {
+  if (matrix->width != sizeArray) {
+    return OUT_OF_BOUNDS;
+  }
+
+  MatrixRowNode* newRowNode = malloc(sizeof(MatrixRowNode));
+  if (!newRowNode) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  newRowNode->row = NULL;
+
+  // Add a new element to each column of the new line
+  for (int col = 0; col < matrix->width; col++) {
+    newRowNode->row = AddElementToRow(newRowNode->row, newRow[col], col);
+    if (!newRowNode->row) {
+      free(newRowNode);
+      return MEMORY_ALLOCATION_FAILURE;
+    }
+  }
+
+  // Insert the new line to beginning of matrix
+  newRowNode->nextRow = matrix->head;
+  matrix->head = newRowNode;
+  matrix->height++;
+
+  return SUCCESS;
+}
+
+/**
+ *  @brief  Inserts a column at the end of a row in the matrix.
+ *  @param  matrix          - The matrix where we will insert the new column.
+ *  @param  newColumn       - Array with the values of the new column.
+ *  @param  sizeArray       - Size of the array.
+ *  @retval `OUT_OF_BOUNDS`  - Size of the array is different from the size of
+ *                             the matrix.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+int InsertColumn(Matrix* matrix, const int* newColumn, const int sizeArray) {
+  if (matrix->height != sizeArray) {
+    return OUT_OF_BOUNDS;
+  }
+
+  // Calculate the new column index
+  int newColumnIndex = matrix->width;
+
+  // Iterate over the matrix to insert the new columns
+  MatrixRowNode* currentRowNode = matrix->head;
+  while (currentRowNode) {
+    // Add new element to the end of the line with the value of `newColumn`
+    currentRowNode->row =
+        AddElementToRow(currentRowNode->row, *newColumn, newColumnIndex);
+    if (!currentRowNode->row) {
+      return MEMORY_ALLOCATION_FAILURE;
+    }
+
+    currentRowNode = currentRowNode->nextRow;
+    newColumn++;
+  }
+
+  matrix->width++;
+
+  return SUCCESS;
+}
+
+/**
+ *  @brief  Deletes a row from the matrix.
+ *  @param  matrix   - The matrix.
+ *  @param  rowIndex - The row of the matrix to be deleted.
+ *  @retval `OUT_OF_BOUNDS` - Position does not exist.
+ *  @retval `SUCCESS`       - Operation successful.
+ */
+int DeleteRow(Matrix* matrix, int rowIndex) {
+  if (rowIndex < 0 || rowIndex >= matrix->height) {
+    return OUT_OF_BOUNDS;
+  }
+
+  MatrixRowNode* currentRowNode = matrix->head;
+  MatrixRowNode* previousRowNode = NULL;
+
+  for (int i = 0; i < rowIndex; i++) {
+    previousRowNode = currentRowNode;
+    currentRowNode = currentRowNode->nextRow;
+  }
+
+  // If the line to be deleted is the first
+  if (previousRowNode == NULL) {
+    matrix->head = currentRowNode->nextRow;
+  } else {
+    previousRowNode->nextRow = currentRowNode->nextRow;
+  }
+
+  // Free memory of the line to be deleted
+  MatrixElement* currentElement = currentRowNode->row;
+  while (currentElement != NULL) {
+    MatrixElement* temp = currentElement;
+    currentElement = currentElement->nextCol;
+    free(temp);
+  }
+  free(currentRowNode);
+
+  matrix->height--;
+
+  return SUCCESS;
+}
+
+/**
+ *  @brief  Deletes a column from the matrix.
+ *  @param  matrix   - The matrix.
+ *  @param  colIndex - The column to be deleted.
+ *  @retval `OUT_OF_BOUNDS` - Position does not exist.
+ *  @retval `SUCCESS`       - Operation successful.
+ */
+int DeleteColumn(Matrix* matrix, int colIndex) {
+  if (matrix == NULL || colIndex < 0 || colIndex >= matrix->width) {
+    return OUT_OF_BOUNDS;
+  }
+
+  // Iterate over each line of the matrix
+  MatrixRowNode* currentRowNode = matrix->head;
+  while (currentRowNode != NULL) {
+    if (currentRowNode->row == NULL) {
+      currentRowNode = currentRowNode->nextRow;
+      continue;
+    }
+
+    // Iterate over elements in line
+    MatrixElement* currentElement = currentRowNode->row;
+    MatrixElement* previousElement = NULL;
+    for (int i = 0; i < colIndex; i++) {
+      // Check if element exists
+      if (currentElement == NULL) {
+        break;  // Column was not found, we skip to next line
+      }
+      previousElement = currentElement;
+      currentElement = currentElement->nextCol;
+    }
+
+    // If column was not found, we pass to next line
+    if (currentElement == NULL) {
+      currentRowNode = currentRowNode->nextRow;
+      continue;
+    }
+
+    if (previousElement == NULL) {
+      // Here, `currentElement` is the first to be deleted
+      currentRowNode->row = currentElement->nextCol;
+    } else {
+      previousElement->nextCol = currentElement->nextCol;
+    }
+
+    // The columns after the deleted one move one position to the left
+    for (MatrixElement* nextElement = currentElement->nextCol;
+         nextElement != NULL; nextElement = nextElement->nextCol) {
+      nextElement->column--;
+    }
+
+    free(currentElement);
+
+    // Skip to next line
+    currentRowNode = currentRowNode->nextRow;
+  }
+
+  // Decrement the matrix width
+  matrix->width--;
+
+  return SUCCESS;
+}
+
+/**
+ * @struct TripletList
+ * @brief Growing list of (row, column, value) triplets read from a file.
+ */
+typedef struct TripletList {
+  int* rows;     // Row of each triplet
+  int* cols;     // Column of each triplet
+  int* values;   // Value of each triplet
+  int count;     // Number of triplets
+  int capacity;  // Number of triplets that fit in the arrays
+} TripletList;
+
+/**
+ *  @brief  Reads the whole content of a file into a NUL-terminated string.
+ *  @param  filename - The name of the file.
+ *  @param  text     - String that will hold the content of the file.
+ *  @param  length   - Variable that will hold the number of bytes read, or
+ *                     NULL.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+static int ReadTextFile(const char* filename, char** text, size_t* length) {
+  FILE* file = fopen(filename, "rb");
+  if (file == NULL) {
+    return CANNOT_OPEN_FILE;
+  }
+
+  size_t capacity = ASYNC_READ_BLOCK_SIZE;
+  size_t size = 0;
+  char* buffer = malloc(capacity + 1);
+  while (buffer != NULL) {
+    size += fread(buffer + size, 1, capacity - size, file);
+    if (size < capacity) {
+      break;
+    }
+    capacity *= 2;
+    char* larger = realloc(buffer, capacity + 1);
+    if (larger == NULL) {
+      free(buffer);
+    }
+    buffer = larger;
+  }
+
+  int failed = ferror(file);
+  fclose(file);
+  if (buffer == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  if (failed) {
+    free(buffer);
+    return FILE_READ_ERROR;
+  }
+
+  buffer[size] = '\0';
+  *text = buffer;
+  if (length != NULL) {
+    *length = size;
+  }
+  return SUCCESS;
+}
+
+/**
+ *  @brief  Parses the numbers of one line of text.
+ *  @param  line     - Start of the line; numbers may be separated by spaces,
+ *                     tabs, `,` or `;`.
+ *  @param  numbers  - Array that will hold the numbers.
+ *  @param  maxCount - Maximum number of numbers to parse.
+ *  @param  next     - Variable that will point to the start of the next line.
+ *  @retval The number of numbers parsed, or -1 if the line has text that is
+ *          not a number.
+ */
+static int ParseNumberLine(const char* line, double* numbers, int maxCount,
+                           const char** next) {
+  int count = 0;
+  const char* cursor = line;
+
+  while (*cursor != '\0' && *cursor != '\n') {
+    if (*cursor == ' ' || *cursor == '\t' || *cursor == '\r' ||
+        *cursor == ',' || *cursor == ELEMENT_SEPARATOR[0]) {
+      cursor++;
+      continue;
+    }
+
+    char* end = NULL;
+    double number = strtod(cursor, &end);
+    if (end == cursor || count == maxCount) {
+      count = -1;
+      break;
+    }
+    numbers[count++] = number;
+    cursor = end;
+  }
+
+  // Skip the rest of the line
+  while (*cursor != '\0' && *cursor != '\n') {
+    cursor++;
+  }
+  *next = *cursor == '\n' ? cursor + 1 : cursor;
+
+  return count;
+}
+
+/**
+ *  @brief  Checks that a number read from a file is a whole number within a
+ *          range, as indices and sizes must be.
+ *  @param  number - The number.
+ *  @param  min    - Smallest valid number.
+ *  @param  max    - Largest valid number.
+ *  @retval 1 if the number is valid, 0 otherwise (NaN included).
+ */
+static int IsWholeNumberInRange(double number, double min, double max) {
+  return number >= min && number <= max && number == floor(number);
+}
+
+/**
+ *  @brief  Converts a finite number read from a file to the nearest integer.
+ *  @param  number - The number.
+ *  @retval The nearest integer, limited to the range of `int`.
+ */
+static int RoundToInt(double number) {
+  if (number >= (double)INT_MAX) {
+    return INT_MAX;
+  }
+  if (number <= (double)INT_MIN) {
+    return INT_MIN;
+  }
+  return (int)lround(number);
+}
+
+/**
+ *  @brief  Adds a triplet to a list, growing the list when it is full.
+ *  @param  list  - The list.
+ *  @param  row   - The row of the triplet.
+ *  @param  col   - The column of the triplet.
+ *  @param  value - The value of the triplet.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+static int AppendTriplet(TripletList* list, int row, int col, int value) {
+  if (list->count == list->capacity) {
+    int capacity = list->capacity > 0 ? list->capacity * 2 : 1024;
+    int* rows = realloc(list->rows, (size_t)capacity * sizeof(int));
+    if (rows != NULL) {
+      list->rows = rows;
+    }
+    int* cols = realloc(list->cols, (size_t)capacity * sizeof(int));
+    if (cols != NULL) {
+      list->cols = cols;
+    }
+    int* values = realloc(list->values, (size_t)capacity * sizeof(int));
+    if (values != NULL) {
+      list->values = values;
+    }
+    if (rows == NULL || cols == NULL || values == NULL) {
+      return MEMORY_ALLOCATION_FAILURE;
+    }
+    list->capacity = capacity;
+  }
+
+  list->rows[list->count] = row;
+  list->cols[list->count] = col;
+  list->values[list->count] = value;
+  list->count++;
+  return SUCCESS;
+}
+
+/**
+ *  @brief Frees the arrays of a triplet list.
+ *  @param list - The list.
+ */
+static void FreeTripletList(TripletList* list) {
+  free(list->rows);
+  free(list->cols);
+  free(list->values);
+}
+
+/**
+ *  @brief  Creates a sparse matrix from a file of triplets.
+ *  @details Each line holds `row col value`, with 0-based indices separated
+ *           by spaces, tabs, `,` or `;`. Empty lines and lines starting
+ *           with `#` or `%` are ignored. The size of the matrix is given by
+ *           the largest indices. Indices must be whole numbers; finite real
+ *           values are rounded to integers, limited to the range of `int`.
+ *  @param  filename    - The name of the file.
+ *  @param  threadCount - Number of threads used to sort the rows.
+ *  @param  matrix      - Matrix that will contain the data of the file.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file.
+ *  @retval `INVALID_FILE_FORMAT`       - A line is not a valid triplet, or
+ *                                        the file has no triplets.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateSparseMatrixFromTripletFile(const char* filename, int threadCount,
+                                      SparseMatrix** matrix) {
+  if (filename == NULL || matrix == NULL) {
+    return NULL_POINTER;
+  }
+
+  char* text = NULL;
+  int status = ReadTextFile(filename, &text, NULL);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  TripletList list = {0};
+  int width = 0;
+  int height = 0;
+  const char* line = text;
+  while (*line != '\0' && status == SUCCESS) {
+    if (*line == '#' || *line == '%') {
+      while (*line != '\0' && *line != '\n') {
+        line++;
+      }
+      line += *line == '\n';
+      continue;
+    }
+
+    double numbers[3];
+    int count = ParseNumberLine(line, numbers, 3, &line);
+    if (count == 0) {
+      continue;  // Empty line
+    }
+    // The size of the matrix is one more than the largest indices
+    if (count != 3 || !IsWholeNumberInRange(numbers[0], 0, INT_MAX - 1) ||
+        !IsWholeNumberInRange(numbers[1], 0, INT_MAX - 1) ||
+        !isfinite(numbers[2])) {
+      status = INVALID_FILE_FORMAT;
+      break;
+    }
+
+    int row = (int)numbers[0];
+    int col = (int)numbers[1];
+    height = row >= height ? row + 1 : height;
+    width = col >= width ? col + 1 : width;
+    status = AppendTriplet(&list, row, col, RoundToInt(numbers[2]));
+  }
+  free(text);
+
+  if (status == SUCCESS && list.count == 0) {
+    status = INVALID_FILE_FORMAT;
+  }
+  if (status == SUCCESS) {
+    status = CreateSparseMatrixFromTriplets(width, height, list.rows,
+                                            list.cols, list.values, list.count,
+                                            threadCount, matrix);
+  }
+
+  FreeTripletList(&list);
+  return status;
+}
+
+/**
+ *  @brief  Creates a sparse matrix from a Matrix Market (`.mtx`) file.
+ *  @details Supports the `coordinate` format with `integer`, `real` or
+ *           `pattern` fields (pattern entries have value 1) and `general`,
+ *           `symmetric` or `skew-symmetric` symmetry. Sizes and indices must
+ *           be whole numbers; finite real values are rounded to integers,
+ *           limited to the range of `int`.
+ *  @param  filename    - The name of the file.
+ *  @param  threadCount - Number of threads used to sort the rows.
+ *  @param  matrix      - Matrix that will contain the data of the file.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file.
+ *  @retval `INVALID_FILE_FORMAT`       - Unsupported or malformed file.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateSparseMatrixFromMatrixMarket(const char* filename, int threadCount,
+                                       SparseMatrix** matrix) {
+  if (filename == NULL || matrix == NULL) {
+    return NULL_POINTER;
+  }
+
+  char* text = NULL;
+  int status = ReadTextFile(filename, &text, NULL);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  // Banner: %%MatrixMarket matrix coordinate <field> <symmetry>
+  char banner[5][32] = {{0}};
+  int words = sscanf(text, "%31s %31s %31s %31s %31s", banner[0], banner[1],
+                     banner[2], banner[3], banner[4]);
+  for (int i = 0; i < 5; i++) {
+    for (char* c = banner[i]; *c != '\0'; c++) {
+      *c = (char)tolower((unsigned char)*c);
+    }
+  }
+  int isPattern = strcmp(banner[3], "pattern") == 0;
+  int isSymmetric = strcmp(banner[4], "symmetric") == 0;
+  int isSkew = strcmp(banner[4], "skew-symmetric") == 0;
+  if (words != 5 || strcmp(banner[0], "%%matrixmarket") != 0 ||
+      strcmp(banner[1], "matrix") != 0 ||
+      strcmp(banner[2], "coordinate") != 0 ||
+      (!isPattern && strcmp(banner[3], "integer") != 0 &&
+       strcmp(banner[3], "real") != 0) ||
+      (!isSymmetric && !isSkew && strcmp(banner[4], "general") != 0)) {
+    free(text);
+    return INVALID_FILE_FORMAT;
+  }
+
+  // Skip the banner and the comments to reach the size line
+  const char* line = text;
+  while (*line == '%' || *line == '\n' || *line == '\r') {
+    while (*line != '\0' && *line != '\n') {
+      line++;
+    }
+    line += *line == '\n';
+  }
+
+  double size[3];
+  if (ParseNumberLine(line, size, 3, &line) != 3 ||
+      !IsWholeNumberInRange(size[0], 1, INT_MAX) ||
+      !IsWholeNumberInRange(size[1], 1, INT_MAX) ||
+      !IsWholeNumberInRange(size[2], 0, INT_MAX / 2)) {
+    free(text);
+    return INVALID_FILE_FORMAT;
+  }
+  int height = (int)size[0];
+  int width = (int)size[1];
+  int declared = (int)size[2];
+
+  TripletList list = {0};
+  int valueCount = isPattern ? 2 : 3;
+  int read = 0;
+  while (*line != '\0' && status == SUCCESS) {
+    double numbers[3];
+    int count = ParseNumberLine(line, numbers, valueCount, &line);
+    if (count == 0) {
+      continue;  // Empty line
+    }
+    if (count != valueCount || !IsWholeNumberInRange(numbers[0], 1, height) ||
+        !IsWholeNumberInRange(numbers[1], 1, width) ||
+        (!isPattern && !isfinite(numbers[2])) || read == declared) {
+      status = INVALID_FILE_FORMAT;
+      break;
+    }
+
+    int row = (int)numbers[0] - 1;
+    int col = (int)numbers[1] - 1;
+    int value = isPattern ? 1 : RoundToInt(numbers[2]);
+    status = AppendTriplet(&list, row, col, value);
+    // Symmetric files only store one triangle
+    if (status == SUCCESS && (isSymmetric || isSkew) && row != col) {
+      // -INT_MIN does not fit in an `int`, so it saturates to `INT_MAX`
+      int mirrored = !isSkew ? value : value == INT_MIN ? INT_MAX : -value;
+      status = AppendTriplet(&list, col, row, mirrored);
+    }
+    read++;
+  }
+  free(text);
+
+  if (status == SUCCESS && read != declared) {
+    status = INVALID_FILE_FORMAT;
+  }
+  if (status == SUCCESS) {
+    status = CreateSparseMatrixFromTriplets(width, height, list.rows,
+                                            list.cols, list.values, list.count,
+                                            threadCount, matrix);
+  }
+
+  FreeTripletList(&list);
+  return status;
+}
+
+/**
+ *  @brief  Finds the value of a key in the header of a `.npy` file.
+ *  @param  header - The header, a Python dictionary literal.
+ *  @param  key    - The key, including its quotes.
+ *  @retval The first character of the value, or NULL if the key is missing.
+ */
+static const char* FindNpyValue(const char* header, const char* key) {
+  const char* position = strstr(header, key);
+  if (position == NULL) {
+    return NULL;
+  }
+  position += strlen(key);
+  while (*position == ' ' || *position == ':') {
+    position++;
+  }
+  return position;
+}
+
+/**
+ *  @brief  Reads the type, order and shape from the header of a `.npy` file.
+ *  @param  header - The header, a NUL-terminated Python dictionary literal.
+ *  @param  type   - Variable that will hold the type of the values.
+ *  @param  width  - Variable that will hold the number of columns.
+ *  @param  height - Variable that will hold the number of rows.
+ *  @retval `INVALID_FILE_FORMAT` - Unsupported type, order or shape.
+ *  @retval `SUCCESS`             - Operation successful.
+ */
+static int ParseNpyHeader(const char* header, DenseType* type, int* width,
+                          int* height) {
+  // Only little-endian values are supported ('=' is native, also little)
+  const char* descr = FindNpyValue(header, "'descr'");
+  if (descr == NULL || (descr[0] != '\'' && descr[0] != '"') ||
+      (descr[1] != '<' && descr[1] != '=') || descr[4] != descr[0]) {
+    return INVALID_FILE_FORMAT;
+  }
+  if (strncmp(descr + 2, "i4", 2) == 0) {
+    *type = DENSE_INT32;
+  } else if (strncmp(descr + 2, "i8", 2) == 0) {
+    *type = DENSE_INT64;
+  } else if (strncmp(descr + 2, "f8", 2) == 0) {
+    *type = DENSE_FLOAT64;
+  } else {
+    return INVALID_FILE_FORMAT;
+  }
+
+  const char* order = FindNpyValue(header, "'fortran_order'");
+  if (order == NULL || strncmp(order, "False", 5) != 0) {
+    return INVALID_FILE_FORMAT;
+  }
+
+  // Shape of a 2-D array: (height, width)
+  const char* shape = FindNpyValue(header, "'shape'");
+  if (shape == NULL || *shape != '(') {
+    return INVALID_FILE_FORMAT;
+  }
+  long dimensions[2];
+  char* end = (char*)shape + 1;
+  for (int i = 0; i < 2; i++) {
+    const char* start = end;
+    dimensions[i] = strtol(start, &end, 10);
+    if (end == start || dimensions[i] <= 0 || dimensions[i] > INT_MAX) {
+      return INVALID_FILE_FORMAT;
+    }
+    while (*end == ' ' || *end == ',') {
+      end++;
+    }
+  }
+  if (*end != ')') {
+    return INVALID_FILE_FORMAT;
+  }
+
+  *height = (int)dimensions[0];
+  *width = (int)dimensions[1];
+  return SUCCESS;
+}
+
+/**
+ *  @brief  Loads a NumPy `.npy` file into a dense matrix without copying.
+ *  @details The file must hold a 2-D, C-order array of little-endian
+ *           `int32`, `int64` or `float64` values. The file is mapped into
+ *           memory and the matrix points straight at its values; changes to
+ *           the matrix are never written back to the file.
+ *  @param  filename - The name of the file.
+ *  @param  matrix   - Matrix that will contain the data of the file.
+ *  @retval `NULL_POINTER`              - No filename or matrix provided.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_READ_ERROR`           - The file cannot be mapped.
+ *  @retval `INVALID_FILE_FORMAT`       - Not a supported `.npy` file.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateDenseMatrixFromNpy(const char* filename, DenseMatrix** matrix) {
+  if (filename == NULL || matrix == NULL) {
+    return NULL_POINTER;
+  }
+
+  FileMapping* mapping = malloc(sizeof(FileMapping));
+  DenseMatrix* newMatrix = malloc(sizeof(DenseMatrix));
+  char* header = malloc(NPY_MAX_HEADER_SIZE + 1);
+  if (mapping == NULL || newMatrix == NULL || header == NULL) {
+    free(mapping);
+    free(newMatrix);
+    free(header);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  int status = MapFile(filename, mapping);
+  if (status != SUCCESS) {
+    free(mapping);
+    free(newMatrix);
+    free(header);
+    return status;
+  }
+
+  // Magic, version, header length (2 bytes in version 1, 4 after) and the
+  // header itself
+  const unsigned char* bytes = mapping->address;
+  size_t headerStart = 0;
+  size_t headerLength = 0;
+  status = INVALID_FILE_FORMAT;
+  if (mapping->size >= 12 &&
+      memcmp(bytes, NPY_MAGIC, NPY_MAGIC_SIZE) == 0 &&
+      bytes[NPY_MAGIC_SIZE] >= 1 && bytes[NPY_MAGIC_SIZE] <= 3) {
+    headerStart = bytes[NPY_MAGIC_SIZE] == 1 ? 10 : 12;
+    for (size_t i = headerStart - 1; i >= NPY_MAGIC_SIZE + 2; i--) {
+      headerLength = (headerLength << 8) | bytes[i];
+    }
+    if (headerLength <= NPY_MAX_HEADER_SIZE &&
+        headerStart + headerLength <= mapping->size) {
+      memcpy(header, bytes + headerStart, headerLength);
+      header[headerLength] = '\0';
+      status = ParseNpyHeader(header, &newMatrix->type, &newMatrix->width,
+                              &newMatrix->height);
+    }
+  }
+  free(header);
+
+  // The values must be in the file and aligned for their type
+  size_t dataOffset = headerStart + headerLength;
+  if (status == SUCCESS) {
+    size_t typeSize = GetDenseTypeSize(newMatrix->type);
+    size_t available = (mapping->size - dataOffset) / typeSize;
+    if ((size_t)newMatrix->height > available / (size_t)newMatrix->width ||
+        dataOffset % typeSize != 0) {
+      status = INVALID_FILE_FORMAT;
+    }
+  }
+
+  if (status != SUCCESS) {
+    UnmapFile(mapping);
+    free(mapping);
+    free(newMatrix);
+    return status;
+  }
+
+  newMatrix->data = (unsigned char*)mapping->address + dataOffset;
+  newMatrix->mapping = mapping;
+  *matrix = newMatrix;
+  return SUCCESS;
+}
+
+/**
+ *  @brief  Writes a dense matrix to a NumPy `.npy` file.
+ *  @param  filename - The name of the file.
+ *  @param  matrix   - The matrix.
+ *  @retval `NULL_POINTER`              - No filename or matrix provided.
+ *  @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_WRITE_ERROR`          - Error writing to the file.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+int WriteDenseMatrixToNpy(const char* filename, const DenseMatrix* matrix) {
+  if (filename == NULL || matrix == NULL) {
+    return NULL_POINTER;
+  }
+
+  size_t typeSize = GetDenseTypeSize(matrix->type);
+  if (typeSize == 0 || matrix->width <= 0 || matrix->height <= 0 ||
+      matrix->data == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  const char* descr = matrix->type == DENSE_INT32   ? "<i4"
+                      : matrix->type == DENSE_INT64 ? "<i8"
+                                                    : "<f8";
+
+  // Version 1.0 header, padded with spaces so the values start aligned
+  char header[2 * NPY_HEADER_ALIGNMENT + 64];
+  int length = snprintf(header, sizeof(header),
+                        "{'descr': '%s', 'fortran_order': False, "
+                        "'shape': (%d, %d), }",
+                        descr, matrix->height, matrix->width);
+  while ((10 + length + 1) % NPY_HEADER_ALIGNMENT != 0) {
+    header[length++] = ' ';
+  }
+  header[length++] = '\n';
+
+  unsigned char prefix[10];
+  memcpy(prefix, NPY_MAGIC, NPY_MAGIC_SIZE);
+  prefix[6] = 1;  // Major version
+  prefix[7] = 0;  // Minor version
+  prefix[8] = (unsigned char)(length & 0xFF);
+  prefix[9] = (unsigned char)(length >> 8);
+
+  FILE* file = fopen(filename, "wb");
+  if (file == NULL) {
+    return CANNOT_OPEN_FILE;
+  }
+
+  size_t count = (size_t)matrix->width * matrix->height;
+  int failed = fwrite(prefix, 1, sizeof(prefix), file) != sizeof(prefix) ||
+               fwrite(header, 1, (size_t)length, file) != (size_t)length ||
+               fwrite(matrix->data, typeSize, count, file) != count;
+  if (fclose(file) != 0) {
+    failed = 1;
+  }
+
+  return failed ? FILE_WRITE_ERROR : SUCCESS;
+}
+
+/**
+ * @struct MatrixFileTracker
+ * @brief Remembers a hash of each row of a matrix file.
+ */
+struct MatrixFileTracker {
+  char* filename;       // Copy of the name of the tracked file
+  int width;            // Number of values in each row
+  int rowCount;         // Number of rows in the last load
+  uint64_t* rowHashes;  // Hash of the bytes of each row in the last load
+  int* changedRows;     // Rows changed by the last reload
+  int changedCount;     // Number of rows in `changedRows`
+};
+
+/**
+ * @struct FileRows
+ * @brief Rows of a matrix file found by `ScanFileRows`.
+ */
+typedef struct FileRows {
+  int count;           // Number of rows
+  int capacity;        // Number of rows that fit in the arrays
+  uint64_t* hashes;    // Hash of the bytes of each row
+  const char** lines;  // First byte of each row
+  size_t* lengths;     // Number of bytes of each row
+} FileRows;
+
+/**
+ *  @brief  Hashes the bytes of a line with FNV-1a.
+ *  @param  line     - The line.
+ *  @param  length   - Number of bytes in the line.
+ *  @param  hasDigit - Variable that will hold 1 if the line has a digit.
+ *  @retval The hash of the line.
+ */
+static uint64_t HashLine(const char* line, size_t length, int* hasDigit) {
+  uint64_t hash = ROW_HASH_OFFSET_BASIS;
+  int digit = 0;
+  for (size_t i = 0; i < length; i++) {
+    unsigned char c = (unsigned char)line[i];
+    digit |= c >= '0' && c <= '9';
+    hash = (hash ^ c) * ROW_HASH_PRIME;
+  }
+  *hasDigit = digit;
+  return hash;
+}
+
+/**
+ *  @brief  Finds and hashes the rows of the text of a matrix file. Lines
+ *          without digits hold no values and are not rows.
+ *  @param  text   - The text of the file.
+ *  @param  length - Number of bytes in the text.
+ *  @param  rows   - The rows found.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+static int ScanFileRows(const char* text, size_t length, FileRows* rows) {
+  const char* cursor = text;
+  const char* end = text + length;
+
+  while (cursor < end) {
+    const char* newline = memchr(cursor, '\n', (size_t)(end - cursor));
+    size_t lineLength =
+        newline != NULL ? (size_t)(newline - cursor) : (size_t)(end - cursor);
+
+    int hasDigit;
+    uint64_t hash = HashLine(cursor, lineLength, &hasDigit);
+    if (hasDigit) {
+      if (rows->count == rows->capacity) {
+        int capacity = rows->capacity > 0 ? rows->capacity * 2 : 1024;
+        uint64_t* hashes =
+            realloc(rows->hashes, (size_t)capacity * sizeof(uint64_t));
+        if (hashes != NULL) {
+          rows->hashes = hashes;
+        }
+        const char** lines =
+            realloc((void*)rows->lines, (size_t)capacity * sizeof(char*));
+        if (lines != NULL) {
+          rows->lines = lines;
+        }
+        size_t* lengths =
+            realloc(rows->lengths, (size_t)capacity * sizeof(size_t));
+        if (lengths != NULL) {
+          rows->lengths = lengths;
+        }
+        if (hashes == NULL || lines == NULL || lengths == NULL) {
+          return MEMORY_ALLOCATION_FAILURE;
+        }
+        rows->capacity = capacity;
+      }
+      rows->hashes[rows->count] = hash;
+      rows->lines[rows->count] = cursor;
+      rows->lengths[rows->count] = lineLength;
+      rows->count++;
+    }
+
+    cursor += lineLength + 1;
+  }
+
+  return SUCCESS;
+}
+
+/**
+ *  @brief Frees the arrays of the rows found by `ScanFileRows`.
+ *  @param rows - The rows.
+ */
+static void FreeFileRows(FileRows* rows) {
+  free(rows->hashes);
+  free((void*)rows->lines);
+  free(rows->lengths);
+}
+
+/**
+ *  @brief  Parses the values of one row, with the same rules as
+ *          `CreateMatrixFromFileAsync`.
+ *  @param  line   - The row.
+ *  @param  length - Number of bytes in the row.
+ *  @param  values - Array that will hold the values.
+ *  @param  width  - Maximum number of values.
+ *  @retval The number of values in the row, or -1 if there are more than
+ *          `width` or a value is malformed.
+ */
+static int ParseRowValues(const char* line, size_t length, int* values,
+                          int width) {
+  int count = 0;
+  ValueScanner scanner = {0};
+
+  for (size_t i = 0; i <= length; i++) {
+    char c = i < length ? line[i] : ELEMENT_SEPARATOR[0];
+    if (c != ELEMENT_SEPARATOR[0]) {
+      if (ScanValueChar(&scanner, c) != SUCCESS) {
+        return -1;
+      }
+      continue;
+    }
+
+    int value;
+    int hasValue;
+    if (EndValue(&scanner, &value, &hasValue) != SUCCESS) {
+      return -1;
+    }
+    if (hasValue) {
+      if (count == width) {
+        return -1;
+      }
+      values[count++] = value;
+    }
+  }
+
+  return count;
+}
+
+/**
+ *  @brief  Creates an unlinked row node with the given values.
+ *  @param  values - The values of the row.
+ *  @param  width  - Number of values.
+ *  @retval The new row node, or NULL in case of memory allocation error.
+ */
+static MatrixRowNode* CreateRowFromValues(const int* values, int width) {
+  MatrixRowNode* rowNode = malloc(sizeof(MatrixRowNode));
+  if (rowNode == NULL) {
+    return NULL;
+  }
+  rowNode->row = NULL;
+  rowNode->nextRow = NULL;
+
+  MatrixElement* lastElement = NULL;
+  for (int col = 0; col < width; col++) {
+    MatrixElement* element = CreateMatrixElement(values[col], col);
+    if (element == NULL) {
+      while (rowNode->row != NULL) {
+        MatrixElement* temp = rowNode->row;
+        rowNode->row = temp->nextCol;
+        free(temp);
+      }
+      free(rowNode);
+      return NULL;
+    }
+    if (lastElement == NULL) {
+      rowNode->row = element;
+    } else {
+      lastElement->nextCol = element;
+    }
+    lastElement = element;
+  }
+
+  return rowNode;
+}
+
+/**
+ *  @brief Frees a chain of row nodes linked by `nextRow`.
+ *  @param rowNode - The first row node.
+ */
+static void FreeRowChain(MatrixRowNode* rowNode) {
+  while (rowNode != NULL) {
+    MatrixRowNode* nextRow = rowNode->nextRow;
+    MatrixElement* element = rowNode->row;
+    while (element != NULL) {
+      MatrixElement* temp = element;
+      element = element->nextCol;
+      free(temp);
+    }
+    free(rowNode);
+    rowNode = nextRow;
+  }
+}
+
+/**
+ *  @brief  Parses rows of a file into a chain of new row nodes.
+ *  @param  rows  - The rows of the file.
+ *  @param  first - Index of the first row to parse.
+ *  @param  width - Number of values each row must have.
+ *  @param  chain - Variable that will point to the first new row node, or
+ *                  NULL if there are no rows to parse.
+ *  @param  tail  - Variable that will point to the last new row node.
+ *  @retval `FILE_READ_ERROR`           - A row has a different width.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+static int ParseRowChain(const FileRows* rows, int first, int width,
+                         MatrixRowNode** chain, MatrixRowNode** tail) {
+  *chain = NULL;
+  *tail = NULL;
+  if (first >= rows->count) {
+    return SUCCESS;
+  }
+
+  int* values = malloc((size_t)width * sizeof(int));
+  if (values == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  int status = SUCCESS;
+  for (int i = first; i < rows->count; i++) {
+    if (ParseRowValues(rows->lines[i], rows->lengths[i], values, width) !=
+        width) {
+      status = FILE_READ_ERROR;
+      break;
+    }
+    MatrixRowNode* rowNode = CreateRowFromValues(values, width);
+    if (rowNode == NULL) {
+      status = MEMORY_ALLOCATION_FAILURE;
+      break;
+    }
+    if (*tail == NULL) {
+      *chain = rowNode;
+    } else {
+      (*tail)->nextRow = rowNode;
+    }
+    *tail = rowNode;
+  }
+  free(values);
+
+  if (status != SUCCESS) {
+    FreeRowChain(*chain);
+    *chain = NULL;
+    *tail = NULL;
+  }
+  return status;
+}
+
+/**
+ *  @brief  Creates a matrix from a file and starts tracking the file.
+ *  @details Lines without values are ignored and every other line must
+ *           hold as many values as the first one, as in
+ *           `CreateMatrixFromFileAsync`. `CreateMatrixFromFile` differs: it
+ *           counts every line as a row, even one without values.
+ *  @param  filename - The name of the file.
+ *  @param  matrix   - Matrix that will contain the data of the file.
+ *  @param  tracker  - Tracker to pass to `ReloadMatrixFromFile`.
+ *  @retval `NULL_POINTER`              - A parameter is NULL.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file,
+ *                                        empty file, rows with different
+ *                                        sizes or malformed values.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateMatrixFromFileTracked(const char* filename, Matrix** matrix,
+                                MatrixFileTracker** tracker) {
+  if (filename == NULL || matrix == NULL || tracker == NULL) {
+    return NULL_POINTER;
+  }
+
+  char* text = NULL;
+  size_t length = 0;
+  int status = ReadTextFile(filename, &text, &length);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  FileRows rows = {0};
+  status = ScanFileRows(text, length, &rows);
+
+  // The width is the number of values in the first row
+  int width = 0;
+  if (status == SUCCESS && rows.count == 0) {
+    status = FILE_READ_ERROR;
+  }
+  if (status == SUCCESS) {
+    for (size_t i = 0; i < rows.lengths[0]; i++) {
+      width += rows.lines[0][i] == ELEMENT_SEPARATOR[0];
+    }
+    width++;
+  }
+
+  MatrixRowNode* head = NULL;
+  MatrixRowNode* tail = NULL;
+  if (status == SUCCESS) {
+    // Separators may surround empty values, so count the values themselves
+    int* values = malloc((size_t)width * sizeof(int));
+    if (values == NULL) {
+      status = MEMORY_ALLOCATION_FAILURE;
+    } else {
+      width = ParseRowValues(rows.lines[0], rows.lengths[0], values, width);
+      free(values);
+      status = width < 0 ? FILE_READ_ERROR
+                         : ParseRowChain(&rows, 0, width, &head, &tail);
+    }
+  }
+  free(text);
+
+  Matrix* newMatrix = NULL;
+  MatrixFileTracker* newTracker = NULL;
+  if (status == SUCCESS) {
+    newMatrix = malloc(sizeof(Matrix));
+    newTracker = malloc(sizeof(MatrixFileTracker));
+    char* name = malloc(strlen(filename) + 1);
+    if (newMatrix == NULL || newTracker == NULL || name == NULL) {
+      free(newMatrix);
+      free(newTracker);
+      free(name);
+      status = MEMORY_ALLOCATION_FAILURE;
+    } else {
+      strcpy(name, filename);
+      newTracker->filename = name;
+    }
+  }
+
+  if (status != SUCCESS) {
+    FreeRowChain(head);
+    FreeFileRows(&rows);
+    return status;
+  }
+
+  newMatrix->head = head;
+  newMatrix->width = width;
+  newMatrix->height = rows.count;
+
+  // The tracker keeps the hashes; the rest of the scan is not needed
+  newTracker->width = width;
+  newTracker->rowCount = rows.count;
+  newTracker->rowHashes = rows.hashes;
+  newTracker->changedRows = NULL;
+  newTracker->changedCount = 0;
+  rows.hashes = NULL;
+  FreeFileRows(&rows);
+
+  *matrix = newMatrix;
+  *tracker = newTracker;
+  return SUCCESS;
+}
+
+/**
+ *  @brief  Reloads a tracked file, updating only the rows that changed.
+ *  @details Each row of the file is hashed and compared with the hash from
+ *           the previous load; only rows with a different hash are parsed,
+ *           and their values are replaced in place. Rows added at the end of
+ *           the file are appended to the matrix and rows removed from the
+ *           end are deleted. If the file cannot be used the matrix is left
+ *           unchanged.
+ *  @param  tracker      - Tracker created by `CreateMatrixFromFileTracked`.
+ *  @param  matrix       - The matrix created with the tracker.
+ *  @param  changedRows  - Variable that will point to the indices of the
+ *                         changed, added and removed rows, in increasing
+ *                         order. The array belongs to the tracker and stays
+ *                         valid until the next reload. May be NULL.
+ *  @param  changedCount - Variable that will hold the number of changed
+ *                         rows.
+ *  @retval `NULL_POINTER`              - A parameter is NULL.
+ *  @retval `INVALID_MATRIX_OR_INDICES` - The matrix does not match the
+ *                                        tracker.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file,
+ *                                        empty file, rows with a width
+ *                                        different from the matrix or
+ *                                        malformed values.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+int ReloadMatrixFromFile(MatrixFileTracker* tracker, Matrix* matrix,
+                         const int** changedRows, int* changedCount) {
+  if (tracker == NULL || matrix == NULL || changedCount == NULL) {
+    return NULL_POINTER;
+  }
+  if (matrix->width != tracker->width ||
+      matrix->height != tracker->rowCount) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  char* text = NULL;
+  size_t length = 0;
+  int status = ReadTextFile(tracker->filename, &text, &length);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  FileRows rows = {0};
+  status = ScanFileRows(text, length, &rows);
+  if (status == SUCCESS && rows.count == 0) {
+    status = FILE_READ_ERROR;
+  }
+
+  // Rows present in both loads are changed when their hash differs; rows
+  // added or removed at the end are always changed
+  int keptCount =
+      rows.count < tracker->rowCount ? rows.count : tracker->rowCount;
+  int totalCount =
+      rows.count > tracker->rowCount ? rows.count : tracker->rowCount;
+  int* changed = NULL;
+  int* values = NULL;
+  int changedKept = 0;
+  if (status == SUCCESS) {
+    changed = malloc((size_t)totalCount * sizeof(int));
+    if (changed == NULL) {
+      status = MEMORY_ALLOCATION_FAILURE;
+    }
+  }
+  if (status == SUCCESS) {
+    for (int i = 0; i < keptCount; i++) {
+      if (rows.hashes[i] != tracker->rowHashes[i]) {
+        changed[changedKept++] = i;
+      }
+    }
+
+    // Parse the changed rows before touching the matrix, so a bad file
+    // leaves it as it was
+    values = malloc(((size_t)changedKept + 1) * tracker->width * sizeof(int));
+    if (values == NULL) {
+      status = MEMORY_ALLOCATION_FAILURE;
+    }
+    for (int i = 0; i < changedKept && status == SUCCESS; i++) {
+      int row = changed[i];
+      if (ParseRowValues(rows.lines[row], rows.lengths[row],
+                         values + (size_t)i * tracker->width,
+                         tracker->width) != tracker->width) {
+        status = FILE_READ_ERROR;
+      }
+    }
+  }
+
+  MatrixRowNode* addedHead = NULL;
+  MatrixRowNode* addedTail = NULL;
+  if (status == SUCCESS) {
+    status = ParseRowChain(&rows, keptCount, tracker->width, &addedHead,
+                           &addedTail);
+  }
+  free(text);
+
+  if (status != SUCCESS) {
+    free(changed);
+    free(values);
+    FreeFileRows(&rows);
+    return status;
+  }
+
+  // Replace the values of the changed rows in one walk over the matrix
+  MatrixRowNode* rowNode = matrix->head;
+  MatrixRowNode* lastKept = NULL;
+  int next = 0;
+  for (int row = 0; row < keptCount; row++) {
+    if (next < changedKept && changed[next] == row) {
+      const int* rowValues = values + (size_t)next * tracker->width;
+      MatrixElement* element = rowNode->row;
+      for (int col = 0; col < tracker->width && element != NULL; col++) {
+        element->value = rowValues[col];
+        element = element->nextCol;
+      }
+      next++;
+    }
+    lastKept = rowNode;
+    rowNode = rowNode->nextRow;
+  }
+
+  // `rowNode` is now the first removed row, if any
+  FreeRowChain(rowNode);
+  lastKept->nextRow = addedHead;
+  matrix->height = rows.count;
+
+  int count = changedKept;
+  for (int row = keptCount; row < totalCount; row++) {
+    changed[count++] = row;
+  }
+
+  free(values);
+  free(tracker->changedRows);
+  free(tracker->rowHashes);
+  tracker->changedRows = changed;
+  tracker->changedCount = count;
+  tracker->rowHashes = rows.hashes;
+  tracker->rowCount = rows.count;
+  rows.hashes = NULL;
+  FreeFileRows(&rows);
+
+  if (changedRows != NULL) {
+    *changedRows = changed;
+  }
+  *changedCount = count;
+  return SUCCESS;
+}
+
+/**
+ *  @brief Frees a file tracker. The matrix is not freed.
+ *  @param tracker - The tracker.
+ */
+void FreeMatrixFileTracker(MatrixFileTracker* tracker) {
+  if (tracker == NULL) {
+    return;
+  }
+
+  free(tracker->filename);
+  free(tracker->rowHashes);
+  free(tracker->changedRows);
+  free(tracker);
+}
+
+/**
+ * @struct ReductionTask
+ * @brief Chunk of a matrix file parsed and reduced by one thread.
+ */
+typedef struct ReductionTask {
+  const char* start;         // First byte of the chunk
+  const char* end;           // Byte after the last byte of the chunk
+  int width;                 // Number of values in each row
+  MatrixRowNode* head;       // First row parsed
+  MatrixRowNode* tail;       // Last row parsed
+  int rowCount;              // Number of rows parsed
+  int rowCapacity;           // Number of rows that fit in `rowMin` and `rowMax`
+  int* rowMin;               // Smallest value of each row
+  int* rowMax;               // Largest value of each row
+  int* colMin;               // Smallest value of each column in the chunk
+  int* colMax;               // Largest value of each column in the chunk
+  long long* reducedColMin;  // Column minima of `rowMax[i] - a[i][j]`
+  int status;                // Result of the task
+} ReductionTask;
+
+/**
+ *  @brief  Parses the rows of a chunk, reducing each row right after it is
+ *          parsed.
+ *  @param  task - The chunk.
+ *  @retval `FILE_READ_ERROR`           - Row with a different width.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+static int ParseReductionChunk(ReductionTask* task) {
+  int width = task->width;
+  int* values = malloc((size_t)width * sizeof(int));
+  if (values == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  int status = SUCCESS;
+  const char* cursor = task->start;
+  while (cursor < task->end && status == SUCCESS) {
+    const char* newline = memchr(cursor, '\n', (size_t)(task->end - cursor));
+    const char* lineEnd = newline != NULL ? newline : task->end;
+    int count = ParseRowValues(cursor, (size_t)(lineEnd - cursor), values,
+                               width);
+    cursor = lineEnd + 1;
+    if (count == 0) {
+      continue;  // Line without values
+    }
+    if (count != width) {
+      status = FILE_READ_ERROR;
+      break;
+    }
+
+    if (task->rowCount == task->rowCapacity) {
+      int capacity = task->rowCapacity > 0 ? task->rowCapacity * 2 : 256;
+      int* rowMin = realloc(task->rowMin, (size_t)capacity * sizeof(int));
+      if (rowMin != NULL) {
+        task->rowMin = rowMin;
+      }
+      int* rowMax = realloc(task->rowMax, (size_t)capacity * sizeof(int));
+      if (rowMax != NULL) {
+        task->rowMax = rowMax;
+      }
+      if (rowMin == NULL || rowMax == NULL) {
+        status = MEMORY_ALLOCATION_FAILURE;
+        break;
+      }
+      task->rowCapacity = capacity;
+    }
+
+    // Reduce the row while its values are in cache
+    int minValue = values[0];
+    int maxValue = values[0];
+    for (int col = 0; col < width; col++) {
+      int value = values[col];
+      minValue = value < minValue ? value : minValue;
+      maxValue = value > maxValue ? value : maxValue;
+      if (value < task->colMin[col]) {
+        task->colMin[col] = value;
+      }
+      if (value > task->colMax[col]) {
+        task->colMax[col] = value;
+      }
+    }
+    for (int col = 0; col < width; col++) {
+      // The difference of two `int` values may not fit in an `int`
+      long long reduced = (long long)maxValue - values[col];
+      if (reduced < task->reducedColMin[col]) {
+        task->reducedColMin[col] = reduced;
+      }
+    }
+    task->rowMin[task->rowCount] = minValue;
+    task->rowMax[task->rowCount] = maxValue;
+    task->rowCount++;
+
+    MatrixRowNode* rowNode = CreateRowFromValues(values, width);
+    if (rowNode == NULL) {
+      status = MEMORY_ALLOCATION_FAILURE;
+      break;
+    }
+    if (task->tail == NULL) {
+      task->head = rowNode;
+    } else {
+      task->tail->nextRow = rowNode;
+    }
+    task->tail = rowNode;
+  }
+
+  free(values);
+  return status;
+}
+
+/**
+ *  @brief Thread function that parses and reduces one chunk.
+ *  @param argument - The `ReductionTask` of the chunk.
+ */
+static void ReductionThread(void* argument) {
+  ReductionTask* task = argument;
+  task->status = ParseReductionChunk(task);
+}
+
+/**
+ *  @brief  Creates the reductions of a matrix with empty column extremes.
+ *  @param  width  - Number of columns.
+ *  @param  height - Number of rows.
+ *  @retval The reductions, or NULL in case of memory allocation error.
+ */
+static MatrixReductions* CreateMatrixReductions(int width, int height) {
+  MatrixReductions* reductions = malloc(sizeof(MatrixReductions));
+  if (reductions == NULL) {
+    return NULL;
+  }
+  reductions->width = width;
+  reductions->height = height;
+  reductions->rowMin = malloc((size_t)height * sizeof(int));
+  reductions->rowMax = malloc((size_t)height * sizeof(int));
+  reductions->colMin = malloc((size_t)width * sizeof(int));
+  reductions->colMax = malloc((size_t)width * sizeof(int));
+  reductions->reducedColMin = malloc((size_t)width * sizeof(long long));
+  if (reductions->rowMin == NULL || reductions->rowMax == NULL ||
+      reductions->colMin == NULL || reductions->colMax == NULL ||
+      reductions->reducedColMin == NULL) {
+    FreeMatrixReductions(reductions);
+    return NULL;
+  }
+
+  for (int col = 0; col < width; col++) {
+    reductions->colMin[col] = INT_MAX;
+    reductions->colMax[col] = INT_MIN;
+    reductions->reducedColMin[col] = LLONG_MAX;
+  }
+  reductions->globalMin = INT_MAX;
+  reductions->globalMax = INT_MIN;
+  return reductions;
+}
+
+/**
+ *  @brief  Creates a matrix from a file, computing its reductions while the
+ *          rows are parsed.
+ *  @details The text is split into chunks at line boundaries and each chunk
+ *           is parsed by its own thread. Every row is reduced as soon as it
+ *           is parsed, while its values are still in cache, and the partial
+ *           column results of the threads are merged at the end. Lines
+ *           without values are ignored and every other line must hold as
+ *           many values as the first one, as in `CreateMatrixFromFileAsync`.
+ *           `CreateMatrixFromFile` differs: it counts every line as a row,
+ *           even one without values.
+ *  @param  filename    - The name of the file.
+ *  @param  threadCount - Number of threads used to parse the file.
+ *  @param  matrix      - Matrix that will contain the data of the file.
+ *  @param  reductions  - Reductions of the matrix; free them with
+ *                        `FreeMatrixReductions`.
+ *  @retval `NULL_POINTER`              - A parameter is NULL.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file,
+ *                                        empty file, rows with different
+ *                                        sizes or malformed values.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateMatrixFromFileWithReductions(const char* filename, int threadCount,
+                                       Matrix** matrix,
+                                       MatrixReductions** reductions) {
+  if (filename == NULL || matrix == NULL || reductions == NULL) {
+    return NULL_POINTER;
+  }
+
+  char* text = NULL;
+  size_t length = 0;
+  int status = ReadTextFile(filename, &text, &length);
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  // The width is the number of values in the first line that has any
+  int width = 0;
+  const char* cursor = text;
+  const char* end = text + length;
+  while (cursor < end && width == 0) {
+    const char* newline = memchr(cursor, '\n', (size_t)(end - cursor));
+    const char* lineEnd = newline != NULL ? newline : end;
+    int separators = 0;
+    for (const char* c = cursor; c < lineEnd; c++) {
+      separators += *c == ELEMENT_SEPARATOR[0];
+    }
+    int* values = malloc(((size_t)separators + 1) * sizeof(int));
+    if (values == NULL) {
+      free(text);
+      return MEMORY_ALLOCATION_FAILURE;
+    }
+    width = ParseRowValues(cursor, (size_t)(lineEnd - cursor), values,
+                           separators + 1);
+    free(values);
+    cursor = lineEnd + 1;
+  }
+  if (width <= 0) {
+    free(text);
+    return FILE_READ_ERROR;
+  }
+
+  // Small files are not worth the threads
+  size_t maxThreads = length / PARALLEL_PARSE_MIN_BYTES + 1;
+  if (threadCount < 1) {
+    threadCount = 1;
+  }
+  if ((size_t)threadCount > maxThreads) {
+    threadCount = (int)maxThreads;
+  }
+
+  ReductionTask* tasks = calloc((size_t)threadCount, sizeof(ReductionTask));
+  ThreadHandle* threads = malloc((size_t)threadCount * sizeof(ThreadHandle));
+  int* started = calloc((size_t)threadCount, sizeof(int));
+  if (tasks == NULL || threads == NULL || started == NULL) {
+    free(tasks);
+    free(threads);
+    free(started);
+    free(text);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  // Cut the text after the first newline past each share of bytes
+  const char* chunkStart = text;
+  for (int t = 0; t < threadCount; t++) {
+    const char* chunkEnd = end;
+    if (t < threadCount - 1) {
+      chunkEnd = text + length / threadCount * (t + 1);
+      chunkEnd = chunkEnd < chunkStart ? chunkStart : chunkEnd;
+      const char* newline =
+          memchr(chunkEnd, '\n', (size_t)(end - chunkEnd));
+      chunkEnd = newline != NULL ? newline + 1 : end;
+    }
+    ReductionTask* task = &tasks[t];
+    task->start = chunkStart;
+    task->end = chunkEnd;
+    task->width = width;
+    task->colMin = malloc((size_t)width * sizeof(int));
+    task->colMax = malloc((size_t)width * sizeof(int));
+    task->reducedColMin = malloc((size_t)width * sizeof(long long));
+    if (task->colMin == NULL || task->colMax == NULL ||
+        task->reducedColMin == NULL) {
+      status = MEMORY_ALLOCATION_FAILURE;
+    } else {
+      for (int col = 0; col < width; col++) {
+        task->colMin[col] = INT_MAX;
+        task->colMax[col] = INT_MIN;
+        task->reducedColMin[col] = LLONG_MAX;
+      }
+    }
+    chunkStart = chunkEnd;
+  }
+
+  // The calling thread parses the first chunk; the others get a new thread
+  // each, or are parsed here if the thread cannot be created
+  if (status == SUCCESS) {
+    for (int t = 1; t < threadCount; t++) {
+      started[t] =
+          StartThread(&threads[t], ReductionThread, &tasks[t]) == SUCCESS;
+    }
+    ReductionThread(&tasks[0]);
+    for (int t = 1; t < threadCount; t++) {
+      if (started[t]) {
+        JoinThread(threads[t]);
+      } else {
+        ReductionThread(&tasks[t]);
+      }
+    }
+  }
+  free(text);
+
+  // Merge the chunks in order
+  int height = 0;
+  for (int t = 0; t < threadCount && status == SUCCESS; t++) {
+    status = tasks[t].status;
+    height += tasks[t].rowCount;
+  }
+
+  Matrix* newMatrix = NULL;
+  MatrixReductions* newReductions = NULL;
+  if (status == SUCCESS) {
+    newMatrix = malloc(sizeof(Matrix));
+    newReductions = CreateMatrixReductions(width, height);
+    if (newMatrix == NULL || newReductions == NULL) {
+      free(newMatrix);
+      FreeMatrixReductions(newReductions);
+      newMatrix = NULL;
+      status = MEMORY_ALLOCATION_FAILURE;
+    }
+  }
+
+  if (status == SUCCESS) {
+    newMatrix->head = NULL;
+    newMatrix->width = width;
+    newMatrix->height = height;
+
+    MatrixRowNode* tail = NULL;
+    int row = 0;
+    for (int t = 0; t < threadCount; t++) {
+      ReductionTask* task = &tasks[t];
+      if (task->head != NULL) {
+        if (tail == NULL) {
+          newMatrix->head = task->head;
+        } else {
+          tail->nextRow = task->head;
+        }
+        tail = task->tail;
+        task->head = NULL;
+      }
+
+      for (int i = 0; i < task->rowCount; i++, row++) {
+        newReductions->rowMin[row] = task->rowMin[i];
+        newReductions->rowMax[row] = task->rowMax[i];
+        if (task->rowMin[i] < newReductions->globalMin) {
+          newReductions->globalMin = task->rowMin[i];
+        }
+        if (task->rowMax[i] > newReductions->globalMax) {
+          newReductions->globalMax = task->rowMax[i];
+        }
+      }
+      for (int col = 0; col < width; col++) {
+        if (task->colMin[col] < newReductions->colMin[col]) {
+          newReductions->colMin[col] = task->colMin[col];
+        }
+        if (task->colMax[col] > newReductions->colMax[col]) {
+          newReductions->colMax[col] = task->colMax[col];
+        }
+        if (task->reducedColMin[col] < newReductions->reducedColMin[col]) {
+          newReductions->reducedColMin[col] = task->reducedColMin[col];
+        }
+      }
+    }
+  }
+
+  for (int t = 0; t < threadCount; t++) {
+    FreeRowChain(tasks[t].head);
+    free(tasks[t].rowMin);
+    free(tasks[t].rowMax);
+    free(tasks[t].colMin);
+    free(tasks[t].colMax);
+    free(tasks[t].reducedColMin);
+  }
+  free(tasks);
+  free(threads);
+  free(started);
+
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  *matrix = newMatrix;
+  *reductions = newReductions;
+  return SUCCESS;
+}
+
+/**
+ *  @brief Free allocated memory of matrix reductions.
+ *  @param reductions - The reductions to be freed.
+ */
+void FreeMatrixReductions(MatrixReductions* reductions) {
+  if (reductions == NULL) {
+    return;
+  }
+
+  free(reductions->rowMin);
+  free(reductions->rowMax);
+  free(reductions->colMin);
+  free(reductions->colMax);
+  free(reductions->reducedColMin);
+  free(reductions);
 }
@@ -11,14 +11,88 @@
 #ifndef MATRIX_IO_H
 #define MATRIX_IO_H
 
+#include <stddef.h>
+
 #include "matrix_core.h"
+#include "matrix_dense.h"
+#include "matrix_sparse.h"
+
+/**
+ * @struct MatrixStats
+ * @brief Summary statistics of a matrix, used instead of printing every
+ *        element of large matrices.
+ */
+typedef struct MatrixStats {
+  int width;               // Number of columns
+  int height;              // Number of rows
+  int minValue;            // Smallest element
+  int maxValue;            // Largest element
+  double mean;             // Average of the elements
+  long long zeroCount;     // Number of elements equal to zero
+  double sparsity;         // Fraction of elements equal to zero
+  size_t memoryFootprint;  // Bytes used by the matrix structures
+} MatrixStats;
+
+/**
+ * @struct MatrixReductions
+ * @brief Row, column and global extremes of a matrix, computed while it is
+ *        parsed, and the reductions the Hungarian algorithm starts from.
+ *
+ * The Hungarian algorithm maximizes by reducing `rowMax[i] - a[i][j]`, so
+ * `reducedColMin[j]` holds the minimum of that value over column `j`.
+ */
+typedef struct MatrixReductions {
+  int width;                 // Number of columns
+  int height;                // Number of rows
+  int* rowMin;               // Smallest value of each row
+  int* rowMax;               // Largest value of each row
+  int* colMin;               // Smallest value of each column
+  int* colMax;               // Largest value of each column
+  long long* reducedColMin;  // Column minima of `rowMax[i] - a[i][j]`
+  int globalMin;             // Smallest value of the matrix
+  int globalMax;             // Largest value of the matrix
+} MatrixReductions;
 
 /**
  *  @brief Displays a matrix on the screen.
+ *  @details Matrices with more than `PRINT_FULL_MAX_ELEMENTS` elements are
+ *           shown with `PrintMatrixPreview` so that an accidental call on a
+ *           large matrix does not flood the terminal.
  *  @param matrix - The matrix to be displayed.
  */
 __declspec(dllexport) void PrintMatrix(const Matrix* matrix);
 
+/**
+ *  @brief Displays the head and tail rows and columns of a matrix, replacing
+ *         the omitted ones with ellipses.
+ *  @details Only the printed rows and columns are formatted, and the walk
+ *           stops after the last of them. Rows and columns are linked lists,
+ *           so reaching the bottom rows still follows every row link, and
+ *           reaching the right columns every element of a printed row: the
+ *           cost is O(height + printed rows * width), not O(printed cells).
+ *  @param matrix   - The matrix to be displayed.
+ *  @param edgeRows - Number of rows to print at the top and at the bottom.
+ *  @param edgeCols - Number of columns to print at the left and at the right.
+ */
+__declspec(dllexport) void PrintMatrixPreview(const Matrix* matrix,
+                                              int edgeRows, int edgeCols);
+
+/**
+ *  @brief  Calculates summary statistics of a matrix.
+ *  @param  matrix - The matrix.
+ *  @param  stats  - Structure that will hold the statistics.
+ *  @retval `NULL_POINTER` - The matrix or `stats` is NULL.
+ *  @retval `SUCCESS`      - Operation successful.
+ */
+__declspec(dllexport) int GetMatrixStats(const Matrix* matrix,
+                                         MatrixStats* stats);
+
+/**
+ *  @brief Displays summary statistics of a matrix instead of its elements.
+ *  @param matrix - The matrix.
+ */
+__declspec(dllexport) void PrintMatrixStats(const Matrix* matrix);
+
 /**
  *  @brief  Obtains the size of a matrix stored in a file.
  *  @param  filename - The name of the file containing the matrix.
@@ -59,6 +133,80 @@ __declspec(dllexport) int PopulateMatrixFromFile(const char* filename,
 __declspec(dllexport) int CreateMatrixFromFile(const char* filename,
                                                Matrix** matrix);
 
+/**
+ * @brief Function called when an asynchronous matrix load finishes.
+ * @param status   - Result of the load, with the same values returned by
+ *                   `WaitMatrixLoad`.
+ * @param matrix   - The loaded matrix, or NULL if the load failed.
+ * @param userData - Pointer given to `CreateMatrixFromFileAsync`.
+ */
+typedef void (*MatrixLoadCallback)(int status, Matrix* matrix,
+                                   void* userData);
+
+/**
+ * @struct MatrixLoadHandle
+ * @brief Handle of an asynchronous matrix load, similar to a future.
+ */
+typedef struct MatrixLoadHandle MatrixLoadHandle;
+
+/**
+ *  @brief  Starts loading a matrix from a file in the background.
+ *  @details A reader thread fills two buffers of `ASYNC_READ_BLOCK_SIZE`
+ *           bytes in turns while a parser thread tokenizes the other one, so
+ *           disk reads overlap with parsing. The file is read only once.
+ *           When the load finishes, `callback` (if any) is called from the
+ *           parser thread. The loaded matrix belongs to the caller, whether
+ *           it is received in the callback or through `WaitMatrixLoad`.
+ *           Each value must be an integer in the range of `int`, with an
+ *           optional minus sign and blanks around it.
+ *  @param  filename - The name of the file.
+ *  @param  callback - Function called when the load finishes, or NULL.
+ *  @param  userData - Pointer passed to `callback`.
+ *  @param  handle   - Handle of the load, or NULL to run it detached (in that
+ *                     case `callback` is required).
+ *  @retval `NULL_POINTER`              - No filename, or neither a handle nor
+ *                                        a callback was provided.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `THREAD_CREATION_FAILURE`   - The loader thread was not created.
+ *  @retval `SUCCESS`                   - The load was started.
+ */
+__declspec(dllexport) int CreateMatrixFromFileAsync(const char* filename,
+                                                    MatrixLoadCallback callback,
+                                                    void* userData,
+                                                    MatrixLoadHandle** handle);
+
+/**
+ *  @brief  Checks whether an asynchronous matrix load has finished.
+ *  @param  handle - Handle of the load.
+ *  @retval 1 if the load has finished, 0 otherwise.
+ */
+__declspec(dllexport) int IsMatrixLoadComplete(MatrixLoadHandle* handle);
+
+/**
+ *  @brief  Waits for an asynchronous matrix load to finish.
+ *  @param  handle - Handle of the load.
+ *  @param  matrix - Matrix that will contain the loaded data, or NULL if the
+ *                   load failed. May be NULL when the matrix was already
+ *                   taken in the callback.
+ *  @retval `NULL_POINTER`              - The handle is NULL.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `THREAD_CREATION_FAILURE`   - The reader thread was not created.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file,
+ *                                        rows with different sizes or
+ *                                        malformed values.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int WaitMatrixLoad(MatrixLoadHandle* handle,
+                                         Matrix** matrix);
+
+/**
+ *  @brief Waits for an asynchronous matrix load to finish and frees its
+ *         handle. The loaded matrix is not freed.
+ *  @param handle - Handle of the load.
+ */
+__declspec(dllexport) void FreeMatrixLoadHandle(MatrixLoadHandle* handle);
+
 /**
  *  @brief  Inserts a row into the matrix.
  *  @param  matrix       - The matrix where we will insert a new row.
@@ -103,4 +251,173 @@ __declspec(dllexport) int DeleteRow(Matrix* matrix, int rowIndex);
  */
 __declspec(dllexport) int DeleteColumn(Matrix* matrix, int colIndex);
 
+/**
+ *  @brief  Creates a sparse matrix from a file of triplets.
+ *  @details Each line holds `row col value`, with 0-based indices separated
+ *           by spaces, tabs, `,` or `;`. Empty lines and lines starting
+ *           with `#` or `%` are ignored. The size of the matrix is given by
+ *           the largest indices. Indices must be whole numbers; finite real
+ *           values are rounded to integers, limited to the range of `int`.
+ *  @param  filename    - The name of the file.
+ *  @param  threadCount - Number of threads used to sort the rows.
+ *  @param  matrix      - Matrix that will contain the data of the file.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file.
+ *  @retval `INVALID_FILE_FORMAT`       - A line is not a valid triplet, or
+ *                                        the file has no triplets.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CreateSparseMatrixFromTripletFile(
+    const char* filename, int threadCount, SparseMatrix** matrix);
+
+/**
+ *  @brief  Creates a sparse matrix from a Matrix Market (`.mtx`) file.
+ *  @details Supports the `coordinate` format with `integer`, `real` or
+ *           `pattern` fields (pattern entries have value 1) and `general`,
+ *           `symmetric` or `skew-symmetric` symmetry. Sizes and indices must
+ *           be whole numbers; finite real values are rounded to integers,
+ *           limited to the range of `int`.
+ *  @param  filename    - The name of the file.
+ *  @param  threadCount - Number of threads used to sort the rows.
+ *  @param  matrix      - Matrix that will contain the data of the file.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file.
+ *  @retval `INVALID_FILE_FORMAT`       - Unsupported or malformed file.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CreateSparseMatrixFromMatrixMarket(
+    const char* filename, int threadCount, SparseMatrix** matrix);
+
+/**
+ *  @brief  Loads a NumPy `.npy` file into a dense matrix without copying.
+ *  @details The file must hold a 2-D, C-order array of little-endian
+ *           `int32`, `int64` or `float64` values. The file is mapped into
+ *           memory and the matrix points straight at its values; changes to
+ *           the matrix are never written back to the file.
+ *  @param  filename - The name of the file.
+ *  @param  matrix   - Matrix that will contain the data of the file.
+ *  @retval `NULL_POINTER`              - No filename or matrix provided.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_READ_ERROR`           - The file cannot be mapped.
+ *  @retval `INVALID_FILE_FORMAT`       - Not a supported `.npy` file.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CreateDenseMatrixFromNpy(const char* filename,
+                                                   DenseMatrix** matrix);
+
+/**
+ *  @brief  Writes a dense matrix to a NumPy `.npy` file.
+ *  @param  filename - The name of the file.
+ *  @param  matrix   - The matrix.
+ *  @retval `NULL_POINTER`              - No filename or matrix provided.
+ *  @retval `INVALID_MATRIX_OR_INDICES` - The matrix is invalid.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_WRITE_ERROR`          - Error writing to the file.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int WriteDenseMatrixToNpy(const char* filename,
+                                                const DenseMatrix* matrix);
+
+/**
+ * @struct MatrixFileTracker
+ * @brief Remembers a hash of each row of a matrix file, so that later
+ *        reloads of the file only parse the rows that changed.
+ */
+typedef struct MatrixFileTracker MatrixFileTracker;
+
+/**
+ *  @brief  Creates a matrix from a file and starts tracking the file.
+ *  @details Lines without values are ignored and every other line must
+ *           hold as many values as the first one, as in
+ *           `CreateMatrixFromFileAsync`. `CreateMatrixFromFile` differs: it
+ *           counts every line as a row, even one without values.
+ *  @param  filename - The name of the file.
+ *  @param  matrix   - Matrix that will contain the data of the file.
+ *  @param  tracker  - Tracker to pass to `ReloadMatrixFromFile`.
+ *  @retval `NULL_POINTER`              - A parameter is NULL.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file,
+ *                                        empty file, rows with different
+ *                                        sizes or malformed values.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CreateMatrixFromFileTracked(
+    const char* filename, Matrix** matrix, MatrixFileTracker** tracker);
+
+/**
+ *  @brief  Reloads a tracked file, updating only the rows that changed.
+ *  @details Each row of the file is hashed and compared with the hash from
+ *           the previous load; only rows with a different hash are parsed,
+ *           and their values are replaced in place. Rows added at the end of
+ *           the file are appended to the matrix and rows removed from the
+ *           end are deleted. If the file cannot be used the matrix is left
+ *           unchanged.
+ *  @param  tracker      - Tracker created by `CreateMatrixFromFileTracked`.
+ *  @param  matrix       - The matrix created with the tracker.
+ *  @param  changedRows  - Variable that will point to the indices of the
+ *                         changed, added and removed rows, in increasing
+ *                         order. The array belongs to the tracker and stays
+ *                         valid until the next reload. May be NULL.
+ *  @param  changedCount - Variable that will hold the number of changed
+ *                         rows.
+ *  @retval `NULL_POINTER`              - A parameter is NULL.
+ *  @retval `INVALID_MATRIX_OR_INDICES` - The matrix does not match the
+ *                                        tracker.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file,
+ *                                        empty file, rows with a width
+ *                                        different from the matrix or
+ *                                        malformed values.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int ReloadMatrixFromFile(MatrixFileTracker* tracker,
+                                               Matrix* matrix,
+                                               const int** changedRows,
+                                               int* changedCount);
+
+/**
+ *  @brief Frees a file tracker. The matrix is not freed.
+ *  @param tracker - The tracker.
+ */
+__declspec(dllexport) void FreeMatrixFileTracker(MatrixFileTracker* tracker);
+
+/**
+ *  @brief  Creates a matrix from a file, computing its reductions while the
+ *          rows are parsed.
+ *  @details The text is split into chunks at line boundaries and each chunk
+ *           is parsed by its own thread. Every row is reduced as soon as it
+ *           is parsed, while its values are still in cache, and the partial
+ *           column results of the threads are merged at the end. Lines
+ *           without values are ignored and every other line must hold as
+ *           many values as the first one, as in `CreateMatrixFromFileAsync`.
+ *           `CreateMatrixFromFile` differs: it counts every line as a row,
+ *           even one without values.
+ *  @param  filename    - The name of the file.
+ *  @param  threadCount - Number of threads used to parse the file.
+ *  @param  matrix      - Matrix that will contain the data of the file.
+ *  @param  reductions  - Reductions of the matrix; free them with
+ *                        `FreeMatrixReductions`.
+ *  @retval `NULL_POINTER`              - A parameter is NULL.
+ *  @retval `CANNOT_OPEN_FILE`          - Failure to open the file.
+ *  @retval `FILE_READ_ERROR`           - Error reading data from the file,
+ *                                        empty file, rows with different
+ *                                        sizes or malformed values.
+ *  @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ *  @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CreateMatrixFromFileWithReductions(
+    const char* filename, int threadCount, Matrix** matrix,
+    MatrixReductions** reductions);
+
+/**
+ *  @brief Free allocated memory of matrix reductions.
+ *  @param reductions - The reductions to be freed.
+ */
+__declspec(dllexport) void FreeMatrixReductions(MatrixReductions* reductions);
+
 #endif  // !MATRIX_IO_H
@@ -0,0 +1,410 @@
+/**
+ *
+ *  @file      matrix_sparse.c
+ *  @brief     Implementation of sparse matrices in compressed sparse row form.
+ *  @details   This file contains the functions that build, query and free
+ *             sparse matrices.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "matrix_sparse.h"
+
+#include <stdlib.h>
+
+#include "error_codes.h"
+#include "platform.h"
+
+// Rows up to this length are sorted with insertion sort
+#define INSERTION_SORT_LIMIT 16
+
+/**
+ * @struct SparseEntry
+ * @brief Column and value of an entry, used to sort long rows.
+ */
+typedef struct SparseEntry {
+  int col;    // Column of the entry
+  int value;  // Value of the entry
+} SparseEntry;
+
+/**
+ * @struct RowSortTask
+ * @brief Range of rows sorted by one thread.
+ */
+typedef struct RowSortTask {
+  SparseMatrix* matrix;  // The matrix
+  int firstRow;          // First row of the range
+  int endRow;            // Row after the last row of the range
+  int status;            // Result of the sort
+} RowSortTask;
+
+/**
+ * @brief  Compares two entries by column, for `qsort`.
+ * @param  first  - The first entry.
+ * @param  second - The second entry.
+ * @retval Negative, zero or positive as the first column is smaller, equal
+ *         or larger than the second.
+ */
+static int CompareEntries(const void* first, const void* second) {
+  int a = ((const SparseEntry*)first)->col;
+  int b = ((const SparseEntry*)second)->col;
+  return (a > b) - (a < b);
+}
+
+/**
+ * @brief Sorts the entries of a range of rows by column.
+ * @param argument - The `RowSortTask` with the range of rows.
+ */
+static void SortRowRange(void* argument) {
+  RowSortTask* task = argument;
+  SparseMatrix* matrix = task->matrix;
+  int* cols = matrix->colIndices;
+  int* values = matrix->values;
+
+  int longestRow = 0;
+  for (int row = task->firstRow; row < task->endRow; row++) {
+    int length = matrix->rowOffsets[row + 1] - matrix->rowOffsets[row];
+    longestRow = length > longestRow ? length : longestRow;
+  }
+
+  SparseEntry* entries = NULL;
+  if (longestRow > INSERTION_SORT_LIMIT) {
+    entries = malloc((size_t)longestRow * sizeof(SparseEntry));
+    if (entries == NULL) {
+      task->status = MEMORY_ALLOCATION_FAILURE;
+      return;
+    }
+  }
+
+  for (int row = task->firstRow; row < task->endRow; row++) {
+    int start = matrix->rowOffsets[row];
+    int length = matrix->rowOffsets[row + 1] - start;
+
+    if (length <= INSERTION_SORT_LIMIT) {
+      for (int i = start + 1; i < start + length; i++) {
+        int col = cols[i];
+        int value = values[i];
+        int j = i - 1;
+        while (j >= start && cols[j] > col) {
+          cols[j + 1] = cols[j];
+          values[j + 1] = values[j];
+          j--;
+        }
+        cols[j + 1] = col;
+        values[j + 1] = value;
+      }
+      continue;
+    }
+
+    for (int i = 0; i < length; i++) {
+      entries[i].col = cols[start + i];
+      entries[i].value = values[start + i];
+    }
+    qsort(entries, (size_t)length, sizeof(SparseEntry), CompareEntries);
+    for (int i = 0; i < length; i++) {
+      cols[start + i] = entries[i].col;
+      values[start + i] = entries[i].value;
+    }
+  }
+
+  free(entries);
+  task->status = SUCCESS;
+}
+
+/**
+ * @brief  Sorts the entries of every row by column, splitting the rows in
+ *         ranges with a similar number of entries, one per thread.
+ * @param  matrix      - The matrix.
+ * @param  threadCount - Number of threads.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int SortRows(SparseMatrix* matrix, int threadCount) {
+  if (threadCount > matrix->height) {
+    threadCount = matrix->height;
+  }
+  if (threadCount <= 1) {
+    RowSortTask task = {matrix, 0, matrix->height, SUCCESS};
+    SortRowRange(&task);
+    return task.status;
+  }
+
+  RowSortTask* tasks = malloc((size_t)threadCount * sizeof(RowSortTask));
+  ThreadHandle* threads = malloc((size_t)threadCount * sizeof(ThreadHandle));
+  int* started = calloc((size_t)threadCount, sizeof(int));
+  if (tasks == NULL || threads == NULL || started == NULL) {
+    free(tasks);
+    free(threads);
+    free(started);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  // Cut the rows where the running number of entries reaches each share
+  int row = 0;
+  for (int t = 0; t < threadCount; t++) {
+    long long target = (long long)matrix->entryCount * (t + 1) / threadCount;
+    tasks[t].matrix = matrix;
+    tasks[t].firstRow = row;
+    while (row < matrix->height &&
+           (t == threadCount - 1 || matrix->rowOffsets[row + 1] <= target)) {
+      row++;
+    }
+    tasks[t].endRow = row;
+    tasks[t].status = SUCCESS;
+  }
+
+  // The calling thread sorts the first range; the others get a new thread
+  // each, or are sorted here if the thread cannot be created
+  for (int t = 1; t < threadCount; t++) {
+    started[t] = StartThread(&threads[t], SortRowRange, &tasks[t]) == SUCCESS;
+  }
+  SortRowRange(&tasks[0]);
+
+  int status = tasks[0].status;
+  for (int t = 1; t < threadCount; t++) {
+    if (started[t]) {
+      JoinThread(threads[t]);
+    } else {
+      SortRowRange(&tasks[t]);
+    }
+    if (tasks[t].status != SUCCESS) {
+      status = tasks[t].status;
+    }
+  }
+
+  free(tasks);
+  free(threads);
+  free(started);
+  return status;
+}
+
+/**
+ * @brief Merges entries of the same cell, keeping the largest value. The
+ *        entries of each row must be sorted by column.
+ * @param matrix - The matrix.
+ */
+static void MergeDuplicates(SparseMatrix* matrix) {
+  int write = 0;
+  int start = 0;
+  for (int row = 0; row < matrix->height; row++) {
+    int end = matrix->rowOffsets[row + 1];
+    matrix->rowOffsets[row] = write;
+    for (int read = start; read < end; read++) {
+      if (write > matrix->rowOffsets[row] &&
+          matrix->colIndices[write - 1] == matrix->colIndices[read]) {
+        if (matrix->values[read] > matrix->values[write - 1]) {
+          matrix->values[write - 1] = matrix->values[read];
+        }
+        continue;
+      }
+      matrix->colIndices[write] = matrix->colIndices[read];
+      matrix->values[write] = matrix->values[read];
+      write++;
+    }
+    start = end;
+  }
+  matrix->rowOffsets[matrix->height] = write;
+  matrix->entryCount = write;
+}
+
+/**
+ * @brief  Creates a sparse matrix from (row, column, value) triplets.
+ * @details The triplets are bucketed by row with a counting sort and then
+ *          sorted by column inside each row. With `threadCount` greater than
+ *          1, the rows are split into ranges of similar size that are sorted
+ *          in parallel. Duplicated cells keep the largest value.
+ * @param  width       - The number of columns of the matrix.
+ * @param  height      - The number of rows of the matrix.
+ * @param  rows        - Row of each triplet.
+ * @param  cols        - Column of each triplet.
+ * @param  values      - Value of each triplet.
+ * @param  count       - Number of triplets.
+ * @param  threadCount - Number of threads used to sort the rows.
+ * @param  matrix      - Matrix that will contain the data.
+ * @retval `INVALID_MATRIX_OR_INDICES` - Invalid sizes or a triplet outside
+ *                                       the matrix.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateSparseMatrixFromTriplets(int width, int height, const int* rows,
+                                   const int* cols, const int* values,
+                                   int count, int threadCount,
+                                   SparseMatrix** matrix) {
+  if (width <= 0 || height <= 0 || count < 0 ||
+      (count > 0 && (rows == NULL || cols == NULL || values == NULL))) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+  for (int i = 0; i < count; i++) {
+    if (rows[i] < 0 || rows[i] >= height || cols[i] < 0 || cols[i] >= width) {
+      return INVALID_MATRIX_OR_INDICES;
+    }
+  }
+
+  SparseMatrix* newMatrix = malloc(sizeof(SparseMatrix));
+  if (newMatrix == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  newMatrix->width = width;
+  newMatrix->height = height;
+  newMatrix->entryCount = count;
+  newMatrix->rowOffsets = calloc((size_t)height + 1, sizeof(int));
+  size_t capacity = count > 0 ? (size_t)count : 1;
+  newMatrix->colIndices = malloc(capacity * sizeof(int));
+  newMatrix->values = malloc(capacity * sizeof(int));
+  int* cursor = malloc((size_t)height * sizeof(int));
+  if (newMatrix->rowOffsets == NULL || newMatrix->colIndices == NULL ||
+      newMatrix->values == NULL || cursor == NULL) {
+    free(cursor);
+    FreeSparseMatrix(newMatrix);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  // Counting sort by row
+  for (int i = 0; i < count; i++) {
+    newMatrix->rowOffsets[rows[i] + 1]++;
+  }
+  for (int row = 0; row < height; row++) {
+    newMatrix->rowOffsets[row + 1] += newMatrix->rowOffsets[row];
+    cursor[row] = newMatrix->rowOffsets[row];
+  }
+  for (int i = 0; i < count; i++) {
+    int position = cursor[rows[i]]++;
+    newMatrix->colIndices[position] = cols[i];
+    newMatrix->values[position] = values[i];
+  }
+  free(cursor);
+
+  int status = SortRows(newMatrix, threadCount);
+  if (status != SUCCESS) {
+    FreeSparseMatrix(newMatrix);
+    return status;
+  }
+  MergeDuplicates(newMatrix);
+
+  *matrix = newMatrix;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Creates a sparse matrix with the cells of a linked-list matrix
+ *         whose value is at least `minValue`.
+ * @details The list is walked twice: once to count the kept cells of each
+ *          row and once to copy them, so no dense copy is made.
+ * @param  source   - The linked-list matrix.
+ * @param  minValue - Smallest value of a cell that is kept.
+ * @param  matrix   - Matrix that will contain the data.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The source matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateSparseMatrixFromMatrix(const Matrix* source, int minValue,
+                                 SparseMatrix** matrix) {
+  if (source == NULL || matrix == NULL || source->width <= 0 ||
+      source->height <= 0) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  SparseMatrix* newMatrix = malloc(sizeof(SparseMatrix));
+  if (newMatrix == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  newMatrix->width = source->width;
+  newMatrix->height = source->height;
+  newMatrix->colIndices = NULL;
+  newMatrix->values = NULL;
+  newMatrix->rowOffsets = calloc((size_t)source->height + 1, sizeof(int));
+  if (newMatrix->rowOffsets == NULL) {
+    FreeSparseMatrix(newMatrix);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  const MatrixRowNode* currentRow = source->head;
+  for (int row = 0; row < source->height && currentRow != NULL; row++) {
+    const MatrixElement* element = currentRow->row;
+    for (int col = 0; col < source->width && element != NULL; col++) {
+      newMatrix->rowOffsets[row + 1] += element->value >= minValue;
+      element = element->nextCol;
+    }
+    currentRow = currentRow->nextRow;
+  }
+  for (int row = 0; row < source->height; row++) {
+    newMatrix->rowOffsets[row + 1] += newMatrix->rowOffsets[row];
+  }
+
+  newMatrix->entryCount = newMatrix->rowOffsets[source->height];
+  size_t capacity =
+      newMatrix->entryCount > 0 ? (size_t)newMatrix->entryCount : 1;
+  newMatrix->colIndices = malloc(capacity * sizeof(int));
+  newMatrix->values = malloc(capacity * sizeof(int));
+  if (newMatrix->colIndices == NULL || newMatrix->values == NULL) {
+    FreeSparseMatrix(newMatrix);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  int position = 0;
+  currentRow = source->head;
+  for (int row = 0; row < source->height && currentRow != NULL; row++) {
+    const MatrixElement* element = currentRow->row;
+    for (int col = 0; col < source->width && element != NULL; col++) {
+      if (element->value >= minValue) {
+        newMatrix->colIndices[position] = col;
+        newMatrix->values[position] = element->value;
+        position++;
+      }
+      element = element->nextCol;
+    }
+    currentRow = currentRow->nextRow;
+  }
+
+  *matrix = newMatrix;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Gets the value of a cell of a sparse matrix.
+ * @param  matrix - The matrix.
+ * @param  row    - The row of the cell.
+ * @param  col    - The column of the cell.
+ * @param  value  - Variable that will hold the value of the cell.
+ * @retval `OUT_OF_BOUNDS` - The cell does not exist.
+ * @retval `SUCCESS`       - Operation successful.
+ */
+int GetSparseValue(const SparseMatrix* matrix, int row, int col, int* value) {
+  if (matrix == NULL || row < 0 || row >= matrix->height) {
+    return OUT_OF_BOUNDS;
+  }
+
+  // Binary search in the sorted columns of the row
+  int low = matrix->rowOffsets[row];
+  int high = matrix->rowOffsets[row + 1] - 1;
+  while (low <= high) {
+    int middle = low + (high - low) / 2;
+    if (matrix->colIndices[middle] == col) {
+      *value = matrix->values[middle];
+      return SUCCESS;
+    }
+    if (matrix->colIndices[middle] < col) {
+      low = middle + 1;
+    } else {
+      high = middle - 1;
+    }
+  }
+
+  return OUT_OF_BOUNDS;
+}
+
+/**
+ * @brief Free allocated memory of a sparse matrix.
+ * @param matrix - The matrix to be freed.
+ */
+void FreeSparseMatrix(SparseMatrix* matrix) {
+  if (matrix == NULL) {
+    return;
+  }
+
+  free(matrix->rowOffsets);
+  free(matrix->colIndices);
+  free(matrix->values);
+  free(matrix);
+}
@@ -0,0 +1,91 @@
+/**
+ *  @file      matrix_sparse.h
+ *  @brief     Header file for sparse matrices in compressed sparse row form.
+ *  @details   This file contains the structure used to hold cost matrices
+ *             where only some cells exist, and the functions to build it
+ *             from (row, column, value) triplets without ever creating a
+ *             dense `Matrix`.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef MATRIX_SPARSE_H
+#define MATRIX_SPARSE_H
+
+#include "matrix_core.h"
+
+/**
+ * @struct SparseMatrix
+ * @brief A matrix in compressed sparse row (CSR) form.
+ *
+ * The entries of row `i` are at positions `rowOffsets[i]` to
+ * `rowOffsets[i + 1] - 1` of `colIndices` and `values`, sorted by column.
+ * Cells without an entry do not exist: they cannot be selected.
+ */
+typedef struct SparseMatrix {
+  int width;        // Number of columns
+  int height;       // Number of rows
+  int entryCount;   // Number of existing cells
+  int* rowOffsets;  // First entry of each row, plus the total at the end
+  int* colIndices;  // Column of each entry
+  int* values;      // Value of each entry
+} SparseMatrix;
+
+/**
+ * @brief  Creates a sparse matrix from (row, column, value) triplets.
+ * @details The triplets are bucketed by row with a counting sort and then
+ *          sorted by column inside each row. With `threadCount` greater than
+ *          1, the rows are split into ranges of similar size that are sorted
+ *          in parallel. Duplicated cells keep the largest value.
+ * @param  width       - The number of columns of the matrix.
+ * @param  height      - The number of rows of the matrix.
+ * @param  rows        - Row of each triplet.
+ * @param  cols        - Column of each triplet.
+ * @param  values      - Value of each triplet.
+ * @param  count       - Number of triplets.
+ * @param  threadCount - Number of threads used to sort the rows.
+ * @param  matrix      - Matrix that will contain the data.
+ * @retval `INVALID_MATRIX_OR_INDICES` - Invalid sizes or a triplet outside
+ *                                       the matrix.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CreateSparseMatrixFromTriplets(
+    int width, int height, const int* rows, const int* cols, const int* values,
+    int count, int threadCount, SparseMatrix** matrix);
+
+/**
+ * @brief  Creates a sparse matrix with the cells of a linked-list matrix
+ *         whose value is at least `minValue`. Matrices that mark forbidden
+ *         cells with a very negative value can be turned into sparse ones
+ *         where those cells do not exist.
+ * @param  source   - The linked-list matrix.
+ * @param  minValue - Smallest value of a cell that is kept.
+ * @param  matrix   - Matrix that will contain the data.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The source matrix is invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CreateSparseMatrixFromMatrix(const Matrix* source,
+                                                       int minValue,
+                                                       SparseMatrix** matrix);
+
+/**
+ * @brief  Gets the value of a cell of a sparse matrix.
+ * @param  matrix - The matrix.
+ * @param  row    - The row of the cell.
+ * @param  col    - The column of the cell.
+ * @param  value  - Variable that will hold the value of the cell.
+ * @retval `OUT_OF_BOUNDS` - The cell does not exist.
+ * @retval `SUCCESS`       - Operation successful.
+ */
+__declspec(dllexport) int GetSparseValue(const SparseMatrix* matrix, int row,
+                                         int col, int* value);
+
+/**
+ * @brief Free allocated memory of a sparse matrix.
+ * @param matrix - The matrix to be freed.
+ */
+__declspec(dllexport) void FreeSparseMatrix(SparseMatrix* matrix);
+
+#endif  // !MATRIX_SPARSE_H
@@ -0,0 +1,540 @@
+/**
+ *
+ *  @file      murty.c
+ *  @brief     Implementation of the enumeration of the k best assignments.
+ *  @details   This file contains Murty's method over the shortest augmenting
+ *             path engine. The problem is the minimization of the negated
+ *             values, with rows as the smaller side, and every subproblem
+ *             reads the same costs: the cells a subproblem excludes are set
+ *             to `HUGE_VAL` while it is solved and restored afterwards, and
+ *             the cells it forces are applied as each row is read.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "murty.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "assignment.h"
+#include "error_codes.h"
+#include "lap_core.h"
+#include "matrix_core.h"
+#include "platform.h"
+
+/**
+ * @struct MurtyNode
+ * @brief A subproblem and its optimal assignment.
+ */
+typedef struct MurtyNode {
+  double value;       // Total of the assignment
+  int* forcedCols;    // Column each row is forced to, or -1
+  int* excludedRows;  // Row of each excluded cell
+  int* excludedCols;  // Column of each excluded cell
+  int excludedCount;  // Number of excluded cells
+  int* rowToCol;      // Column assigned to each row
+  double* v;          // Column potentials of the assignment
+} MurtyNode;
+
+/**
+ * @struct Murty
+ * @brief Costs, engine and priority queue of an enumeration.
+ */
+typedef struct Murty {
+  int rows;                 // Number of rows, the smaller side
+  int cols;                 // Number of columns
+  double* costs;            // Cost of row `i` and column `j` at `i * cols + j`
+  const int* forcedCols;    // Forced columns of the subproblem being solved
+  int* forcedRows;          // Row forced to each column, or -1
+  int forcedCount;          // Number of forced cells being applied
+  double* savedCosts;       // Costs of the cells excluded while solving
+  LapWorkspace* workspace;  // Scratch memory of the engine
+  LapState* state;          // Assignment and potentials of the engine
+  MurtyNode** queue;        // Binary heap of subproblems, best total first
+  int queueSize;            // Number of subproblems in `queue`
+  int queueCapacity;        // Number of subproblems that fit in `queue`
+} Murty;
+
+/**
+ * @brief  Gets a row of the subproblem being solved, for `LapCost`: a
+ *         forced row keeps only its forced cell, and the other rows lose
+ *         the forced columns.
+ * @param  context - The `Murty`.
+ * @param  row     - The row.
+ * @param  buffer  - Array that may be filled with the costs.
+ * @retval Pointer to the costs of the row.
+ */
+static const double* GetMurtyRow(void* context, int row, double* buffer) {
+  const Murty* murty = context;
+  const double* costs = murty->costs + (size_t)row * murty->cols;
+  int forced = murty->forcedCols[row];
+  if (forced >= 0) {
+    for (int j = 0; j < murty->cols; j++) {
+      buffer[j] = HUGE_VAL;
+    }
+    buffer[forced] = costs[forced];
+    return buffer;
+  }
+  if (murty->forcedCount == 0) {
+    return costs;
+  }
+
+  for (int j = 0; j < murty->cols; j++) {
+    buffer[j] = murty->forcedRows[j] < 0 ? costs[j] : HUGE_VAL;
+  }
+  return buffer;
+}
+
+/**
+ * @brief Frees a subproblem.
+ * @param node - The subproblem.
+ */
+static void FreeMurtyNode(MurtyNode* node) {
+  if (node == NULL) {
+    return;
+  }
+
+  free(node->forcedCols);
+  free(node->excludedRows);
+  free(node->excludedCols);
+  free(node->rowToCol);
+  free(node->v);
+  free(node);
+}
+
+/**
+ * @brief  Creates a subproblem without an assignment yet.
+ * @param  murty         - The enumeration.
+ * @param  forcedCols    - Column each row is forced to, or -1.
+ * @param  excludedCount - Number of excluded cells.
+ * @param  node          - The new subproblem.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int CreateMurtyNode(const Murty* murty, const int* forcedCols,
+                           int excludedCount, MurtyNode** node) {
+  MurtyNode* newNode = calloc(1, sizeof(MurtyNode));
+  if (newNode == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  size_t excluded = excludedCount > 0 ? (size_t)excludedCount : 1;
+  newNode->excludedCount = excludedCount;
+  newNode->forcedCols = malloc((size_t)murty->rows * sizeof(int));
+  newNode->excludedRows = malloc(excluded * sizeof(int));
+  newNode->excludedCols = malloc(excluded * sizeof(int));
+  newNode->rowToCol = malloc((size_t)murty->rows * sizeof(int));
+  newNode->v = malloc((size_t)murty->cols * sizeof(double));
+  if (newNode->forcedCols == NULL || newNode->excludedRows == NULL ||
+      newNode->excludedCols == NULL || newNode->rowToCol == NULL ||
+      newNode->v == NULL) {
+    FreeMurtyNode(newNode);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  memcpy(newNode->forcedCols, forcedCols, (size_t)murty->rows * sizeof(int));
+  *node = newNode;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Solves a subproblem, from scratch or starting from the assignment
+ *         and potentials of the subproblem it was split from.
+ * @param  murty  - The enumeration.
+ * @param  node   - The subproblem; its assignment and total are set.
+ * @param  parent - The subproblem it was split from, or NULL.
+ * @retval `NO_FEASIBLE_ASSIGNMENT` - The subproblem has no assignment.
+ * @retval `SUCCESS`                - Operation successful.
+ */
+static int SolveMurtyNode(Murty* murty, MurtyNode* node,
+                          const MurtyNode* parent) {
+  LapCost cost = {murty->rows, murty->cols, GetMurtyRow, murty};
+  LapState* state = murty->state;
+
+  murty->forcedCols = node->forcedCols;
+  murty->forcedCount = 0;
+  for (int i = 0; i < murty->rows; i++) {
+    if (node->forcedCols[i] >= 0) {
+      murty->forcedRows[node->forcedCols[i]] = i;
+      murty->forcedCount++;
+    }
+  }
+  for (int e = 0; e < node->excludedCount; e++) {
+    size_t cell =
+        (size_t)node->excludedRows[e] * murty->cols + node->excludedCols[e];
+    murty->savedCosts[e] = murty->costs[cell];
+    murty->costs[cell] = HUGE_VAL;
+  }
+
+  int status;
+  if (parent == NULL) {
+    status = SolveLap(&cost, murty->workspace, state);
+  } else {
+    memcpy(state->rowToCol, parent->rowToCol,
+           (size_t)murty->rows * sizeof(int));
+    memcpy(state->v, parent->v, (size_t)murty->cols * sizeof(double));
+    LapRepairState(&cost, murty->workspace, state);
+    status = LapAugmentFreeRows(&cost, murty->workspace, state);
+  }
+
+  for (int e = 0; e < node->excludedCount; e++) {
+    size_t cell =
+        (size_t)node->excludedRows[e] * murty->cols + node->excludedCols[e];
+    murty->costs[cell] = murty->savedCosts[e];
+  }
+  for (int i = 0; i < murty->rows; i++) {
+    if (node->forcedCols[i] >= 0) {
+      murty->forcedRows[node->forcedCols[i]] = -1;
+    }
+  }
+  if (status != SUCCESS) {
+    return status;
+  }
+
+  node->value = 0.0;
+  for (int i = 0; i < murty->rows; i++) {
+    int col = state->rowToCol[i];
+    node->rowToCol[i] = col;
+    node->value -= murty->costs[(size_t)i * murty->cols + col];
+  }
+  memcpy(node->v, state->v, (size_t)murty->cols * sizeof(double));
+  return SUCCESS;
+}
+
+/**
+ * @brief  Adds a solved subproblem to the priority queue.
+ * @param  murty - The enumeration.
+ * @param  node  - The subproblem.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int PushMurtyNode(Murty* murty, MurtyNode* node) {
+  if (murty->queueSize == murty->queueCapacity) {
+    int capacity = murty->queueCapacity > 0 ? murty->queueCapacity * 2 : 64;
+    MurtyNode** queue =
+        realloc(murty->queue, (size_t)capacity * sizeof(MurtyNode*));
+    if (queue == NULL) {
+      return MEMORY_ALLOCATION_FAILURE;
+    }
+    murty->queue = queue;
+    murty->queueCapacity = capacity;
+  }
+
+  int position = murty->queueSize++;
+  while (position > 0) {
+    int parent = (position - 1) / 2;
+    if (murty->queue[parent]->value >= node->value) {
+      break;
+    }
+    murty->queue[position] = murty->queue[parent];
+    position = parent;
+  }
+  murty->queue[position] = node;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Removes the subproblem with the best total from the priority
+ *         queue.
+ * @param  murty - The enumeration, with a subproblem in the queue.
+ * @retval The subproblem.
+ */
+static MurtyNode* PopMurtyNode(Murty* murty) {
+  MurtyNode* top = murty->queue[0];
+  MurtyNode* last = murty->queue[--murty->queueSize];
+
+  int position = 0;
+  while (1) {
+    int child = 2 * position + 1;
+    if (child >= murty->queueSize) {
+      break;
+    }
+    if (child + 1 < murty->queueSize &&
+        murty->queue[child + 1]->value > murty->queue[child]->value) {
+      child++;
+    }
+    if (murty->queue[child]->value <= last->value) {
+      break;
+    }
+    murty->queue[position] = murty->queue[child];
+    position = child;
+  }
+  if (murty->queueSize > 0) {
+    murty->queue[position] = last;
+  }
+  return top;
+}
+
+/**
+ * @brief  Splits the assignments of a subproblem other than its best one
+ *         into children: child `t` forces the assigned cells of the first
+ *         `t` free rows and excludes the one of the next free row. Each
+ *         child is solved and the feasible ones are queued.
+ * @param  murty    - The enumeration.
+ * @param  node     - The subproblem, whose best assignment was listed.
+ * @param  forced   - Array of `rows` integers used as scratch memory.
+ * @param  deadline - Time after which no more children are solved, or 0.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `TIME_LIMIT_REACHED`        - The deadline passed.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int SplitMurtyNode(Murty* murty, const MurtyNode* node, int* forced,
+                          double deadline) {
+  int freeRows = 0;
+  for (int i = 0; i < murty->rows; i++) {
+    forced[i] = node->forcedCols[i];
+    freeRows += forced[i] < 0;
+  }
+
+  for (int i = 0; i < murty->rows; i++) {
+    if (forced[i] >= 0) {
+      continue;
+    }
+    // In a square problem the last free row has no other column left
+    if (--freeRows == 0 && murty->rows == murty->cols) {
+      break;
+    }
+    if (deadline > 0.0 && GetMonotonicTime() > deadline) {
+      return TIME_LIMIT_REACHED;
+    }
+
+    MurtyNode* child = NULL;
+    int count = node->excludedCount;
+    if (CreateMurtyNode(murty, forced, count + 1, &child) != SUCCESS) {
+      return MEMORY_ALLOCATION_FAILURE;
+    }
+    memcpy(child->excludedRows, node->excludedRows,
+           (size_t)count * sizeof(int));
+    memcpy(child->excludedCols, node->excludedCols,
+           (size_t)count * sizeof(int));
+    child->excludedRows[count] = i;
+    child->excludedCols[count] = node->rowToCol[i];
+
+    int status = SolveMurtyNode(murty, child, node);
+    if (status == SUCCESS) {
+      status = PushMurtyNode(murty, child);
+    }
+    if (status != SUCCESS) {
+      FreeMurtyNode(child);
+      if (status != NO_FEASIBLE_ASSIGNMENT) {
+        return status;
+      }
+    }
+
+    forced[i] = node->rowToCol[i];
+  }
+  return SUCCESS;
+}
+
+/**
+ * @brief  Creates the result of an assignment, in the row order of the
+ *         matrix.
+ * @param  murty      - The enumeration.
+ * @param  node       - The subproblem with the assignment.
+ * @param  transposed - Whether the rows of the costs are the columns of the
+ *                      matrix.
+ * @param  height     - Number of rows of the matrix.
+ * @param  result     - Pointer to store the chosen elements.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int ExtractMurtyResult(const Murty* murty, const MurtyNode* node,
+                              int transposed, int height,
+                              AssignmentResult** result) {
+  AssignmentResult* selection = NULL;
+  if (CreateAssignmentResult(murty->rows, &selection) != SUCCESS) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  // Columns of the costs back to rows of a tall matrix
+  int* colToRow = murty->workspace->scanned;
+  if (transposed) {
+    for (int j = 0; j < murty->cols; j++) {
+      colToRow[j] = -1;
+    }
+    for (int i = 0; i < murty->rows; i++) {
+      colToRow[node->rowToCol[i]] = i;
+    }
+  }
+
+  int status = SUCCESS;
+  for (int row = 0; row < height && status == SUCCESS; row++) {
+    int costRow = transposed ? colToRow[row] : row;
+    if (costRow < 0) {
+      continue;
+    }
+    int costCol = transposed ? row : node->rowToCol[row];
+    double value = -murty->costs[(size_t)costRow * murty->cols + costCol];
+    status = AddAssignment(selection, row, transposed ? costRow : costCol,
+                           value);
+  }
+
+  if (status != SUCCESS) {
+    FreeAssignmentResult(selection);
+    return status;
+  }
+
+  *result = selection;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Creates the costs of a matrix: its values negated, row by row,
+ *         transposed if the matrix has more rows than columns.
+ * @param  matrix - Pointer to the input matrix.
+ * @param  murty  - The enumeration, with its size set.
+ * @retval `INVALID_MATRIX_OR_INDICES` - An element is outside the matrix.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+static int CreateMurtyCosts(const Matrix* matrix, Murty* murty) {
+  int transposed = matrix->height > matrix->width;
+  murty->costs = calloc((size_t)murty->rows * murty->cols, sizeof(double));
+  if (murty->costs == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  // Position of a cell in `costs`: row * rowStride + col * colStride
+  size_t rowStride = transposed ? 1 : (size_t)murty->cols;
+  size_t colStride = transposed ? (size_t)murty->cols : 1;
+  int row = 0;
+  for (MatrixRowNode* rowNode = matrix->head; rowNode != NULL;
+       rowNode = rowNode->nextRow, row++) {
+    if (row >= matrix->height) {
+      return INVALID_MATRIX_OR_INDICES;
+    }
+    for (MatrixElement* element = rowNode->row; element != NULL;
+         element = element->nextCol) {
+      if (element->column < 0 || element->column >= matrix->width) {
+        return INVALID_MATRIX_OR_INDICES;
+      }
+      murty->costs[row * rowStride + element->column * colStride] =
+          -(double)element->value;
+    }
+  }
+  return SUCCESS;
+}
+
+/**
+ * @brief Frees an enumeration and the subproblems left in its queue.
+ * @param murty - The enumeration.
+ */
+static void FreeMurty(Murty* murty) {
+  for (int q = 0; q < murty->queueSize; q++) {
+    FreeMurtyNode(murty->queue[q]);
+  }
+  free(murty->queue);
+  free(murty->costs);
+  free(murty->forcedRows);
+  free(murty->savedCosts);
+  FreeLapWorkspace(murty->workspace);
+  FreeLapState(murty->state);
+}
+
+/**
+ * @brief  Lists the `k` best assignments of a matrix in order of
+ *         non-increasing total, with Murty's method.
+ * @param  matrix    - Pointer to the input matrix.
+ * @param  k         - Number of assignments wanted.
+ * @param  timeLimit - Seconds after which the enumeration stops, or 0 for
+ *                     no limit.
+ * @param  callback  - Function that receives each assignment.
+ * @param  context   - Argument given to `callback`.
+ * @param  count     - Pointer to store the number of assignments listed, or
+ *                     NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix or the arguments are
+ *                                       invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `TIME_LIMIT_REACHED`        - The time limit passed before `k`
+ *                                       assignments were listed.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int KBestAssignments(Matrix* matrix, int k, double timeLimit,
+                     KBestCallback callback, void* context, int* count) {
+  if (count != NULL) {
+    *count = 0;
+  }
+  if (matrix == NULL || matrix->width <= 0 || matrix->height <= 0 || k < 0 ||
+      timeLimit < 0.0 || callback == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  double deadline = timeLimit > 0.0 ? GetMonotonicTime() + timeLimit : 0.0;
+  int transposed = matrix->height > matrix->width;
+  Murty murty = {0};
+  murty.rows = transposed ? matrix->width : matrix->height;
+  murty.cols = transposed ? matrix->height : matrix->width;
+
+  // A subproblem excludes at most one cell per listed assignment, and no
+  // cell twice
+  size_t cells = (size_t)murty.rows * murty.cols;
+  size_t excluded = (size_t)k < cells ? (size_t)k + 1 : cells;
+  int status = CreateMurtyCosts(matrix, &murty);
+  MurtyNode* root = NULL;
+  int* forced = malloc((size_t)murty.rows * sizeof(int));
+  murty.forcedRows = malloc((size_t)murty.cols * sizeof(int));
+  murty.savedCosts = malloc(excluded * sizeof(double));
+  if (status == SUCCESS &&
+      (forced == NULL || murty.forcedRows == NULL ||
+       murty.savedCosts == NULL ||
+       CreateLapWorkspace(murty.rows, murty.cols, &murty.workspace) !=
+           SUCCESS ||
+       CreateLapState(murty.rows, murty.cols, &murty.state) != SUCCESS)) {
+    status = MEMORY_ALLOCATION_FAILURE;
+  }
+  if (status == SUCCESS) {
+    for (int i = 0; i < murty.rows; i++) {
+      forced[i] = -1;
+    }
+    for (int j = 0; j < murty.cols; j++) {
+      murty.forcedRows[j] = -1;
+    }
+    status = CreateMurtyNode(&murty, forced, 0, &root);
+  }
+  if (status == SUCCESS && k > 0) {
+    status = SolveMurtyNode(&murty, root, NULL);
+    if (status == SUCCESS) {
+      status = PushMurtyNode(&murty, root);
+    }
+    if (status != SUCCESS) {
+      FreeMurtyNode(root);
+    }
+  } else {
+    FreeMurtyNode(root);
+  }
+
+  int listed = 0;
+  while (status == SUCCESS && listed < k && murty.queueSize > 0) {
+    if (deadline > 0.0 && GetMonotonicTime() > deadline) {
+      status = TIME_LIMIT_REACHED;
+      break;
+    }
+
+    MurtyNode* node = PopMurtyNode(&murty);
+    AssignmentResult* result = NULL;
+    int stop = 0;
+    status = ExtractMurtyResult(&murty, node, transposed, matrix->height,
+                                &result);
+    if (status == SUCCESS) {
+      listed++;
+      stop = callback(result, listed, context);
+      FreeAssignmentResult(result);
+    }
+    if (status == SUCCESS && !stop && listed < k) {
+      status = SplitMurtyNode(&murty, node, forced, deadline);
+    }
+    FreeMurtyNode(node);
+    if (stop) {
+      break;
+    }
+  }
+
+  if (count != NULL) {
+    *count = listed;
+  }
+  free(forced);
+  FreeMurty(&murty);
+  return status;
+}
@@ -0,0 +1,65 @@
+/**
+ *  @file      murty.h
+ *  @brief     Header file for the enumeration of the k best assignments.
+ *  @details   This header file contains the declaration of Murty's method,
+ *             which lists the assignments of a matrix from the best total
+ *             down. The assignments not listed yet are split into disjoint
+ *             subproblems, each one a set of cells that must be chosen and
+ *             a set of cells that may not; a priority queue keeps the best
+ *             assignment of every subproblem, and the best of those is the
+ *             next one listed. Each subproblem is solved by the Hungarian
+ *             engine starting from the potentials of the subproblem it was
+ *             split from, over the same matrix of costs.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef MURTY_H
+#define MURTY_H
+
+#include "assignment.h"
+#include "matrix_core.h"
+
+/**
+ * @brief  Receives the assignments listed by `KBestAssignments`.
+ * @param  assignment - The assignment, in row order; it is freed when the
+ *                      function returns.
+ * @param  rank       - Position of the assignment, 1 for the best.
+ * @param  context    - The `context` given to `KBestAssignments`.
+ * @retval 0 to go on, any other value to stop the enumeration.
+ */
+typedef int (*KBestCallback)(const AssignmentResult* assignment, int rank,
+                             void* context);
+
+/**
+ * @brief  Lists the `k` best assignments of a matrix in order of
+ *         non-increasing total, with Murty's method. Every row of a wide
+ *         matrix and every column of a tall one is assigned, as
+ *         `HungarianAssignment` does, and assignments with the same total
+ *         are listed in no particular order.
+ * @details Each listed assignment splits its subproblem in one child per row
+ *          not fixed yet, which costs one warm started solve each, so the
+ *          `k` best cost about `k * n` solves of an n x m problem, most of
+ *          them a few shortest path searches. The enumeration also ends when
+ *          every assignment was listed.
+ * @param  matrix    - Pointer to the input matrix.
+ * @param  k         - Number of assignments wanted.
+ * @param  timeLimit - Seconds after which the enumeration stops, or 0 for
+ *                     no limit.
+ * @param  callback  - Function that receives each assignment.
+ * @param  context   - Argument given to `callback`.
+ * @param  count     - Pointer to store the number of assignments listed, or
+ *                     NULL.
+ * @retval `INVALID_MATRIX_OR_INDICES` - The matrix or the arguments are
+ *                                       invalid.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `TIME_LIMIT_REACHED`        - The time limit passed before `k`
+ *                                       assignments were listed.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int KBestAssignments(Matrix* matrix, int k,
+                                           double timeLimit,
+                                           KBestCallback callback,
+                                           void* context, int* count);
+
+#endif  // !MURTY_H
@@ -0,0 +1,478 @@
+/**
+ *
+ *  @file      platform.c
+ *  @brief     Implementation of the portable operating system wrappers.
+ *  @details   This file implements the functions declared in platform.h on
+ *             top of the Win32 API on Windows and POSIX elsewhere.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "platform.h"
+
+#include <limits.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include "constants.h"
+#include "error_codes.h"
+
+/**
+ * @struct ThreadStart
+ * @brief Function and argument handed over to a new thread.
+ */
+typedef struct ThreadStart {
+  ThreadFunction function;  // Function to execute
+  void* argument;           // Argument of the function
+} ThreadStart;
+
+#ifdef _WIN32
+/**
+ * @brief Entry point of the threads created by `StartThread`.
+ * @param start - The `ThreadStart` of the thread.
+ * @retval Always 0.
+ */
+static unsigned __stdcall ThreadEntry(void* start) {
+  ThreadStart info = *(ThreadStart*)start;
+  free(start);
+  info.function(info.argument);
+  return 0;
+}
+#else
+/**
+ * @brief Entry point of the threads created by `StartThread`.
+ * @param start - The `ThreadStart` of the thread.
+ * @retval Always NULL.
+ */
+static void* ThreadEntry(void* start) {
+  ThreadStart info = *(ThreadStart*)start;
+  free(start);
+  info.function(info.argument);
+  return NULL;
+}
+#endif
+
+/**
+ * @brief  Starts a new thread.
+ * @param  thread   - Handle of the new thread.
+ * @param  function - Function executed by the thread.
+ * @param  argument - Argument passed to `function`.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `THREAD_CREATION_FAILURE`   - The thread could not be created.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int StartThread(ThreadHandle* thread, ThreadFunction function, void* argument) {
+  ThreadStart* start = malloc(sizeof(ThreadStart));
+  if (start == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  start->function = function;
+  start->argument = argument;
+
+#ifdef _WIN32
+  uintptr_t handle = _beginthreadex(NULL, 0, ThreadEntry, start, 0, NULL);
+  if (handle == 0) {
+    free(start);
+    return THREAD_CREATION_FAILURE;
+  }
+  *thread = (HANDLE)handle;
+#else
+  if (pthread_create(thread, NULL, ThreadEntry, start) != 0) {
+    free(start);
+    return THREAD_CREATION_FAILURE;
+  }
+#endif
+
+  return SUCCESS;
+}
+
+/**
+ * @brief Waits for a thread to finish and releases its handle.
+ * @param thread - The thread.
+ */
+void JoinThread(ThreadHandle thread) {
+#ifdef _WIN32
+  WaitForSingleObject(thread, INFINITE);
+  CloseHandle(thread);
+#else
+  pthread_join(thread, NULL);
+#endif
+}
+
+/**
+ * @brief Releases the handle of a thread that will not be joined. The thread
+ *        keeps running until its function returns.
+ * @param thread - The thread.
+ */
+void DetachThread(ThreadHandle thread) {
+#ifdef _WIN32
+  CloseHandle(thread);
+#else
+  pthread_detach(thread);
+#endif
+}
+
+/**
+ * @brief Initializes a mutex.
+ * @param mutex - The mutex.
+ */
+void InitMutex(Mutex* mutex) {
+#ifdef _WIN32
+  InitializeCriticalSection(mutex);
+#else
+  pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+/**
+ * @brief Destroys a mutex.
+ * @param mutex - The mutex.
+ */
+void DestroyMutex(Mutex* mutex) {
+#ifdef _WIN32
+  DeleteCriticalSection(mutex);
+#else
+  pthread_mutex_destroy(mutex);
+#endif
+}
+
+/**
+ * @brief Locks a mutex.
+ * @param mutex - The mutex.
+ */
+void LockMutex(Mutex* mutex) {
+#ifdef _WIN32
+  EnterCriticalSection(mutex);
+#else
+  pthread_mutex_lock(mutex);
+#endif
+}
+
+/**
+ * @brief Unlocks a mutex.
+ * @param mutex - The mutex.
+ */
+void UnlockMutex(Mutex* mutex) {
+#ifdef _WIN32
+  LeaveCriticalSection(mutex);
+#else
+  pthread_mutex_unlock(mutex);
+#endif
+}
+
+/**
+ * @brief Initializes a condition variable.
+ * @param condition - The condition variable.
+ */
+void InitCondition(ConditionVariable* condition) {
+#ifdef _WIN32
+  InitializeConditionVariable(condition);
+#else
+  pthread_cond_init(condition, NULL);
+#endif
+}
+
+/**
+ * @brief Destroys a condition variable.
+ * @param condition - The condition variable.
+ */
+void DestroyCondition(ConditionVariable* condition) {
+#ifdef _WIN32
+  (void)condition;  // Win32 condition variables hold no resources
+#else
+  pthread_cond_destroy(condition);
+#endif
+}
+
+/**
+ * @brief Atomically unlocks `mutex` and waits on a condition variable,
+ *        locking `mutex` again before returning.
+ * @param condition - The condition variable.
+ * @param mutex     - The locked mutex.
+ */
+void WaitCondition(ConditionVariable* condition, Mutex* mutex) {
+#ifdef _WIN32
+  SleepConditionVariableCS(condition, mutex, INFINITE);
+#else
+  pthread_cond_wait(condition, mutex);
+#endif
+}
+
+/**
+ * @brief Wakes one thread waiting on a condition variable.
+ * @param condition - The condition variable.
+ */
+void SignalCondition(ConditionVariable* condition) {
+#ifdef _WIN32
+  WakeConditionVariable(condition);
+#else
+  pthread_cond_signal(condition);
+#endif
+}
+
+/**
+ * @brief Wakes all threads waiting on a condition variable.
+ * @param condition - The condition variable.
+ */
+void BroadcastCondition(ConditionVariable* condition) {
+#ifdef _WIN32
+  WakeAllConditionVariable(condition);
+#else
+  pthread_cond_broadcast(condition);
+#endif
+}
+
+/**
+ * @brief  Reads a shared counter, so that the memory writes made before the
+ *         matching `AtomicStore` or `AtomicIncrement` are visible.
+ * @param  value - The counter.
+ * @retval The value of the counter.
+ */
+long AtomicLoad(volatile long* value) {
+#ifdef _WIN32
+  return InterlockedCompareExchange(value, 0, 0);
+#else
+  return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/**
+ * @brief Writes a shared counter after every earlier memory write.
+ * @param value    - The counter.
+ * @param newValue - The new value.
+ */
+void AtomicStore(volatile long* value, long newValue) {
+#ifdef _WIN32
+  InterlockedExchange(value, newValue);
+#else
+  __atomic_store_n(value, newValue, __ATOMIC_RELEASE);
+#endif
+}
+
+/**
+ * @brief  Atomically adds one to a shared counter.
+ * @param  value - The counter.
+ * @retval The new value of the counter.
+ */
+long AtomicIncrement(volatile long* value) {
+#ifdef _WIN32
+  return InterlockedIncrement(value);
+#else
+  return __atomic_add_fetch(value, 1, __ATOMIC_ACQ_REL);
+#endif
+}
+
+/**
+ * @brief Hints the processor that the thread is busy waiting.
+ */
+void SpinPause(void) {
+#ifdef _WIN32
+  YieldProcessor();
+#elif defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#endif
+}
+
+/**
+ * @brief Gives the rest of the time slice of the thread to other threads.
+ */
+void YieldThread(void) {
+#ifdef _WIN32
+  SwitchToThread();
+#else
+  sched_yield();
+#endif
+}
+
+/**
+ * @brief Busy waits, yielding the processor after a while.
+ * @param spins - Number of waits so far, updated.
+ */
+static void WaitBriefly(int* spins) {
+  if (++*spins < SPINS_BEFORE_YIELD) {
+    SpinPause();
+  } else {
+    YieldThread();
+    *spins = 0;
+  }
+}
+
+/**
+ * @brief Publishes a new step to the workers of a barrier.
+ * @param barrier - The barrier.
+ */
+void PublishStep(StepBarrier* barrier) {
+  // Only the publishing thread writes `generation`, and every worker has
+  // counted the previous step, so `finished` can start over
+  long next = barrier->generation == LONG_MAX ? 0 : barrier->generation + 1;
+  AtomicStore(&barrier->finished, 0);
+  AtomicStore(&barrier->generation, next);
+}
+
+/**
+ * @brief  Busy waits in a worker until a step after `seen` is published.
+ * @param  barrier - The barrier.
+ * @param  seen    - The last step seen by the worker.
+ * @retval The new step.
+ */
+long WaitForStep(StepBarrier* barrier, long seen) {
+  int spins = 0;
+  long generation;
+  while ((generation = AtomicLoad(&barrier->generation)) == seen) {
+    WaitBriefly(&spins);
+  }
+  return generation;
+}
+
+/**
+ * @brief Counts a worker as done with the current step.
+ * @param barrier - The barrier.
+ */
+void FinishStep(StepBarrier* barrier) {
+  AtomicIncrement(&barrier->finished);
+}
+
+/**
+ * @brief Busy waits until a number of workers are done with the current
+ *        step.
+ * @param barrier     - The barrier.
+ * @param workerCount - Number of workers that take part in the step.
+ */
+void WaitForWorkers(StepBarrier* barrier, int workerCount) {
+  int spins = 0;
+  while (AtomicLoad(&barrier->finished) < workerCount) {
+    WaitBriefly(&spins);
+  }
+}
+
+/**
+ * @brief  Gets the number of logical processors of the machine.
+ * @retval The number of logical processors, at least 1.
+ */
+int GetProcessorCount(void) {
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+  return count > 0 ? (int)count : 1;
+#endif
+}
+
+/**
+ * @brief  Gets the time of a clock that never goes back, unlike the time of
+ *         day, to measure durations.
+ * @retval Seconds since an unspecified point.
+ */
+double GetMonotonicTime(void) {
+#ifdef _WIN32
+  LARGE_INTEGER frequency;
+  LARGE_INTEGER counter;
+  QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+#endif
+}
+
+/**
+ * @brief  Maps a whole file into memory, copy-on-write.
+ * @param  filename - The name of the file.
+ * @param  mapping  - The mapping of the file.
+ * @retval `CANNOT_OPEN_FILE` - Failure to open the file.
+ * @retval `FILE_READ_ERROR`  - The file is empty or cannot be mapped.
+ * @retval `SUCCESS`          - Operation successful.
+ */
+int MapFile(const char* filename, FileMapping* mapping) {
+#ifdef _WIN32
+  HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    return CANNOT_OPEN_FILE;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0 ||
+      (unsigned long long)size.QuadPart > (size_t)-1) {
+    CloseHandle(file);
+    return FILE_READ_ERROR;
+  }
+
+  HANDLE fileMapping =
+      CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+  void* address = fileMapping != NULL
+                      ? MapViewOfFile(fileMapping, FILE_MAP_COPY, 0, 0, 0)
+                      : NULL;
+  if (address == NULL) {
+    if (fileMapping != NULL) {
+      CloseHandle(fileMapping);
+    }
+    CloseHandle(file);
+    return FILE_READ_ERROR;
+  }
+
+  mapping->address = address;
+  mapping->size = (size_t)size.QuadPart;
+  mapping->file = file;
+  mapping->mapping = fileMapping;
+#else
+  int file = open(filename, O_RDONLY);
+  if (file < 0) {
+    return CANNOT_OPEN_FILE;
+  }
+
+  struct stat info;
+  if (fstat(file, &info) != 0 || info.st_size <= 0) {
+    close(file);
+    return FILE_READ_ERROR;
+  }
+
+  // The mapping stays valid after the file is closed
+  void* address = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE, file, 0);
+  close(file);
+  if (address == MAP_FAILED) {
+    return FILE_READ_ERROR;
+  }
+
+  mapping->address = address;
+  mapping->size = (size_t)info.st_size;
+#endif
+
+  return SUCCESS;
+}
+
+/**
+ * @brief Unmaps a file mapped with `MapFile`.
+ * @param mapping - The mapping of the file.
+ */
+void UnmapFile(FileMapping* mapping) {
+#ifdef _WIN32
+  UnmapViewOfFile(mapping->address);
+  CloseHandle(mapping->mapping);
+  CloseHandle(mapping->file);
+#else
+  munmap(mapping->address, mapping->size);
+#endif
+  mapping->address = NULL;
+  mapping->size = 0;
+}
@@ -0,0 +1,243 @@
+/**
+ *  @file      platform.h
+ *  @brief     Portable wrappers for operating system primitives.
+ *  @details   This header file declares thin wrappers over the threading
+ *             primitives and memory-mapped files of the operating system
+ *             (Win32 on Windows, POSIX elsewhere), so the rest of the library
+ *             does not depend on a specific platform API.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#include <stddef.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+
+typedef HANDLE ThreadHandle;
+typedef CRITICAL_SECTION Mutex;
+typedef CONDITION_VARIABLE ConditionVariable;
+#else
+#include <pthread.h>
+
+typedef pthread_t ThreadHandle;
+typedef pthread_mutex_t Mutex;
+typedef pthread_cond_t ConditionVariable;
+#endif
+
+/**
+ * @struct FileMapping
+ * @brief A file mapped into memory.
+ *
+ * The mapping is copy-on-write: the bytes may be changed in memory, but the
+ * changes are never written back to the file.
+ */
+typedef struct FileMapping {
+  void* address;  // First byte of the file in memory
+  size_t size;    // Size of the file in bytes
+#ifdef _WIN32
+  HANDLE file;     // Handle of the open file
+  HANDLE mapping;  // Handle of the file mapping object
+#endif
+} FileMapping;
+
+/**
+ * @struct StepBarrier
+ * @brief Steps published by one thread to a fixed set of busy-waiting
+ *        workers, and the count of workers done with the current step.
+ *
+ * Both counters stay bounded however many steps are run: `finished` is
+ * reset by each step and `generation` wraps to 0. Zero-initialize it.
+ */
+typedef struct StepBarrier {
+  volatile long generation;  // Step last published
+  volatile long finished;    // Workers done with the current step
+} StepBarrier;
+
+/**
+ * @brief Function executed by a thread started with `StartThread`.
+ * @param argument - The argument given to `StartThread`.
+ */
+typedef void (*ThreadFunction)(void* argument);
+
+/**
+ * @brief  Starts a new thread.
+ * @param  thread   - Handle of the new thread.
+ * @param  function - Function executed by the thread.
+ * @param  argument - Argument passed to `function`.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `THREAD_CREATION_FAILURE`   - The thread could not be created.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int StartThread(ThreadHandle* thread, ThreadFunction function, void* argument);
+
+/**
+ * @brief Waits for a thread to finish and releases its handle.
+ * @param thread - The thread.
+ */
+void JoinThread(ThreadHandle thread);
+
+/**
+ * @brief Releases the handle of a thread that will not be joined. The thread
+ *        keeps running until its function returns.
+ * @param thread - The thread.
+ */
+void DetachThread(ThreadHandle thread);
+
+/**
+ * @brief Initializes a mutex.
+ * @param mutex - The mutex.
+ */
+void InitMutex(Mutex* mutex);
+
+/**
+ * @brief Destroys a mutex.
+ * @param mutex - The mutex.
+ */
+void DestroyMutex(Mutex* mutex);
+
+/**
+ * @brief Locks a mutex.
+ * @param mutex - The mutex.
+ */
+void LockMutex(Mutex* mutex);
+
+/**
+ * @brief Unlocks a mutex.
+ * @param mutex - The mutex.
+ */
+void UnlockMutex(Mutex* mutex);
+
+/**
+ * @brief Initializes a condition variable.
+ * @param condition - The condition variable.
+ */
+void InitCondition(ConditionVariable* condition);
+
+/**
+ * @brief Destroys a condition variable.
+ * @param condition - The condition variable.
+ */
+void DestroyCondition(ConditionVariable* condition);
+
+/**
+ * @brief Atomically unlocks `mutex` and waits on a condition variable,
+ *        locking `mutex` again before returning.
+ * @param condition - The condition variable.
+ * @param mutex     - The locked mutex.
+ */
+void WaitCondition(ConditionVariable* condition, Mutex* mutex);
+
+/**
+ * @brief Wakes one thread waiting on a condition variable.
+ * @param condition - The condition variable.
+ */
+void SignalCondition(ConditionVariable* condition);
+
+/**
+ * @brief Wakes all threads waiting on a condition variable.
+ * @param condition - The condition variable.
+ */
+void BroadcastCondition(ConditionVariable* condition);
+
+/**
+ * @brief  Reads a shared counter, so that the memory writes made before the
+ *         matching `AtomicStore` or `AtomicIncrement` are visible.
+ * @param  value - The counter.
+ * @retval The value of the counter.
+ */
+long AtomicLoad(volatile long* value);
+
+/**
+ * @brief Writes a shared counter after every earlier memory write.
+ * @param value    - The counter.
+ * @param newValue - The new value.
+ */
+void AtomicStore(volatile long* value, long newValue);
+
+/**
+ * @brief  Atomically adds one to a shared counter.
+ * @param  value - The counter.
+ * @retval The new value of the counter.
+ */
+long AtomicIncrement(volatile long* value);
+
+/**
+ * @brief Hints the processor that the thread is busy waiting.
+ */
+void SpinPause(void);
+
+/**
+ * @brief Gives the rest of the time slice of the thread to other threads.
+ */
+void YieldThread(void);
+
+/**
+ * @brief Publishes a new step to the workers of a barrier, once the workers
+ *        are done with the previous one. The memory writes made before are
+ *        visible to the workers that see the step.
+ * @param barrier - The barrier.
+ */
+void PublishStep(StepBarrier* barrier);
+
+/**
+ * @brief  Busy waits in a worker until a step after `seen` is published.
+ * @param  barrier - The barrier.
+ * @param  seen    - The last step seen by the worker, 0 at first.
+ * @retval The new step.
+ */
+long WaitForStep(StepBarrier* barrier, long seen);
+
+/**
+ * @brief Counts a worker as done with the current step.
+ * @param barrier - The barrier.
+ */
+void FinishStep(StepBarrier* barrier);
+
+/**
+ * @brief Busy waits until a number of workers are done with the current
+ *        step. Their memory writes are then visible.
+ * @param barrier     - The barrier.
+ * @param workerCount - Number of workers that take part in the step.
+ */
+void WaitForWorkers(StepBarrier* barrier, int workerCount);
+
+/**
+ * @brief  Gets the number of logical processors of the machine.
+ * @retval The number of logical processors, at least 1.
+ */
+int GetProcessorCount(void);
+
+/**
+ * @brief  Gets the time of a clock that never goes back, unlike the time of
+ *         day, to measure durations.
+ * @retval Seconds since an unspecified point.
+ */
+double GetMonotonicTime(void);
+
+/**
+ * @brief  Maps a whole file into memory, copy-on-write.
+ * @param  filename - The name of the file.
+ * @param  mapping  - The mapping of the file.
+ * @retval `CANNOT_OPEN_FILE` - Failure to open the file.
+ * @retval `FILE_READ_ERROR`  - The file is empty or cannot be mapped.
+ * @retval `SUCCESS`          - Operation successful.
+ */
+int MapFile(const char* filename, FileMapping* mapping);
+
+/**
+ * @brief Unmaps a file mapped with `MapFile`.
+ * @param mapping - The mapping of the file.
+ */
+void UnmapFile(FileMapping* mapping);
+
+#endif  // !PLATFORM_H
@@ -0,0 +1,119 @@
+/**
+ *
+ *  @file      solver_workspace.c
+ *  @brief     Implementation of the memory reused by repeated solves.
+ *  @details   This file contains the functions that create, grow and free a
+ *             workspace. The engine arrays are sized for the smaller side
+ *             as rows and the larger side as columns, which covers every
+ *             matrix within the maximum size, transposed or not.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ *
+ */
+#include "solver_workspace.h"
+
+#include <stdlib.h>
+
+#include "error_codes.h"
+#include "lap_core.h"
+#include "matrix_core.h"
+
+/**
+ * @brief  Creates a workspace for matrices of a maximum size.
+ * @param  maxWidth  - The most columns of the matrices.
+ * @param  maxHeight - The most rows of the matrices.
+ * @param  workspace - The new workspace.
+ * @retval `INVALID_MATRIX_OR_INDICES` - Invalid size.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int CreateSolverWorkspace(int maxWidth, int maxHeight,
+                          SolverWorkspace** workspace) {
+  if (maxWidth <= 0 || maxHeight <= 0 || workspace == NULL) {
+    return INVALID_MATRIX_OR_INDICES;
+  }
+
+  SolverWorkspace* newWorkspace = calloc(1, sizeof(SolverWorkspace));
+  if (newWorkspace == NULL) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+  if (ReserveSolverWorkspace(newWorkspace, maxWidth, maxHeight) != SUCCESS) {
+    FreeSolverWorkspace(newWorkspace);
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  *workspace = newWorkspace;
+  return SUCCESS;
+}
+
+/**
+ * @brief  Makes a workspace large enough for a matrix, growing its arrays
+ *         if needed.
+ * @param  workspace - The workspace.
+ * @param  width     - The number of columns of the matrix.
+ * @param  height    - The number of rows of the matrix.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int ReserveSolverWorkspace(SolverWorkspace* workspace, int width,
+                           int height) {
+  if (width <= workspace->maxWidth && height <= workspace->maxHeight) {
+    return SUCCESS;
+  }
+
+  // The arrays are replaced together, so a failure leaves an empty
+  // workspace that the next solve grows again
+  int maxWidth = width > workspace->maxWidth ? width : workspace->maxWidth;
+  int maxHeight =
+      height > workspace->maxHeight ? height : workspace->maxHeight;
+  int rows = maxWidth < maxHeight ? maxWidth : maxHeight;
+  int cols = maxWidth < maxHeight ? maxHeight : maxWidth;
+  free(workspace->costs);
+  free(workspace->usedRows);
+  free(workspace->usedColumns);
+  free(workspace->bestColumns);
+  free(workspace->cursors);
+  FreeLapWorkspace(workspace->lap);
+  FreeLapState(workspace->state);
+  workspace->maxWidth = 0;
+  workspace->maxHeight = 0;
+  workspace->lap = NULL;
+  workspace->state = NULL;
+
+  workspace->costs = malloc((size_t)maxWidth * maxHeight * sizeof(double));
+  workspace->usedRows = malloc((size_t)maxHeight * sizeof(int));
+  workspace->usedColumns = malloc((size_t)maxWidth * sizeof(int));
+  workspace->bestColumns = malloc((size_t)maxWidth * sizeof(int));
+  workspace->cursors = malloc((size_t)maxHeight * sizeof(MatrixElement*));
+  if (workspace->costs == NULL || workspace->usedRows == NULL ||
+      workspace->usedColumns == NULL || workspace->bestColumns == NULL ||
+      workspace->cursors == NULL ||
+      CreateLapWorkspace(rows, cols, &workspace->lap) != SUCCESS ||
+      CreateLapState(rows, cols, &workspace->state) != SUCCESS) {
+    return MEMORY_ALLOCATION_FAILURE;
+  }
+
+  workspace->maxWidth = maxWidth;
+  workspace->maxHeight = maxHeight;
+  return SUCCESS;
+}
+
+/**
+ * @brief Free allocated memory of a workspace.
+ * @param workspace - The workspace to be freed.
+ */
+void FreeSolverWorkspace(SolverWorkspace* workspace) {
+  if (workspace == NULL) {
+    return;
+  }
+
+  free(workspace->costs);
+  free(workspace->usedRows);
+  free(workspace->usedColumns);
+  free(workspace->bestColumns);
+  free(workspace->cursors);
+  FreeLapWorkspace(workspace->lap);
+  FreeLapState(workspace->state);
+  free(workspace);
+}
@@ -0,0 +1,68 @@
+/**
+ *  @file      solver_workspace.h
+ *  @brief     Header file for the memory reused by repeated solves.
+ *  @details   This header file contains the workspace taken by the
+ *             `WithWorkspace` solvers. It holds every array a solve needs
+ *             for matrices up to a given size, so once it exists, and the
+ *             result has room for the chosen elements, a solve makes no
+ *             allocation at all. A workspace must not be used by two solves
+ *             at the same time; keep one per thread.
+ *  @author    Enrique Rodrigues
+ *  @date      16.10.2026
+ *  @copyright  Enrique Rodrigues, 2026. All right reserved.
+ */
+#ifndef SOLVER_WORKSPACE_H
+#define SOLVER_WORKSPACE_H
+
+#include "matrix_core.h"
+
+/**
+ * @struct SolverWorkspace
+ * @brief Arrays shared by the solvers for matrices of at most `maxWidth`
+ *        columns and `maxHeight` rows.
+ *
+ * A larger matrix grows the workspace once, on the solve that needs it.
+ */
+typedef struct SolverWorkspace {
+  int maxWidth;              // Most columns of the matrices served
+  int maxHeight;             // Most rows of the matrices served
+  double* costs;             // Costs of the matrix being solved
+  int* usedRows;             // Mark of each row
+  int* usedColumns;          // Mark of each column
+  int* bestColumns;          // Mark of each column in the best selection
+  MatrixElement** cursors;   // Element reached in each row
+  struct LapWorkspace* lap;  // Scratch memory of the Hungarian engine
+  struct LapState* state;    // Assignment and potentials of the engine
+} SolverWorkspace;
+
+/**
+ * @brief  Creates a workspace for matrices of a maximum size.
+ * @param  maxWidth  - The most columns of the matrices.
+ * @param  maxHeight - The most rows of the matrices.
+ * @param  workspace - The new workspace; free it with
+ *                     `FreeSolverWorkspace`.
+ * @retval `INVALID_MATRIX_OR_INDICES` - Invalid size.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+__declspec(dllexport) int CreateSolverWorkspace(int maxWidth, int maxHeight,
+                                                SolverWorkspace** workspace);
+
+/**
+ * @brief  Makes a workspace large enough for a matrix, growing its arrays
+ *         if needed. This function is not exported by the library.
+ * @param  workspace - The workspace.
+ * @param  width     - The number of columns of the matrix.
+ * @param  height    - The number of rows of the matrix.
+ * @retval `MEMORY_ALLOCATION_FAILURE` - Memory allocation failure.
+ * @retval `SUCCESS`                   - Operation successful.
+ */
+int ReserveSolverWorkspace(SolverWorkspace* workspace, int width, int height);
+
+/**
+ * @brief Free allocated memory of a workspace.
+ * @param workspace - The workspace to be freed.
+ */
+__declspec(dllexport) void FreeSolverWorkspace(SolverWorkspace* workspace);
+
+#endif  // !SOLVER_WORKSPACE_H